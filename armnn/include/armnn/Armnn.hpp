@@ -9,3 +9,4 @@
 #include "INetwork.hpp"
 #include "Tensor.hpp"
 #include "Types.hpp"
+#include "WeightSource.hpp"
@@ -6,8 +6,11 @@
 
 #include "DescriptorsFwd.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <initializer_list>
+#include <string>
+#include <vector>
 
 #include "Tensor.hpp"
 #include "Types.hpp"
@@ -20,6 +23,13 @@ struct ActivationDescriptor
 {
     ActivationDescriptor() : m_Function(ActivationFunction::Sigmoid), m_A(0), m_B(0) {}
 
+    bool operator==(const ActivationDescriptor& rhs) const
+    {
+        return m_Function == rhs.m_Function
+               && m_A == rhs.m_A
+               && m_B == rhs.m_B;
+    }
+
     /// @brief The activation function to use
     /// (Sigmoid, TanH, Linear, ReLu, BoundedReLu, SoftReLu, LeakyReLu, Abs, Sqrt, Square).
     ActivationFunction m_Function;
@@ -40,6 +50,12 @@ struct PermuteDescriptor
         : m_DimMappings(dimMappings)
     {
     }
+
+    bool operator==(const PermuteDescriptor& rhs) const
+    {
+        return m_DimMappings.IsEqual(rhs.m_DimMappings);
+    }
+
     /// @brief Indicates how to translate tensor elements from a given source into the target destination, when
     /// source and target potentially have different memory layouts e.g. {0U, 3U, 1U, 2U}.
     PermutationVector m_DimMappings;
@@ -49,6 +65,12 @@ struct PermuteDescriptor
 struct SoftmaxDescriptor
 {
     SoftmaxDescriptor() : m_Beta(1.0f) {}
+
+    bool operator==(const SoftmaxDescriptor& rhs) const
+    {
+        return m_Beta == rhs.m_Beta;
+    }
+
     /// Exponentiation value.
     float              m_Beta;
 };
@@ -67,6 +89,9 @@ struct OriginsDescriptor
 
     OriginsDescriptor& operator=(OriginsDescriptor rhs);
 
+    /// Compares the views element by element, not the arrays holding them.
+    bool operator==(const OriginsDescriptor& rhs) const;
+
     /// @Brief Set the view origin coordinates. The arguments are: view, dimension, value.
     /// If the view is greater than or equal to GetNumViews(), then the view argument is out of range.
     /// If the coord is greater than or equal to GetNumViews(), then the coord argument is out of range.
@@ -108,6 +133,9 @@ struct ViewsDescriptor
 
     ViewsDescriptor& operator=(ViewsDescriptor rhs);
 
+    /// Compares the views element by element, not the arrays holding them.
+    bool operator==(const ViewsDescriptor& rhs) const;
+
     /// @Brief Set the view origin coordinates. The arguments are: view, dimension, value.
     /// If the view is greater than or equal to GetNumViews(), then the view argument is out of range.
     /// If the coord is greater than or equal to GetNumViews(), then the coord argument is out of range.
@@ -133,6 +161,38 @@ private:
     uint32_t**        m_ViewSizes;
 };
 
+inline bool OriginsDescriptor::operator==(const OriginsDescriptor& rhs) const
+{
+    if (m_ConcatAxis != rhs.m_ConcatAxis || m_NumViews != rhs.m_NumViews || m_NumDimensions != rhs.m_NumDimensions)
+    {
+        return false;
+    }
+    for (uint32_t view = 0; view < m_NumViews; ++view)
+    {
+        if (!std::equal(m_ViewOrigins[view], m_ViewOrigins[view] + m_NumDimensions, rhs.m_ViewOrigins[view]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool ViewsDescriptor::operator==(const ViewsDescriptor& rhs) const
+{
+    if (!(m_Origins == rhs.m_Origins))
+    {
+        return false;
+    }
+    for (uint32_t view = 0; view < GetNumViews(); ++view)
+    {
+        if (!std::equal(m_ViewSizes[view], m_ViewSizes[view] + GetNumDimensions(), rhs.m_ViewSizes[view]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 /// @brief Convenience template to create an OriginsDescriptor to use when creating a MergerLayer for performing
 /// concatenation of a number of input tensors.
 template <typename TensorShapeIt>
@@ -223,6 +283,22 @@ struct Pooling2dDescriptor
     , m_DataLayout(DataLayout::NCHW)
     {}
 
+    bool operator==(const Pooling2dDescriptor& rhs) const
+    {
+        return m_PoolType == rhs.m_PoolType
+               && m_PadLeft == rhs.m_PadLeft
+               && m_PadRight == rhs.m_PadRight
+               && m_PadTop == rhs.m_PadTop
+               && m_PadBottom == rhs.m_PadBottom
+               && m_PoolWidth == rhs.m_PoolWidth
+               && m_PoolHeight == rhs.m_PoolHeight
+               && m_StrideX == rhs.m_StrideX
+               && m_StrideY == rhs.m_StrideY
+               && m_OutputShapeRounding == rhs.m_OutputShapeRounding
+               && m_PaddingMethod == rhs.m_PaddingMethod
+               && m_DataLayout == rhs.m_DataLayout;
+    }
+
     /// The pooling algorithm to use (Max. Average, L2).
     PoolingAlgorithm    m_PoolType;
     /// Padding left value in the width dimension.
@@ -257,6 +333,12 @@ struct FullyConnectedDescriptor
     , m_TransposeWeightMatrix(false)
     {}
 
+    bool operator==(const FullyConnectedDescriptor& rhs) const
+    {
+        return m_BiasEnabled == rhs.m_BiasEnabled
+               && m_TransposeWeightMatrix == rhs.m_TransposeWeightMatrix;
+    }
+
     /// Enable/disable bias.
     bool m_BiasEnabled;
     /// Enable/disable transpose weight matrix.
@@ -277,6 +359,18 @@ struct Convolution2dDescriptor
     , m_DataLayout(DataLayout::NCHW)
     {}
 
+    bool operator==(const Convolution2dDescriptor& rhs) const
+    {
+        return m_PadLeft == rhs.m_PadLeft
+               && m_PadRight == rhs.m_PadRight
+               && m_PadTop == rhs.m_PadTop
+               && m_PadBottom == rhs.m_PadBottom
+               && m_StrideX == rhs.m_StrideX
+               && m_StrideY == rhs.m_StrideY
+               && m_BiasEnabled == rhs.m_BiasEnabled
+               && m_DataLayout == rhs.m_DataLayout;
+    }
+
     /// Padding left value in the width dimension.
     uint32_t             m_PadLeft;
     /// Padding right value in the width dimension.
@@ -309,6 +403,18 @@ struct DepthwiseConvolution2dDescriptor
     ,   m_DataLayout(DataLayout::NCHW)
     {}
 
+    bool operator==(const DepthwiseConvolution2dDescriptor& rhs) const
+    {
+        return m_PadLeft == rhs.m_PadLeft
+               && m_PadRight == rhs.m_PadRight
+               && m_PadTop == rhs.m_PadTop
+               && m_PadBottom == rhs.m_PadBottom
+               && m_StrideX == rhs.m_StrideX
+               && m_StrideY == rhs.m_StrideY
+               && m_BiasEnabled == rhs.m_BiasEnabled
+               && m_DataLayout == rhs.m_DataLayout;
+    }
+
     /// Padding left value in the width dimension.
     uint32_t   m_PadLeft;
     /// Padding right value in the width dimension.
@@ -343,6 +449,21 @@ struct DetectionPostProcessDescriptor
     , m_ScaleH(0)
     {}
 
+    bool operator==(const DetectionPostProcessDescriptor& rhs) const
+    {
+        return m_MaxDetections == rhs.m_MaxDetections
+               && m_MaxClassesPerDetection == rhs.m_MaxClassesPerDetection
+               && m_DetectionsPerClass == rhs.m_DetectionsPerClass
+               && m_NmsScoreThreshold == rhs.m_NmsScoreThreshold
+               && m_NmsIouThreshold == rhs.m_NmsIouThreshold
+               && m_NumClasses == rhs.m_NumClasses
+               && m_UseRegularNms == rhs.m_UseRegularNms
+               && m_ScaleX == rhs.m_ScaleX
+               && m_ScaleY == rhs.m_ScaleY
+               && m_ScaleW == rhs.m_ScaleW
+               && m_ScaleH == rhs.m_ScaleH;
+    }
+
     /// Maximum numbers of detections.
     uint32_t m_MaxDetections;
     /// Maximum numbers of classes per detection, used in Fast NMS.
@@ -380,6 +501,17 @@ struct NormalizationDescriptor
     , m_DataLayout(DataLayout::NCHW)
     {}
 
+    bool operator==(const NormalizationDescriptor& rhs) const
+    {
+        return m_NormChannelType == rhs.m_NormChannelType
+               && m_NormMethodType == rhs.m_NormMethodType
+               && m_NormSize == rhs.m_NormSize
+               && m_Alpha == rhs.m_Alpha
+               && m_Beta == rhs.m_Beta
+               && m_K == rhs.m_K
+               && m_DataLayout == rhs.m_DataLayout;
+    }
+
     /// Normalization channel algorithm to use (Across, Within).
     NormalizationAlgorithmChannel m_NormChannelType;
     /// Normalization method algorithm to use (LocalBrightness, LocalContrast).
@@ -403,6 +535,11 @@ struct L2NormalizationDescriptor
         : m_DataLayout(DataLayout::NCHW)
     {}
 
+    bool operator==(const L2NormalizationDescriptor& rhs) const
+    {
+        return m_DataLayout == rhs.m_DataLayout;
+    }
+
     /// The data layout to be used (NCHW, NHWC).
     DataLayout m_DataLayout;
 };
@@ -415,6 +552,12 @@ struct BatchNormalizationDescriptor
     , m_DataLayout(DataLayout::NCHW)
     {}
 
+    bool operator==(const BatchNormalizationDescriptor& rhs) const
+    {
+        return m_Eps == rhs.m_Eps
+               && m_DataLayout == rhs.m_DataLayout;
+    }
+
     /// Value to add to the variance. Used to avoid dividing by zero.
     float m_Eps;
     /// The data layout to be used (NCHW, NHWC).
@@ -437,6 +580,13 @@ struct BatchToSpaceNdDescriptor
         , m_DataLayout(DataLayout::NCHW)
     {}
 
+    bool operator==(const BatchToSpaceNdDescriptor& rhs) const
+    {
+        return m_BlockShape == rhs.m_BlockShape
+               && m_Crops == rhs.m_Crops
+               && m_DataLayout == rhs.m_DataLayout;
+    }
+
     /// Block shape values.
     std::vector<unsigned int> m_BlockShape;
     /// The values to crop from the input dimension.
@@ -453,6 +603,12 @@ struct FakeQuantizationDescriptor
     , m_Max(6.0f)
     {}
 
+    bool operator==(const FakeQuantizationDescriptor& rhs) const
+    {
+        return m_Min == rhs.m_Min
+               && m_Max == rhs.m_Max;
+    }
+
     /// Minimum value.
     float m_Min;
     /// Maximum value.
@@ -468,6 +624,13 @@ struct ResizeBilinearDescriptor
     , m_DataLayout(DataLayout::NCHW)
     {}
 
+    bool operator==(const ResizeBilinearDescriptor& rhs) const
+    {
+        return m_TargetWidth == rhs.m_TargetWidth
+               && m_TargetHeight == rhs.m_TargetHeight
+               && m_DataLayout == rhs.m_DataLayout;
+    }
+
     /// Target width value.
     uint32_t          m_TargetWidth;
     /// Target height value.
@@ -487,6 +650,11 @@ struct ReshapeDescriptor
     : m_TargetShape(shape)
     {}
 
+    bool operator==(const ReshapeDescriptor& rhs) const
+    {
+        return m_TargetShape == rhs.m_TargetShape;
+    }
+
     /// Target shape value.
     TensorShape m_TargetShape;
 };
@@ -507,6 +675,13 @@ struct SpaceToBatchNdDescriptor
     , m_DataLayout(DataLayout::NCHW)
     {}
 
+    bool operator==(const SpaceToBatchNdDescriptor& rhs) const
+    {
+        return m_BlockShape == rhs.m_BlockShape
+               && m_PadList == rhs.m_PadList
+               && m_DataLayout == rhs.m_DataLayout;
+    }
+
     /// Block shape value.
     std::vector<unsigned int> m_BlockShape;
     /// @brief Specifies the padding values for the input dimension:
@@ -528,6 +703,16 @@ struct LstmDescriptor
     , m_ProjectionEnabled(false)
     {}
 
+    bool operator==(const LstmDescriptor& rhs) const
+    {
+        return m_ActivationFunc == rhs.m_ActivationFunc
+               && m_ClippingThresCell == rhs.m_ClippingThresCell
+               && m_ClippingThresProj == rhs.m_ClippingThresProj
+               && m_CifgEnabled == rhs.m_CifgEnabled
+               && m_PeepholeEnabled == rhs.m_PeepholeEnabled
+               && m_ProjectionEnabled == rhs.m_ProjectionEnabled;
+    }
+
     /// @brief The activation function to use.
     /// 0: None, 1: Relu, 3: Relu6, 4: Tanh, 6: Sigmoid.
     uint32_t m_ActivationFunc;
@@ -556,6 +741,12 @@ struct MeanDescriptor
     , m_KeepDims(keepDims)
     {}
 
+    bool operator==(const MeanDescriptor& rhs) const
+    {
+        return m_Axis == rhs.m_Axis
+               && m_KeepDims == rhs.m_KeepDims;
+    }
+
     /// Values for the dimensions to reduce.
     std::vector<unsigned int> m_Axis;
     /// Enable/disable keep dimensions. If true, then the reduced dimensions that are of length 1 are kept.
@@ -572,6 +763,11 @@ struct PadDescriptor
     : m_PadList(padList)
     {}
 
+    bool operator==(const PadDescriptor& rhs) const
+    {
+        return m_PadList == rhs.m_PadList;
+    }
+
     /// @brief Specifies the padding for input dimension.
     /// First is the number of values to add before the tensor in the dimension.
     /// Second is the number of values to add after the tensor in the dimension.
@@ -605,6 +801,19 @@ struct StridedSliceDescriptor
                        unsigned int axis,
                        int startForAxis) const;
 
+    bool operator==(const StridedSliceDescriptor& rhs) const
+    {
+        return m_Begin == rhs.m_Begin
+               && m_End == rhs.m_End
+               && m_Stride == rhs.m_Stride
+               && m_BeginMask == rhs.m_BeginMask
+               && m_EndMask == rhs.m_EndMask
+               && m_ShrinkAxisMask == rhs.m_ShrinkAxisMask
+               && m_EllipsisMask == rhs.m_EllipsisMask
+               && m_NewAxisMask == rhs.m_NewAxisMask
+               && m_DataLayout == rhs.m_DataLayout;
+    }
+
     /// Begin values for the input that will be sliced.
     std::vector<int> m_Begin;
     /// End values for the input that will be sliced.
@@ -642,6 +851,12 @@ struct DebugDescriptor
     , m_SlotIndex(index)
     {}
 
+    bool operator==(const DebugDescriptor& rhs) const
+    {
+        return m_LayerName == rhs.m_LayerName
+               && m_SlotIndex == rhs.m_SlotIndex;
+    }
+
     /// The name of the debug layer.
     std::string m_LayerName;
     /// The slot index of the debug layer.
@@ -657,6 +872,12 @@ struct PreCompiledDescriptor
 
     ~PreCompiledDescriptor() = default;
 
+    bool operator==(const PreCompiledDescriptor& rhs) const
+    {
+        return m_NumInputSlots == rhs.m_NumInputSlots
+               && m_NumOutputSlots == rhs.m_NumOutputSlots;
+    }
+
     unsigned int m_NumInputSlots;
     unsigned int m_NumOutputSlots;
 };
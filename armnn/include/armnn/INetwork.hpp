@@ -12,10 +12,14 @@
 #include <armnn/Types.hpp>
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace armnn
 {
+
+class WeightSource;
+
     /// @brief An input connection slot for a layer.
 /// The input slot can be connected to an output slot of the preceding layer in the graph.
 /// Only one connection to the input slot is allowed.
@@ -117,6 +121,8 @@ public:
     virtual IConnectableLayer* AddInputLayer(LayerBindingId id, const char* name = nullptr) = 0;
 
     /// Adds a 2D convolution layer to the network.
+    /// The network keeps its own copy of the constant tensors passed to the Add*Layer functions, the caller's buffers
+    /// can be released as soon as the call returns. Identical tensors are only stored once.
     /// @param convolution2dDescriptor - Description of the 2D convolution layer.
     /// @param weights - Tensor for the weights data.
     /// @param biases - (Optional) Tensor for the bias data. Must match the output tensor shape.
@@ -133,7 +139,8 @@ public:
 
     /// Adds a 2D depthwise convolution layer to the network.
     /// @param convolution2dDescriptor - Description of the 2D depthwise convolution layer.
-    /// @param weights - Tensor for the weights data. Expected format: [1, outputChannels, height, width].
+    /// @param weights - Tensor for the weights data.
+    ///                  Expected format: [channelMultiplier, inputChannels, height, width].
     /// @param biases (Optional) - Tensor for the bias data. Must match the output tensor shape.
     /// @param name - Optional name for the layer.
     /// @return - Interface for configuring the layer.
@@ -163,7 +170,13 @@ public:
         const ConstTensor& biases,
         const char* name = nullptr) = 0;
 
-    
+    /// Adds a permute layer to the network.
+    /// @param permuteDescriptor - PermuteDescriptor to configure the permute.
+    /// @param name - Optional name for the layer.
+    /// @return - Interface for configuring the layer.
+    virtual IConnectableLayer* AddPermuteLayer(const PermuteDescriptor& permuteDescriptor,
+        const char* name = nullptr) = 0;
+
     /// Adds a pooling layer to the network.
     /// @param pooling2dDescriptor - Pooling2dDescriptor to configure the pooling.
     /// @param name - Optional name for the layer.
@@ -178,6 +191,28 @@ public:
     virtual IConnectableLayer* AddActivationLayer(const ActivationDescriptor& activationDescriptor,
         const char* name = nullptr) = 0;
 
+    /// Adds a batch normalization layer to the network.
+    /// @param desc - Parameters for the batch normalization operation.
+    /// @param mean - Pre-calculated mean for each channel.
+    /// @param variance - Pre-calculated variance for each channel.
+    /// @param beta - Per-channel additive factor.
+    /// @param gamma - Per-channel multiplicative factor.
+    /// @param name - Optional name for the layer.
+    /// @return - Interface for configuring the layer.
+    virtual IConnectableLayer* AddBatchNormalizationLayer(const BatchNormalizationDescriptor& desc,
+        const ConstTensor& mean,
+        const ConstTensor& variance,
+        const ConstTensor& beta,
+        const ConstTensor& gamma,
+        const char* name = nullptr) = 0;
+
+    /// Adds a layer with no inputs and a single output, which always has the same value.
+    /// @param input - Tensor to be provided as the only output of the layer.
+    /// @param name - Optional name for the layer.
+    /// @return - Interface for configuring the layer.
+    virtual IConnectableLayer* AddConstantLayer(const ConstTensor& input,
+        const char* name = nullptr) = 0;
+
     /// Adds a normalization layer to the network.
     /// @param normalizationDescriptor - NormalizationDescriptor to configure the normalization.
     /// @param name - Optional name for the layer.
@@ -192,6 +227,39 @@ public:
     virtual IConnectableLayer* AddSoftmaxLayer(const SoftmaxDescriptor& softmaxDescriptor,
         const char* name = nullptr) = 0;
 
+    /// Adds an output layer to the network.
+    /// @param id - User generated id to uniquely identify a particular output. The same id needs to be specified
+    /// when passing the outputs to the IRuntime::EnqueueWorkload() function.
+    /// @param name - Optional name for the layer.
+    /// @return - Interface for configuring the layer.
+    virtual IConnectableLayer* AddOutputLayer(LayerBindingId id, const char* name = nullptr) = 0;
+
+    /// Stores the data of a constant tensor in the network, from a source other than memory. The tensor returned
+    /// can then be passed to the Add*Layer functions, which use it without another copy: building the network
+    /// doesn't need its weights in memory all at once.
+    /// Data in a file is mapped rather than read when its offset is a multiple of 64 bytes, and read in otherwise.
+    /// Mapped data is paged in as the network is optimized and saved, the file must stay unchanged meanwhile.
+    /// Throws FileNotFoundException if the file cannot be read, or whatever the reader throws.
+    /// @param tensorInfo - Shape and data type of the tensor.
+    /// @param source - Where the tensorInfo.GetNumBytes() bytes of data are read from.
+    /// @return - A tensor pointing at the data stored by the network, valid for the lifetime of the network.
+    virtual ConstTensor AddConstantData(const TensorInfo& tensorInfo, const WeightSource& source) = 0;
+
+    /// Keeps the constant data stored by the network from now on (the data read by AddConstantData(), the tensors
+    /// copied by the Add*Layer functions and the weights computed by the optimizations) in an unlinked temporary
+    /// file of the directory, rather than on the heap. The operating system then writes the data out and drops it
+    /// from memory as needed, so converting a network takes memory in proportion to its largest layers rather than
+    /// to its size. Small tensors stay on the heap.
+    /// Throws FileNotFoundException if no file can be created in the directory.
+    virtual void SetConstantStorageDirectory(const std::string& directory) = 0;
+
+    /// Sets the TensorInfo of the output slots of all the layers, from the TensorInfos of the input layers and the
+    /// properties of each layer, so that only the outputs of the input layers need setting by hand.
+    /// Output slots which already have a TensorInfo keep its data type and quantization parameters, only their
+    /// shape is updated (e.g. to set the quantization parameters of the outputs of quantized layers).
+    /// Throws LayerValidationException if a layer is not fully connected or its shapes are inconsistent.
+    virtual void InferTensorInfos() = 0;
+
     
 protected:
     ~INetwork() {}
@@ -5,6 +5,7 @@
 #pragma once
 #include "TensorFwd.hpp"
 
+#include "Exceptions.hpp"
 #include "Types.hpp"
 
 
@@ -4,7 +4,9 @@
 //
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <initializer_list>
 #include <memory>
 
 
@@ -0,0 +1,55 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+
+namespace armnn
+{
+
+/// Where the data of a constant tensor comes from when it is not in memory, for networks too large to hold whole
+/// while they are built. See INetwork::AddConstantData().
+class WeightSource
+{
+public:
+    /// Writes the numBytes bytes of the tensor data to the destination. Throws to report a failure.
+    using Reader = std::function<void(void* destination, std::size_t numBytes)>;
+
+    /// The data is stored in a file at the given offset, in the layout and data type of the tensor.
+    static WeightSource FromFile(const std::string& path, uint64_t offset)
+    {
+        WeightSource source;
+        source.m_Path   = path;
+        source.m_Offset = offset;
+        return source;
+    }
+
+    /// The data is produced by the reader (read from a container format, decompressed...).
+    static WeightSource FromReader(Reader reader)
+    {
+        WeightSource source;
+        source.m_Reader = std::move(reader);
+        return source;
+    }
+
+    bool IsFile() const { return !m_Path.empty(); }
+
+    const std::string& GetPath() const { return m_Path; }
+    uint64_t GetOffset() const { return m_Offset; }
+    const Reader& GetReader() const { return m_Reader; }
+
+private:
+    WeightSource() = default;
+
+    std::string m_Path;
+    uint64_t    m_Offset = 0;
+    Reader      m_Reader;
+};
+
+} // namespace armnn
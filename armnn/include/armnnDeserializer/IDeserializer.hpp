@@ -0,0 +1,40 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/INetwork.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace armnnDeserializer
+{
+
+class IDeserializer;
+using IDeserializerPtr = std::unique_ptr<IDeserializer, void(*)(IDeserializer* deserializer)>;
+
+/// Creates networks from the binary format written by armnnSerializer::ISerializer.
+/// Nothing is parsed or copied for the constant tensors: the layers of the network point straight at the
+/// serialized data.
+class IDeserializer
+{
+public:
+    static IDeserializer* CreateRaw();
+    static IDeserializerPtr Create();
+    static void Destroy(IDeserializer* deserializer);
+
+    /// Maps the file into memory and creates the network from it.
+    /// The mapping is owned by the deserializer, networks created this way must not outlive it.
+    virtual armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile) = 0;
+
+    /// Creates the network from serialized data in memory.
+    /// The data is not copied, it must stay valid for the lifetime of the network and be 64-byte aligned.
+    virtual armnn::INetworkPtr CreateNetworkFromBinary(const void* binaryContent, std::size_t size) = 0;
+
+protected:
+    virtual ~IDeserializer() {}
+};
+
+} // namespace armnnDeserializer
@@ -0,0 +1,42 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/INetwork.hpp>
+
+#include <memory>
+#include <ostream>
+
+namespace armnnSerializer
+{
+
+class ISerializer;
+using ISerializerPtr = std::unique_ptr<ISerializer, void(*)(ISerializer* serializer)>;
+
+/// Writes a network in the offline binary format.
+/// The format is a flat set of tables (layers, slots, descriptors, tensor infos) followed by the constant tensors,
+/// each of them starting on a 64-byte boundary. A device can map the file and use the tensors in place, see
+/// armnnDeserializer::IDeserializer.
+class ISerializer
+{
+public:
+    static ISerializer* CreateRaw();
+    static ISerializerPtr Create();
+    static void Destroy(ISerializer* serializer);
+
+    /// Serializes the network to ISerializer.
+    /// The constant tensors of the network are not copied: they must stay valid until the network has been saved.
+    /// @param [in] inNetwork The network to be serialized.
+    virtual void Serialize(const armnn::INetwork& inNetwork) = 0;
+
+    /// Serializes the SerializedContent to the stream.
+    /// @param [stream] the stream that the information is written to
+    virtual bool SaveSerializedToStream(std::ostream& stream) = 0;
+
+protected:
+    virtual ~ISerializer() {}
+};
+
+} // namespace armnnSerializer
@@ -0,0 +1,72 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "ArenaAllocator.hpp"
+
+#include <boost/assert.hpp>
+
+#include <cstdint>
+
+namespace armnn
+{
+
+ArenaAllocator::ArenaAllocator(std::size_t blockSize)
+: m_BlockSize(blockSize)
+, m_Cursor(nullptr)
+, m_End(nullptr)
+, m_BytesAllocated(0)
+, m_BytesReserved(0)
+{
+    BOOST_ASSERT(blockSize > 0);
+}
+
+void* ArenaAllocator::Allocate(std::size_t size, std::size_t alignment)
+{
+    BOOST_ASSERT_MSG((alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+    const auto cursor  = reinterpret_cast<std::uintptr_t>(m_Cursor);
+    const auto aligned = (cursor + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+
+    if (m_Cursor == nullptr || aligned + size > reinterpret_cast<std::uintptr_t>(m_End))
+    {
+        // Allocations bigger than a quarter of a block get a block of their own, so that they don't waste
+        // the remainder of the current one.
+        const std::size_t required = size + alignment;
+        if (required > m_BlockSize / 4)
+        {
+            char* const block = AllocateBlock(required);
+            const auto blockStart = reinterpret_cast<std::uintptr_t>(block);
+            const auto result = (blockStart + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+            m_BytesAllocated += required;
+            return reinterpret_cast<void*>(result);
+        }
+
+        m_Cursor = AllocateBlock(m_BlockSize);
+        m_End    = m_Cursor + m_BlockSize;
+        return Allocate(size, alignment);
+    }
+
+    char* const result = reinterpret_cast<char*>(aligned);
+    m_BytesAllocated += static_cast<std::size_t>((result + size) - m_Cursor);
+    m_Cursor = result + size;
+    return result;
+}
+
+void ArenaAllocator::Release()
+{
+    m_Blocks.clear();
+    m_Cursor         = nullptr;
+    m_End            = nullptr;
+    m_BytesAllocated = 0;
+    m_BytesReserved  = 0;
+}
+
+char* ArenaAllocator::AllocateBlock(std::size_t size)
+{
+    m_Blocks.emplace_back(new char[size]);
+    m_BytesReserved += size;
+    return m_Blocks.back().get();
+}
+
+} // namespace armnn
@@ -0,0 +1,63 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+/// A bump allocator handing out memory from large blocks.
+/// Individual allocations are never freed: every block is released at once when the arena is destroyed
+/// (or Release() is called). Addresses stay valid until then, which makes it suitable for graph objects
+/// that are referenced by pointer from all over the network.
+/// The arena never runs destructors, owners of non-trivial objects must do it themselves.
+class ArenaAllocator
+{
+public:
+    static constexpr std::size_t DefaultBlockSize = 64 * 1024;
+
+    explicit ArenaAllocator(std::size_t blockSize = DefaultBlockSize);
+    ~ArenaAllocator() = default;
+
+    ArenaAllocator(const ArenaAllocator&) = delete;
+    ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+    /// Returns a pointer to @p size bytes aligned to @p alignment (which must be a power of two).
+    void* Allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
+
+    /// Allocates and constructs an object of type T. The caller is responsible for calling its destructor.
+    template <typename T, typename... Args>
+    T* New(Args&&... args)
+    {
+        void* const memory = Allocate(sizeof(T), alignof(T));
+        return new (memory) T(std::forward<Args>(args)...);
+    }
+
+    /// Frees every block. All the pointers previously returned become invalid.
+    void Release();
+
+    /// Number of bytes handed out to callers (including alignment padding).
+    std::size_t GetBytesAllocated() const { return m_BytesAllocated; }
+
+    /// Number of bytes obtained from the system.
+    std::size_t GetBytesReserved() const { return m_BytesReserved; }
+
+private:
+    char* AllocateBlock(std::size_t size);
+
+    const std::size_t m_BlockSize;
+    std::vector<std::unique_ptr<char[]>> m_Blocks;
+    char* m_Cursor;
+    char* m_End;
+    std::size_t m_BytesAllocated;
+    std::size_t m_BytesReserved;
+};
+
+} // namespace armnn
@@ -0,0 +1,202 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "CommonSubexpressionElimination.hpp"
+
+#include "DescriptorHash.hpp"
+#include "Graph.hpp"
+#include "LayerState.hpp"
+#include "LayerVisitor.hpp"
+
+#include <Hash.hpp>
+
+#include <boost/cast.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Hashes the state of the layers which can be merged. Constant tensors are hashed by identity, like they compare.
+class StateHasher
+{
+public:
+    explicit StateHasher(uint64_t seed)
+    : m_Hash(seed)
+    , m_IsMergeable(false)
+    {
+    }
+
+    template <typename LayerT>
+    auto Visit(const LayerT& layer) -> decltype(GetState(layer), void())
+    {
+        ForEachField(GetState(layer), *this);
+        m_IsMergeable = true;
+    }
+
+    template <typename Descriptor>
+    void operator()(const Descriptor& descriptor) { m_Hash = HashDescriptor(descriptor, m_Hash); }
+
+    void operator()(const ConstantId& constant)
+    {
+        m_Hash = armnnUtils::HashCombine(m_Hash, reinterpret_cast<uintptr_t>(constant.m_Data));
+        m_Hash = HashTensorInfo(constant.m_Info, m_Hash);
+    }
+
+    void operator()(PackedWeightLayout layout) { m_Hash = armnnUtils::HashCombine(m_Hash, uint64_t(layout)); }
+    void operator()(bool value) { m_Hash = armnnUtils::HashCombine(m_Hash, value ? 1u : 0u); }
+
+    uint64_t GetHash() const { return m_Hash; }
+    bool IsMergeable() const { return m_IsMergeable; }
+
+private:
+    uint64_t m_Hash;
+    bool     m_IsMergeable;
+};
+
+/// Compares the state of a layer with that of another layer of the same type.
+class StateComparer
+{
+public:
+    explicit StateComparer(const Layer& other)
+    : m_Other(other)
+    , m_IsEqual(false)
+    {
+    }
+
+    template <typename LayerT>
+    auto Visit(const LayerT& layer) -> decltype(GetState(layer), void())
+    {
+        m_IsEqual = GetState(layer) == GetState(*boost::polymorphic_downcast<const LayerT*>(&m_Other));
+    }
+
+    bool IsEqual() const { return m_IsEqual; }
+
+private:
+    const Layer& m_Other;
+    bool         m_IsEqual;
+};
+
+/// Hashes everything that defines what a layer computes: its type, inputs, state and output TensorInfos.
+/// @return false if the layer cannot be merged.
+bool HashLayer(const Layer& layer, uint64_t& hash)
+{
+    StateHasher hasher(static_cast<uint64_t>(layer.GetType()));
+    VisitLayer(layer, hasher);
+    if (!hasher.IsMergeable())
+    {
+        return false;
+    }
+
+    hash = hasher.GetHash();
+    for (auto&& inputSlot : layer.GetInputSlots())
+    {
+        const OutputSlot* const source = inputSlot.GetConnectedOutputSlot();
+        if (source == nullptr)
+        {
+            return false;
+        }
+        hash = armnnUtils::HashCombine(hash, reinterpret_cast<uintptr_t>(source));
+    }
+    for (auto&& outputSlot : layer.GetOutputSlots())
+    {
+        hash = HashTensorInfo(outputSlot.GetTensorInfo(), hash);
+    }
+    return true;
+}
+
+bool AreEquivalent(const Layer& first, const Layer& second)
+{
+    if (first.GetType() != second.GetType() ||
+        first.GetNumInputSlots() != second.GetNumInputSlots() ||
+        first.GetNumOutputSlots() != second.GetNumOutputSlots())
+    {
+        return false;
+    }
+    for (unsigned int i = 0; i < first.GetNumInputSlots(); ++i)
+    {
+        if (first.GetInputSlot(i).GetConnectedOutputSlot() != second.GetInputSlot(i).GetConnectedOutputSlot())
+        {
+            return false;
+        }
+    }
+    for (unsigned int i = 0; i < first.GetNumOutputSlots(); ++i)
+    {
+        if (first.GetOutputSlot(i).GetTensorInfo() != second.GetOutputSlot(i).GetTensorInfo())
+        {
+            return false;
+        }
+    }
+
+    StateComparer comparer(second);
+    VisitLayer(first, comparer);
+    return comparer.IsEqual();
+}
+
+} // namespace
+
+unsigned int EliminateCommonSubexpressions(Graph& graph)
+{
+    // The producers of a layer come before it in topological order, so they have been merged already when it is
+    // hashed: duplicates read exactly the same OutputSlots.
+    const Graph::LayerRange order = graph.TopologicalSort();
+    std::vector<Layer*> layers(order.begin(), order.end());
+
+    std::unordered_multimap<uint64_t, Layer*> layersByHash;
+    std::vector<Layer*> duplicates;
+    for (Layer* layer : layers)
+    {
+        uint64_t hash = 0;
+        if (!HashLayer(*layer, hash))
+        {
+            continue;
+        }
+
+        Layer* original = nullptr;
+        const auto candidates = layersByHash.equal_range(hash);
+        for (auto it = candidates.first; it != candidates.second && original == nullptr; ++it)
+        {
+            if (AreEquivalent(*it->second, *layer))
+            {
+                original = it->second;
+            }
+        }
+
+        if (original == nullptr)
+        {
+            layersByHash.emplace(hash, layer);
+            continue;
+        }
+
+        original->AddRelatedLayerName(layer->GetName());
+        for (StringPool::StringId relatedName : layer->GetRelatedLayerNames())
+        {
+            original->AddRelatedLayerName(graph.GetStringPool().Get(relatedName));
+        }
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            layer->GetOutputSlot(i).MoveAllConnections(original->GetOutputSlot(i));
+        }
+        duplicates.push_back(layer);
+    }
+
+    for (Layer* layer : duplicates)
+    {
+        graph.EraseLayer(layer);
+    }
+
+    if (!duplicates.empty())
+    {
+        graph.SetMemoryPlan(MemoryPlan());
+    }
+    return static_cast<unsigned int>(duplicates.size());
+}
+
+} // namespace armnn
@@ -0,0 +1,24 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+namespace armnn
+{
+
+class Graph;
+
+/// Merges the layers which compute the same thing, e.g. a Permute or an Activation of the same tensor written
+/// several times by the code generating a model: two layers are the same when they have the same type, the same
+/// inputs, equal descriptors, the same constant tensors and the same output TensorInfos. The consumers of the
+/// duplicate are moved to the layer first seen in topological order, and the duplicate is removed.
+/// Constant tensors are compared by identity: the ConstantPool keeps a single copy of identical data, and the
+/// serializer writes each pooled buffer once, so weights added to a network twice end up shared and are merged too.
+/// Constant layers are merged the same way, so their consumers may merge in turn. Input and Output layers are
+/// never merged.
+/// The memory plan of the graph is invalidated if any layer is removed.
+/// @return The number of layers removed.
+unsigned int EliminateCommonSubexpressions(Graph& graph);
+
+} // namespace armnn
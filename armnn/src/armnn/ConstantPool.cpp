@@ -0,0 +1,411 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "ConstantPool.hpp"
+
+#include <Hash.hpp>
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/WeightSource.hpp>
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace armnn
+{
+
+namespace
+{
+
+std::size_t GetPageSize()
+{
+    static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+
+uint64_t RoundUpToPage(uint64_t size)
+{
+    const uint64_t pageSize = GetPageSize();
+    return (size + pageSize - 1) / pageSize * pageSize;
+}
+
+/// Closes a file descriptor on scope exit.
+class FileCloser
+{
+public:
+    explicit FileCloser(int fd) : m_Fd(fd) {}
+    ~FileCloser() { close(m_Fd); }
+
+    FileCloser(const FileCloser&) = delete;
+    FileCloser& operator=(const FileCloser&) = delete;
+
+private:
+    int m_Fd;
+};
+
+} // anonymous namespace
+
+constexpr std::size_t ConstantPool::StorageChunkSize;
+
+ConstantPool::Mapping::~Mapping()
+{
+    munmap(m_Address, m_Size);
+}
+
+ConstantPool::~ConstantPool()
+{
+    if (m_StorageFile >= 0)
+    {
+        // The mappings of the storage file, released afterwards, don't need the descriptor.
+        close(m_StorageFile);
+    }
+}
+
+ConstTensor ConstantPool::Add(const ConstTensor& tensor)
+{
+    const void* const data = tensor.GetMemoryArea();
+    const std::size_t size = tensor.GetNumBytes();
+
+    if (data == nullptr || m_EntriesByData.count(data) != 0 || IsExternal(data, size))
+    {
+        return tensor;
+    }
+
+    const uint64_t hash = armnnUtils::Hash64(data, size);
+
+    const Entry* const existing = Find(data, size, hash);
+    if (existing != nullptr)
+    {
+        m_BytesSaved += size;
+        return ConstTensor(tensor.GetInfo(), existing->m_Data);
+    }
+
+    Storage storage = AllocateStorage(size);
+    std::memcpy(storage.m_Data, data, size);
+
+    const Entry& entry = AddEntry(storage.m_Data, size, hash, std::move(storage));
+    return ConstTensor(tensor.GetInfo(), entry.m_Data);
+}
+
+ConstTensor ConstantPool::Add(const TensorInfo& tensorInfo, Buffer&& data)
+{
+    if (data.size() != tensorInfo.GetNumBytes())
+    {
+        throw InvalidArgumentException("ConstantPool: data size doesn't match the tensor info");
+    }
+
+    // Released on return whatever happens, unless adopted.
+    Buffer input = std::move(data);
+    const std::size_t size = input.size();
+
+    if (size == 0 || (m_StorageFile >= 0 && size >= MinFileBackedSize))
+    {
+        return Add(ConstTensor(tensorInfo, input.data()));
+    }
+
+    const uint64_t hash = armnnUtils::Hash64(input.data(), size);
+
+    const Entry* const existing = Find(input.data(), size, hash);
+    if (existing != nullptr)
+    {
+        m_BytesSaved += size;
+        return ConstTensor(tensorInfo, existing->m_Data);
+    }
+
+    Storage storage;
+    storage.m_Data = input.data();
+    storage.m_Buffer = std::move(input);
+
+    const Entry& entry = AddEntry(storage.m_Data, size, hash, std::move(storage));
+    return ConstTensor(tensorInfo, entry.m_Data);
+}
+
+ConstTensor ConstantPool::Add(const TensorInfo& tensorInfo, const WeightSource& source)
+{
+    const std::size_t size = tensorInfo.GetNumBytes();
+
+    if (!source.IsFile())
+    {
+        Storage storage = AllocateStorage(size);
+        try
+        {
+            source.GetReader()(storage.m_Data, size);
+        }
+        catch (...)
+        {
+            DiscardStorage(std::move(storage));
+            throw;
+        }
+        return ConstTensor(tensorInfo, AddOrDiscard(std::move(storage), size).m_Data);
+    }
+
+    const std::string& path = source.GetPath();
+    const uint64_t offset = source.GetOffset();
+
+    const SourceFile& file = GetSourceFile(path);
+    if (file.m_Size < offset || file.m_Size - offset < size)
+    {
+        throw InvalidArgumentException(
+            boost::str(boost::format("Constant data file %1% is too short for %2% bytes at offset %3%")
+                       % path % size % offset));
+    }
+    if (size == 0)
+    {
+        return ConstTensor(tensorInfo, AddOrDiscard(AllocateStorage(0), 0).m_Data);
+    }
+
+    uint8_t* const data = static_cast<uint8_t*>(file.m_Mapping->m_Address) + offset;
+    if (offset % Alignment != 0)
+    {
+        Storage storage = AllocateStorage(size);
+        std::memcpy(storage.m_Data, data, size);
+        return ConstTensor(tensorInfo, AddOrDiscard(std::move(storage), size).m_Data);
+    }
+    if (m_EntriesByData.count(data) != 0)
+    {
+        return ConstTensor(tensorInfo, data);
+    }
+
+    Storage storage;
+    storage.m_Data = data;
+
+    // Not hashed, so that storing the data doesn't read it all in.
+    const Entry& entry = AddEntry(storage.m_Data, size, 0, std::move(storage));
+    return ConstTensor(tensorInfo, entry.m_Data);
+}
+
+std::pair<ConstTensor, void*> ConstantPool::Allocate(const TensorInfo& tensorInfo)
+{
+    const std::size_t size = tensorInfo.GetNumBytes();
+
+    Storage storage = AllocateStorage(size);
+    if (!storage.m_Zeroed)
+    {
+        std::memset(storage.m_Data, 0, size);
+    }
+
+    uint8_t* const data = storage.m_Data;
+    AddEntry(data, size, 0, std::move(storage));
+
+    return std::make_pair(ConstTensor(tensorInfo, data), static_cast<void*>(data));
+}
+
+void ConstantPool::AddExternalRegion(const void* data, std::size_t size)
+{
+    m_ExternalRegions.emplace_back(static_cast<const uint8_t*>(data), size);
+}
+
+void ConstantPool::SetStorageDirectory(const std::string& directory)
+{
+    std::string path = directory + "/armnn-constants-XXXXXX";
+
+    const int fd = mkstemp(&path[0]);
+    if (fd < 0)
+    {
+        throw FileNotFoundException(
+            boost::str(boost::format("Cannot create a constant storage file in %1%") % directory));
+    }
+
+    // Only reachable through the descriptor: the space is reclaimed as soon as the pool goes away.
+    unlink(path.c_str());
+
+    if (m_StorageFile >= 0)
+    {
+        close(m_StorageFile);
+    }
+    m_StorageFile = fd;
+    m_StorageFileSize = 0;
+    m_Chunk = nullptr;
+    m_ChunkFileOffset = 0;
+}
+
+uint64_t ConstantPool::GetHash(const void* data) const
+{
+    const auto it = m_EntriesByData.find(data);
+    return (it != m_EntriesByData.end()) ? it->second->m_Hash : 0;
+}
+
+bool ConstantPool::IsExternal(const void* data, std::size_t size) const
+{
+    const uint8_t* const begin = static_cast<const uint8_t*>(data);
+    for (auto&& region : m_ExternalRegions)
+    {
+        if (begin >= region.first && size <= region.second &&
+            static_cast<std::size_t>(begin - region.first) <= region.second - size)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+const ConstantPool::SourceFile& ConstantPool::GetSourceFile(const std::string& path)
+{
+    const auto it = m_SourceFiles.find(path);
+    if (it != m_SourceFiles.end())
+    {
+        return it->second;
+    }
+
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw FileNotFoundException(boost::str(boost::format("Cannot open constant data file %1%") % path));
+    }
+    FileCloser closer(fd);
+
+    struct stat status;
+    if (fstat(fd, &status) != 0)
+    {
+        throw FileNotFoundException(boost::str(boost::format("Cannot read constant data file %1%") % path));
+    }
+
+    SourceFile file;
+    file.m_Size = static_cast<uint64_t>(status.st_size);
+    if (file.m_Size != 0)
+    {
+        const std::size_t size = static_cast<std::size_t>(file.m_Size);
+        void* const address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED)
+        {
+            throw FileNotFoundException(boost::str(boost::format("Cannot map constant data file %1%") % path));
+        }
+        file.m_Mapping.reset(new Mapping(address, size));
+    }
+    return m_SourceFiles.emplace(path, std::move(file)).first->second;
+}
+
+const ConstantPool::Entry* ConstantPool::Find(const void* data, std::size_t size, uint64_t hash) const
+{
+    const auto range = m_EntriesByHash.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        const Entry& entry = *it->second;
+        if (entry.m_Size == size && std::memcmp(entry.m_Data, data, size) == 0)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+ConstantPool::Storage ConstantPool::AllocateStorage(std::size_t size)
+{
+    if (m_StorageFile >= 0 && size >= MinFileBackedSize)
+    {
+        return AllocateFileStorage(size);
+    }
+
+    Storage storage;
+    storage.m_Heap.reset(new uint8_t[size + Alignment]);
+
+    const auto address = reinterpret_cast<std::uintptr_t>(storage.m_Heap.get());
+    const auto aligned = (address + Alignment - 1) & ~static_cast<std::uintptr_t>(Alignment - 1);
+
+    storage.m_Data = reinterpret_cast<uint8_t*>(aligned);
+    return storage;
+}
+
+ConstantPool::Storage ConstantPool::AllocateFileStorage(std::size_t size)
+{
+    uint64_t offset = (m_StorageFileSize + Alignment - 1) / Alignment * Alignment;
+    if (m_Chunk == nullptr || offset + size > m_ChunkFileOffset + m_Chunk->m_Size)
+    {
+        // The chunk is mapped beyond the end of the file, which only grows as its ranges are handed out.
+        offset = RoundUpToPage(m_StorageFileSize);
+        const std::size_t chunkSize = std::max(StorageChunkSize, static_cast<std::size_t>(RoundUpToPage(size)));
+        void* const address = mmap(nullptr, chunkSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_StorageFile,
+                                   static_cast<off_t>(offset));
+        if (address == MAP_FAILED)
+        {
+            throw FileNotFoundException("Cannot map the constant storage file");
+        }
+        m_StorageChunks.emplace_back(new Mapping(address, chunkSize));
+        m_Chunk = m_StorageChunks.back().get();
+        m_ChunkFileOffset = offset;
+    }
+
+    // Reserves the blocks now: running out of space then fails here rather than on a later write.
+    const int error = posix_fallocate(m_StorageFile, static_cast<off_t>(offset), static_cast<off_t>(size));
+    if (error != 0)
+    {
+        throw FileNotFoundException(boost::str(
+            boost::format("Cannot grow the constant storage file: %1%") % std::strerror(error)));
+    }
+    m_StorageFileSize = offset + size;
+
+    Storage storage;
+    storage.m_Data = static_cast<uint8_t*>(m_Chunk->m_Address) + (offset - m_ChunkFileOffset);
+    storage.m_FileOffset = offset;
+    storage.m_FileSize = size;
+    storage.m_Zeroed = true;
+    return storage;
+}
+
+void ConstantPool::DiscardStorage(Storage storage)
+{
+    if (storage.m_FileSize != 0 && m_StorageFile >= 0 &&
+        storage.m_FileOffset + storage.m_FileSize == m_StorageFileSize)
+    {
+        // Truncating also zeroes the data for the next allocation, which relies on it.
+        if (ftruncate(m_StorageFile, static_cast<off_t>(storage.m_FileOffset)) == 0)
+        {
+            m_StorageFileSize = storage.m_FileOffset;
+        }
+    }
+}
+
+const ConstantPool::Entry& ConstantPool::AddOrDiscard(Storage storage, std::size_t size)
+{
+    const uint64_t hash = armnnUtils::Hash64(storage.m_Data, size);
+
+    const Entry* const existing = Find(storage.m_Data, size, hash);
+    if (existing != nullptr)
+    {
+        m_BytesSaved += size;
+        DiscardStorage(std::move(storage));
+        return *existing;
+    }
+
+    uint8_t* const data = storage.m_Data;
+    return AddEntry(data, size, hash, std::move(storage));
+}
+
+ConstantPool::Entry& ConstantPool::AddEntry(const void* data, std::size_t size, uint64_t hash, Storage storage)
+{
+    if (storage.m_FileSize != 0)
+    {
+        m_BytesInStorageFile += size;
+    }
+    else if (storage.m_Heap || !storage.m_Buffer.empty())
+    {
+        m_BytesOnHeap += size;
+    }
+    else
+    {
+        m_BytesMapped += size;
+    }
+
+    m_Entries.emplace_back(new Entry{ data, size, hash, std::move(storage) });
+    Entry& entry = *m_Entries.back();
+
+    if (hash != 0)
+    {
+        m_EntriesByHash.emplace(hash, &entry);
+    }
+    m_EntriesByData.emplace(data, &entry);
+    m_BytesStored += size;
+
+    return entry;
+}
+
+} // namespace armnn
@@ -0,0 +1,188 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+#include <AlignedAllocator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+class WeightSource;
+
+/// Owns the data of the constant tensors (weights, biases, ...) of a graph.
+/// Tensors are identified by a hash of their contents: adding data identical to something already in the pool
+/// returns the existing copy, so tied or repeated weights are only stored once. The tensors returned point into
+/// the pool and stay valid for its lifetime; their TensorInfo is the one passed in, only the memory is shared.
+class ConstantPool
+{
+public:
+    /// Alignment, in bytes, of the data owned by the pool.
+    static constexpr std::size_t Alignment = 64;
+
+    /// Memory for data produced by the caller, which the pool can adopt as is.
+    using Buffer = std::vector<uint8_t, armnnUtils::AlignedAllocator<uint8_t, Alignment>>;
+
+    /// Tensors smaller than this stay on the heap when a storage directory is set, see SetStorageDirectory().
+    static constexpr std::size_t MinFileBackedSize = 64 * 1024;
+
+    /// The storage file is mapped in chunks of this size, which the tensors stored in it share (a tensor larger
+    /// than that gets a chunk of its own).
+    static constexpr std::size_t StorageChunkSize = 64 * 1024 * 1024;
+
+    ConstantPool() = default;
+    ~ConstantPool();
+
+    ConstantPool(const ConstantPool&) = delete;
+    ConstantPool& operator=(const ConstantPool&) = delete;
+
+    /// Copies the data of the tensor into the pool, unless identical data is there already.
+    /// Tensors which lie in a region registered with AddExternalRegion() are referenced instead of copied.
+    /// @return A tensor with the same TensorInfo, pointing at the pooled data.
+    ConstTensor Add(const ConstTensor& tensor);
+
+    /// Takes ownership of data produced by the caller (e.g. transformed weights), without copying it unless it
+    /// belongs in the storage file (see SetStorageDirectory()). The data must hold tensorInfo.GetNumBytes() bytes.
+    ConstTensor Add(const TensorInfo& tensorInfo, Buffer&& data);
+
+    /// Stores data which is not in memory yet. Each file is mapped once, whole, the first time data is taken from it.
+    /// Data at an offset multiple of Alignment is used in place, neither copied nor hashed (like an external
+    /// region); any other data is copied into the pool and deduplicated.
+    /// Throws FileNotFoundException if the file cannot be opened or mapped, InvalidArgumentException if it is too
+    /// short for the tensor.
+    ConstTensor Add(const TensorInfo& tensorInfo, const WeightSource& source);
+
+    /// Allocates zero-initialised storage owned by the pool, for the caller to fill in before handing out the
+    /// tensor. Not deduplicated: the contents are unknown at this point.
+    std::pair<ConstTensor, void*> Allocate(const TensorInfo& tensorInfo);
+
+    /// Declares a block of memory that outlives the pool (e.g. a mapped network file). Tensors in it are used in
+    /// place: they are neither copied nor hashed, so that loading stays free of any pass over the data.
+    void AddExternalRegion(const void* data, std::size_t size);
+
+    /// Keeps the data stored from now on in an unlinked temporary file of the directory, mapped shared, rather than
+    /// on the heap: the pages can be written out and dropped under memory pressure instead of staying resident.
+    /// The file grows as data is stored, through a few large mappings (see StorageChunkSize) rather than one per
+    /// tensor. Data stored before the call stays where it is. Throws FileNotFoundException if the file cannot be
+    /// created.
+    void SetStorageDirectory(const std::string& directory);
+
+    /// Number of distinct buffers held by the pool.
+    std::size_t GetNumEntries() const { return m_Entries.size(); }
+
+    /// Bytes of constant data held by the pool (excluding external regions): the sum of the three below.
+    std::size_t GetBytesStored() const { return m_BytesStored; }
+
+    /// Bytes held on the heap, which stay resident.
+    std::size_t GetBytesOnHeap() const { return m_BytesOnHeap; }
+
+    /// Bytes held in the storage file (see SetStorageDirectory()), and bytes used in place from weight files (see
+    /// Add(const TensorInfo&, const WeightSource&)): both can be paged out.
+    std::size_t GetBytesInStorageFile() const { return m_BytesInStorageFile; }
+    std::size_t GetBytesMapped() const { return m_BytesMapped; }
+
+    /// Bytes that did not need storing because identical data was already in the pool.
+    std::size_t GetBytesSaved() const { return m_BytesSaved; }
+
+    /// Hash of the contents of a buffer returned by the pool (0 for external and Allocate()d data).
+    uint64_t GetHash(const void* data) const;
+
+private:
+    /// A mapping of (part of) a file, unmapped on destruction.
+    struct Mapping
+    {
+        Mapping(void* address, std::size_t size) : m_Address(address), m_Size(size) {}
+        ~Mapping();
+
+        Mapping(const Mapping&) = delete;
+        Mapping& operator=(const Mapping&) = delete;
+
+        void*       m_Address;
+        std::size_t m_Size;
+    };
+
+    /// A file the data of tensors are taken from, mapped whole (unless it is empty).
+    struct SourceFile
+    {
+        std::unique_ptr<Mapping> m_Mapping;
+        uint64_t                 m_Size = 0;
+    };
+
+    /// Memory holding the data of an entry: a heap block, an adopted buffer, a range of the storage file, or part
+    /// of a source file. The mappings are owned by the pool, not by the entries.
+    struct Storage
+    {
+        uint8_t*                   m_Data = nullptr;
+        std::unique_ptr<uint8_t[]> m_Heap;
+        Buffer                     m_Buffer;
+        uint64_t                   m_FileOffset = 0; ///< Range of the storage file taken, if m_FileSize is not 0.
+        uint64_t                   m_FileSize = 0;
+        bool                       m_Zeroed = false;
+    };
+
+    struct Entry
+    {
+        const void* m_Data;
+        std::size_t m_Size;
+        uint64_t    m_Hash;
+        Storage     m_Storage;
+    };
+
+    bool IsExternal(const void* data, std::size_t size) const;
+
+    /// Opens and maps the file on first use.
+    const SourceFile& GetSourceFile(const std::string& path);
+
+    /// Returns the pooled copy of data, if any.
+    const Entry* Find(const void* data, std::size_t size, uint64_t hash) const;
+
+    /// Returns storage of the given size aligned to Alignment, in the storage file if there is one and the size is
+    /// at least MinFileBackedSize, on the heap otherwise.
+    Storage AllocateStorage(std::size_t size);
+
+    /// Takes the given size from the last chunk of the storage file, or from a new one if it doesn't fit.
+    Storage AllocateFileStorage(std::size_t size);
+
+    /// Gives back storage which ended up unused, shrinking the storage file if it was the last allocation.
+    void DiscardStorage(Storage storage);
+
+    /// Returns the pooled copy of the data just written to the storage if there is one (discarding the storage),
+    /// or adds the storage as a new entry.
+    const Entry& AddOrDiscard(Storage storage, std::size_t size);
+
+    Entry& AddEntry(const void* data, std::size_t size, uint64_t hash, Storage storage);
+
+    std::vector<std::unique_ptr<Entry>>         m_Entries;
+    std::unordered_multimap<uint64_t, Entry*>   m_EntriesByHash;
+    std::unordered_map<const void*, Entry*>     m_EntriesByData;
+    std::vector<std::pair<const uint8_t*, std::size_t>> m_ExternalRegions;
+    std::unordered_map<std::string, SourceFile> m_SourceFiles;
+
+    int      m_StorageFile = -1;
+    uint64_t m_StorageFileSize = 0;
+
+    /// The mappings of the storage files. The chunk being filled, if any, is the last one and starts at
+    /// m_ChunkFileOffset in the current file; the file ends within it.
+    std::vector<std::unique_ptr<Mapping>> m_StorageChunks;
+    Mapping*                              m_Chunk = nullptr;
+    uint64_t                              m_ChunkFileOffset = 0;
+
+    std::size_t m_BytesStored        = 0;
+    std::size_t m_BytesOnHeap        = 0;
+    std::size_t m_BytesInStorageFile = 0;
+    std::size_t m_BytesMapped        = 0;
+    std::size_t m_BytesSaved         = 0;
+};
+
+} // namespace armnn
@@ -0,0 +1,57 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "DeadLayerElimination.hpp"
+
+#include "Graph.hpp"
+
+#include <unordered_set>
+#include <vector>
+
+namespace armnn
+{
+
+unsigned int EliminateDeadLayers(Graph& graph)
+{
+    // Walking the topological order backwards, the consumers of a layer are all seen before it.
+    const Graph::LayerRange order = graph.TopologicalSort();
+    std::vector<Layer*> layers(order.begin(), order.end());
+
+    std::unordered_set<const Layer*> liveLayers;
+    std::vector<Layer*> deadLayers;
+    for (auto it = layers.rbegin(); it != layers.rend(); ++it)
+    {
+        Layer* const layer = *it;
+        bool isLive = layer->GetType() == LayerType::Output || layer->GetType() == LayerType::Input;
+        for (auto&& outputSlot : layer->GetOutputSlots())
+        {
+            for (const InputSlot* consumer : outputSlot.GetConnections())
+            {
+                isLive = isLive || liveLayers.count(&consumer->GetOwningLayer()) != 0;
+            }
+        }
+
+        if (isLive)
+        {
+            liveLayers.insert(layer);
+        }
+        else
+        {
+            deadLayers.push_back(layer);
+        }
+    }
+
+    for (Layer* layer : deadLayers)
+    {
+        graph.EraseLayer(layer);
+    }
+
+    if (!deadLayers.empty())
+    {
+        graph.SetMemoryPlan(MemoryPlan());
+    }
+    return static_cast<unsigned int>(deadLayers.size());
+}
+
+} // namespace armnn
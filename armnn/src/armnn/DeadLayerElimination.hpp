@@ -0,0 +1,20 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+namespace armnn
+{
+
+class Graph;
+
+/// Removes the layers whose outputs cannot reach any Output layer, e.g. the parts of an imported training graph
+/// which only compute losses or metrics. Input layers are kept even when nothing reads them, as they are part of
+/// the interface of the network. Unlike Layer::IsOutputUnconnected(), which only spots the layers whose outputs
+/// are left unconnected, whole chains are removed: a layer is dead when all its consumers are.
+/// The memory plan of the graph is invalidated if any layer is removed.
+/// @return The number of layers removed.
+unsigned int EliminateDeadLayers(Graph& graph);
+
+} // namespace armnn
@@ -0,0 +1,229 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+
+namespace armnn
+{
+
+/// Lists the fields of each descriptor to the archive: the DescriptorWriter and DescriptorReader of the serializer,
+/// or a DescriptorHasher. The order of the fields is their serialized order, so it is part of the file format.
+/// Descriptors are taken by non-const reference so a single list serves both directions, writers never modify them.
+/// @{
+template <typename Archive>
+void VisitDescriptor(Archive& archive, ActivationDescriptor& descriptor)
+{
+    archive(descriptor.m_Function);
+    archive(descriptor.m_A);
+    archive(descriptor.m_B);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, PermuteDescriptor& descriptor)
+{
+    archive(descriptor.m_DimMappings);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, SoftmaxDescriptor& descriptor)
+{
+    archive(descriptor.m_Beta);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, OriginsDescriptor& descriptor)
+{
+    archive(descriptor);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, ViewsDescriptor& descriptor)
+{
+    archive(descriptor);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, Pooling2dDescriptor& descriptor)
+{
+    archive(descriptor.m_PoolType);
+    archive(descriptor.m_PadLeft);
+    archive(descriptor.m_PadRight);
+    archive(descriptor.m_PadTop);
+    archive(descriptor.m_PadBottom);
+    archive(descriptor.m_PoolWidth);
+    archive(descriptor.m_PoolHeight);
+    archive(descriptor.m_StrideX);
+    archive(descriptor.m_StrideY);
+    archive(descriptor.m_OutputShapeRounding);
+    archive(descriptor.m_PaddingMethod);
+    archive(descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, FullyConnectedDescriptor& descriptor)
+{
+    archive(descriptor.m_BiasEnabled);
+    archive(descriptor.m_TransposeWeightMatrix);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, Convolution2dDescriptor& descriptor)
+{
+    archive(descriptor.m_PadLeft);
+    archive(descriptor.m_PadRight);
+    archive(descriptor.m_PadTop);
+    archive(descriptor.m_PadBottom);
+    archive(descriptor.m_StrideX);
+    archive(descriptor.m_StrideY);
+    archive(descriptor.m_BiasEnabled);
+    archive(descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, DepthwiseConvolution2dDescriptor& descriptor)
+{
+    archive(descriptor.m_PadLeft);
+    archive(descriptor.m_PadRight);
+    archive(descriptor.m_PadTop);
+    archive(descriptor.m_PadBottom);
+    archive(descriptor.m_StrideX);
+    archive(descriptor.m_StrideY);
+    archive(descriptor.m_BiasEnabled);
+    archive(descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, DetectionPostProcessDescriptor& descriptor)
+{
+    archive(descriptor.m_MaxDetections);
+    archive(descriptor.m_MaxClassesPerDetection);
+    archive(descriptor.m_DetectionsPerClass);
+    archive(descriptor.m_NmsScoreThreshold);
+    archive(descriptor.m_NmsIouThreshold);
+    archive(descriptor.m_NumClasses);
+    archive(descriptor.m_UseRegularNms);
+    archive(descriptor.m_ScaleX);
+    archive(descriptor.m_ScaleY);
+    archive(descriptor.m_ScaleW);
+    archive(descriptor.m_ScaleH);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, NormalizationDescriptor& descriptor)
+{
+    archive(descriptor.m_NormChannelType);
+    archive(descriptor.m_NormMethodType);
+    archive(descriptor.m_NormSize);
+    archive(descriptor.m_Alpha);
+    archive(descriptor.m_Beta);
+    archive(descriptor.m_K);
+    archive(descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, L2NormalizationDescriptor& descriptor)
+{
+    archive(descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, BatchNormalizationDescriptor& descriptor)
+{
+    archive(descriptor.m_Eps);
+    archive(descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, BatchToSpaceNdDescriptor& descriptor)
+{
+    archive(descriptor.m_BlockShape);
+    archive(descriptor.m_Crops);
+    archive(descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, FakeQuantizationDescriptor& descriptor)
+{
+    archive(descriptor.m_Min);
+    archive(descriptor.m_Max);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, ResizeBilinearDescriptor& descriptor)
+{
+    archive(descriptor.m_TargetWidth);
+    archive(descriptor.m_TargetHeight);
+    archive(descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, ReshapeDescriptor& descriptor)
+{
+    archive(descriptor.m_TargetShape);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, SpaceToBatchNdDescriptor& descriptor)
+{
+    archive(descriptor.m_BlockShape);
+    archive(descriptor.m_PadList);
+    archive(descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, LstmDescriptor& descriptor)
+{
+    archive(descriptor.m_ActivationFunc);
+    archive(descriptor.m_ClippingThresCell);
+    archive(descriptor.m_ClippingThresProj);
+    archive(descriptor.m_CifgEnabled);
+    archive(descriptor.m_PeepholeEnabled);
+    archive(descriptor.m_ProjectionEnabled);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, MeanDescriptor& descriptor)
+{
+    archive(descriptor.m_Axis);
+    archive(descriptor.m_KeepDims);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, PadDescriptor& descriptor)
+{
+    archive(descriptor.m_PadList);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, StridedSliceDescriptor& descriptor)
+{
+    archive(descriptor.m_Begin);
+    archive(descriptor.m_End);
+    archive(descriptor.m_Stride);
+    archive(descriptor.m_BeginMask);
+    archive(descriptor.m_EndMask);
+    archive(descriptor.m_ShrinkAxisMask);
+    archive(descriptor.m_EllipsisMask);
+    archive(descriptor.m_NewAxisMask);
+    archive(descriptor.m_DataLayout);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, DebugDescriptor& descriptor)
+{
+    archive(descriptor.m_LayerName);
+    archive(descriptor.m_SlotIndex);
+}
+
+template <typename Archive>
+void VisitDescriptor(Archive& archive, PreCompiledDescriptor& descriptor)
+{
+    archive(descriptor.m_NumInputSlots);
+    archive(descriptor.m_NumOutputSlots);
+}
+/// @}
+
+} // namespace armnn
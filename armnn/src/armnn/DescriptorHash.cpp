@@ -0,0 +1,65 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "DescriptorHash.hpp"
+
+namespace armnn
+{
+
+void DescriptorHasher::operator()(const std::string& value)
+{
+    m_Hash = armnnUtils::Hash64(value.data(), value.size(), armnnUtils::HashCombine(m_Hash, value.size()));
+}
+
+void DescriptorHasher::operator()(const TensorShape& value)
+{
+    Mix(value.GetNumDimensions());
+    for (unsigned int i = 0; i < value.GetNumDimensions(); ++i)
+    {
+        Mix(value[i]);
+    }
+}
+
+void DescriptorHasher::operator()(const PermutationVector& value)
+{
+    Mix(value.GetSize());
+    for (PermutationVector::SizeType i = 0; i < value.GetSize(); ++i)
+    {
+        Mix(value[i]);
+    }
+}
+
+void DescriptorHasher::operator()(const OriginsDescriptor& value)
+{
+    Mix(value.GetNumViews());
+    Mix(value.GetNumDimensions());
+    Mix(value.GetConcatAxis());
+    for (uint32_t view = 0; view < value.GetNumViews(); ++view)
+    {
+        m_Hash = armnnUtils::Hash64(value.GetViewOrigin(view), value.GetNumDimensions() * sizeof(uint32_t), m_Hash);
+    }
+}
+
+void DescriptorHasher::operator()(const ViewsDescriptor& value)
+{
+    Mix(value.GetNumViews());
+    Mix(value.GetNumDimensions());
+    for (uint32_t view = 0; view < value.GetNumViews(); ++view)
+    {
+        m_Hash = armnnUtils::Hash64(value.GetViewOrigin(view), value.GetNumDimensions() * sizeof(uint32_t), m_Hash);
+        m_Hash = armnnUtils::Hash64(value.GetViewSizes(view), value.GetNumDimensions() * sizeof(uint32_t), m_Hash);
+    }
+}
+
+uint64_t HashTensorInfo(const TensorInfo& tensorInfo, uint64_t seed)
+{
+    DescriptorHasher hasher(seed);
+    hasher(tensorInfo.GetShape());
+    hasher(tensorInfo.GetDataType());
+    hasher(tensorInfo.GetQuantizationScale());
+    hasher(tensorInfo.GetQuantizationOffset());
+    return hasher.GetHash();
+}
+
+} // namespace armnn
@@ -0,0 +1,98 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "DescriptorFields.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <Hash.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+/// Hashes the fields of descriptors listed by VisitDescriptor(). Descriptors which compare equal hash to the same
+/// value, and as the fields are hashed by value the result is stable across runs and processes.
+class DescriptorHasher
+{
+public:
+    explicit DescriptorHasher(uint64_t seed = 0)
+    : m_Hash(seed)
+    {
+    }
+
+    uint64_t GetHash() const { return m_Hash; }
+
+    void operator()(uint32_t value) { Mix(value); }
+    void operator()(int32_t value) { Mix(static_cast<uint32_t>(value)); }
+    void operator()(bool value) { Mix(value ? 1u : 0u); }
+
+    void operator()(float value)
+    {
+        // +0 and -0 compare equal, so they must hash alike.
+        uint32_t bits = 0;
+        if (value != 0.0f)
+        {
+            std::memcpy(&bits, &value, sizeof(bits));
+        }
+        Mix(bits);
+    }
+
+    template <typename Enum>
+    typename std::enable_if<std::is_enum<Enum>::value>::type operator()(Enum value)
+    {
+        Mix(static_cast<uint64_t>(value));
+    }
+
+    template <typename T>
+    void operator()(const std::vector<T>& values)
+    {
+        Mix(values.size());
+        for (const T& value : values)
+        {
+            (*this)(value);
+        }
+    }
+
+    template <typename T, typename U>
+    void operator()(const std::pair<T, U>& value)
+    {
+        (*this)(value.first);
+        (*this)(value.second);
+    }
+
+    void operator()(const std::string& value);
+    void operator()(const TensorShape& value);
+    void operator()(const PermutationVector& value);
+    void operator()(const OriginsDescriptor& value);
+    void operator()(const ViewsDescriptor& value);
+
+private:
+    void Mix(uint64_t value) { m_Hash = armnnUtils::HashCombine(m_Hash, value); }
+
+    uint64_t m_Hash;
+};
+
+/// Hash of the contents of a descriptor, consistent with its operator==.
+template <typename Descriptor>
+uint64_t HashDescriptor(const Descriptor& descriptor, uint64_t seed = 0)
+{
+    DescriptorHasher hasher(seed);
+    VisitDescriptor(hasher, const_cast<Descriptor&>(descriptor));
+    return hasher.GetHash();
+}
+
+/// Hash of a TensorInfo (shape, data type and quantization parameters), consistent with its operator==.
+uint64_t HashTensorInfo(const TensorInfo& tensorInfo, uint64_t seed = 0);
+
+} // namespace armnn
@@ -0,0 +1,258 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "Fp16Conversion.hpp"
+
+#include "ConstantPool.hpp"
+#include "Graph.hpp"
+#include "LayerVisitor.hpp"
+#include "LayersFwd.hpp"
+#include "WeightPacking.hpp"
+
+#include <FloatingPointConverter.hpp>
+
+#include <boost/cast.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Collects the constant tensors of the layer it visits, in place (empty ones included).
+struct ConstantCollector
+{
+    void Visit(BatchNormalizationLayer& layer)
+    {
+        m_Constants = { &layer.m_Mean, &layer.m_Variance, &layer.m_Beta, &layer.m_Gamma };
+    }
+
+    void Visit(ConstantLayer& layer) { m_Constants = { &layer.m_LayerOutput }; }
+    void Visit(Convolution2dLayer& layer) { m_Constants = { &layer.m_Weight, &layer.m_Bias }; }
+    void Visit(DepthwiseConvolution2dLayer& layer) { m_Constants = { &layer.m_Weight, &layer.m_Bias }; }
+    void Visit(FullyConnectedLayer& layer) { m_Constants = { &layer.m_Weight, &layer.m_Bias }; }
+
+    std::vector<ConstTensor*> m_Constants;
+};
+
+/// Drops the copies of the weights transformed for the kernels, which no longer match the converted weights.
+struct TransformedWeightsDropper
+{
+    void Visit(Convolution2dLayer& layer)
+    {
+        layer.m_WinogradWeight = ConstTensor();
+        layer.m_PackedWeight = ConstTensor();
+        layer.m_PackedWeightLayout = PackedWeightLayout::None;
+    }
+
+    void Visit(FullyConnectedLayer& layer)
+    {
+        layer.m_PackedWeight = ConstTensor();
+        layer.m_PackedWeightLayout = PackedWeightLayout::None;
+    }
+};
+
+/// The constant tensors of the layer, in place (empty ones included).
+std::vector<ConstTensor*> GetConstants(Layer& layer)
+{
+    ConstantCollector collector;
+    VisitLayer(layer, collector);
+    return std::move(collector.m_Constants);
+}
+
+ConstTensor ConvertConstant(ConstantPool& constantPool, const ConstTensor& tensor)
+{
+    const unsigned int numValues = tensor.GetNumElements();
+    ConstantPool::Buffer data(numValues * sizeof(uint16_t));
+    FloatingPointConverter::ConvertFloat32To16(static_cast<const float*>(tensor.GetMemoryArea()), numValues,
+                                               data.data());
+
+    TensorInfo info = tensor.GetInfo();
+    info.SetDataType(DataType::Float16);
+    return constantPool.Add(info, std::move(data));
+}
+
+void ConvertLayer(Layer& layer, ConstantPool& constantPool)
+{
+    for (auto it = layer.BeginOutputSlots(); it != layer.EndOutputSlots(); ++it)
+    {
+        TensorInfo info = it->GetTensorInfo();
+        info.SetDataType(DataType::Float16);
+        it->SetTensorInfo(info);
+    }
+
+    for (ConstTensor* constant : GetConstants(layer))
+    {
+        if (constant->GetMemoryArea() != nullptr)
+        {
+            *constant = ConvertConstant(constantPool, *constant);
+        }
+    }
+
+    TransformedWeightsDropper dropper;
+    VisitLayer(layer, dropper);
+}
+
+/// Adds a conversion layer of type LayerT reading source and feeding the consumers instead of it, its output
+/// having the TensorInfo of source with the given data type.
+template <typename LayerT>
+void InsertConversion(Graph& graph,
+                      OutputSlot& source,
+                      const std::vector<InputSlot*>& consumers,
+                      DataType dataType,
+                      const char* suffix)
+{
+    const std::string sourceName = source.GetOwningLayer().GetNameStr();
+    const std::string name = (sourceName.empty() ? "" : sourceName + "/") + suffix;
+    LayerT* const conversion = graph.AddLayer<LayerT>(name.c_str());
+
+    TensorInfo info = source.GetTensorInfo();
+    info.SetDataType(dataType);
+    conversion->GetOutputSlot(0).SetTensorInfo(info);
+
+    source.Connect(conversion->GetInputSlot(0));
+    for (InputSlot* consumer : consumers)
+    {
+        source.Disconnect(*consumer);
+        conversion->GetOutputSlot(0).Connect(*consumer);
+    }
+}
+
+} // namespace
+
+bool IsConvertibleToFp16(const Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Activation:
+        case LayerType::BatchNormalization:
+        case LayerType::Constant:
+        case LayerType::Convolution2d:
+        case LayerType::DepthwiseConvolution2d:
+        case LayerType::FullyConnected:
+        case LayerType::Normalization:
+        case LayerType::Permute:
+        case LayerType::Pooling2d:
+        case LayerType::Softmax:
+            break;
+        default:
+            return false;
+    }
+
+    for (auto&& inputSlot : layer.GetInputSlots())
+    {
+        const OutputSlot* const source = inputSlot.GetConnectedOutputSlot();
+        if (source == nullptr || !source->IsTensorInfoSet() ||
+            source->GetTensorInfo().GetDataType() != DataType::Float32)
+        {
+            return false;
+        }
+    }
+    for (auto&& outputSlot : layer.GetOutputSlots())
+    {
+        if (!outputSlot.IsTensorInfoSet() || outputSlot.GetTensorInfo().GetDataType() != DataType::Float32)
+        {
+            return false;
+        }
+    }
+    for (const ConstTensor* constant : GetConstants(const_cast<Layer&>(layer)))
+    {
+        if (constant->GetMemoryArea() != nullptr && constant->GetInfo().GetDataType() != DataType::Float32)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+unsigned int ConvertToFp16(Graph& graph)
+{
+    std::vector<Layer*> converted;
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        if (IsConvertibleToFp16(*layer))
+        {
+            converted.push_back(layer);
+        }
+    }
+    if (converted.empty())
+    {
+        return 0;
+    }
+
+    // The boundaries of the converted layers are found before the graph changes: the Float32 tensors read by
+    // converted layers, with those layers, and the outputs of converted layers read by others, with those others.
+    const std::unordered_set<const Layer*> convertedLayers(converted.begin(), converted.end());
+    auto isLayerConverted = [&convertedLayers](const Layer& layer)
+    {
+        return convertedLayers.count(&layer) != 0;
+    };
+
+    std::vector<std::pair<OutputSlot*, std::vector<InputSlot*>>> float32Sources;
+    std::unordered_map<const OutputSlot*, std::size_t> float32SourceIndices;
+    std::vector<std::pair<OutputSlot*, std::vector<InputSlot*>>> float16Outputs;
+
+    for (Layer* layer : converted)
+    {
+        for (auto it = layer->BeginInputSlots(); it != layer->EndInputSlots(); ++it)
+        {
+            OutputSlot* const source = it->GetConnectedOutputSlot();
+            if (isLayerConverted(source->GetOwningLayer()))
+            {
+                continue;
+            }
+            auto inserted = float32SourceIndices.emplace(source, float32Sources.size());
+            if (inserted.second)
+            {
+                float32Sources.emplace_back(source, std::vector<InputSlot*>());
+            }
+            float32Sources[inserted.first->second].second.push_back(&*it);
+        }
+
+        for (auto it = layer->BeginOutputSlots(); it != layer->EndOutputSlots(); ++it)
+        {
+            std::vector<InputSlot*> float32Consumers;
+            for (InputSlot* consumer : it->GetConnections())
+            {
+                if (!isLayerConverted(consumer->GetOwningLayer()))
+                {
+                    float32Consumers.push_back(consumer);
+                }
+            }
+            if (!float32Consumers.empty())
+            {
+                float16Outputs.emplace_back(&*it, std::move(float32Consumers));
+            }
+        }
+    }
+
+    for (auto&& output : float16Outputs)
+    {
+        InsertConversion<ConvertFp16ToFp32Layer>(graph, *output.first, output.second, DataType::Float32,
+                                                 "convert_to_fp32");
+    }
+    for (Layer* layer : converted)
+    {
+        UnpackWeight(graph, *layer);
+        ConvertLayer(*layer, graph.GetConstantPool());
+    }
+    for (auto&& source : float32Sources)
+    {
+        InsertConversion<ConvertFp32ToFp16Layer>(graph, *source.first, source.second, DataType::Float16,
+                                                 "convert_to_fp16");
+    }
+
+    graph.SetMemoryPlan(MemoryPlan());
+    return static_cast<unsigned int>(converted.size());
+}
+
+} // namespace armnn
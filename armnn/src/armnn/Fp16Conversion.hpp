@@ -0,0 +1,31 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+namespace armnn
+{
+
+class Graph;
+class Layer;
+
+/// Whether ConvertToFp16() converts the layer: a layer computing on Float32 tensors (not an input, output or
+/// conversion layer) whose tensors and constants are all Float32. The TensorInfos of its outputs must be set.
+bool IsConvertibleToFp16(const Layer& layer);
+
+/// Converts the graph to Float16 for the devices computing in half precision, halving the size of its weights
+/// and of the tensors its layers exchange:
+/// - The layers for which IsConvertibleToFp16() holds get Float16 outputs and their constants (weights, biases,
+///   batch normalization parameters and the tensors of constant layers) are converted to Float16, rounding to the
+///   nearest. The constants precomputed for Float32 kernels (Winograd and packed weights) are dropped.
+/// - ConvertFp32ToFp16 and ConvertFp16ToFp32 layers are only inserted where the converted layers meet the others:
+///   after the Float32 tensors they read (e.g. the inputs of the network), one per tensor whatever its number of
+///   consumers, and before the layers reading their outputs which were not converted (e.g. the outputs of the
+///   network). The inputs and outputs of the network therefore stay Float32.
+/// The memory plan of the graph is invalidated, the tensors being smaller. Fusions and layout changes rely on
+/// Float32 constants, so FuseLayers() and OptimizeLayout() are meant to run before.
+/// Returns the number of layers converted.
+unsigned int ConvertToFp16(Graph& graph);
+
+} // namespace armnn
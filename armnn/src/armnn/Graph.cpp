@@ -0,0 +1,430 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "Graph.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Below this many layers per thread, starting the threads costs more than inferring the shapes.
+constexpr std::size_t MinLayersPerThread = 64;
+
+} // namespace
+
+template <typename GetNeighbours, typename IsInRange>
+bool Graph::CollectReachable(Layer& start,
+                             const Layer& target,
+                             GetNeighbours getNeighbours,
+                             IsInRange isInRange,
+                             std::vector<Layer*>& reached)
+{
+    std::vector<Layer*> stack = { &start };
+    start.m_Visiting = true;
+    reached.push_back(&start);
+
+    std::vector<Layer*> neighbours;
+    while (!stack.empty())
+    {
+        Layer* const layer = stack.back();
+        stack.pop_back();
+
+        neighbours.clear();
+        getNeighbours(*layer, neighbours);
+
+        for (Layer* neighbour : neighbours)
+        {
+            if (neighbour == &target)
+            {
+                return false;
+            }
+            if (!neighbour->m_Visiting && isInRange(*neighbour))
+            {
+                neighbour->m_Visiting = true;
+                reached.push_back(neighbour);
+                stack.push_back(neighbour);
+            }
+        }
+    }
+    return true;
+}
+
+Graph::~Graph()
+{
+    // The arena only gives the memory back, the layers need to be destroyed explicitly.
+    for (Layer* layer : m_Layers)
+    {
+        if (layer != nullptr)
+        {
+            layer->~Layer();
+        }
+    }
+}
+
+void Graph::EraseLayer(Layer* layer)
+{
+    BOOST_ASSERT(layer != nullptr);
+    BOOST_ASSERT_MSG(layer->m_GraphIndex < m_Layers.size() && m_Layers[layer->m_GraphIndex] == layer,
+                     "Layer does not belong to this graph");
+
+    m_Layers[layer->m_GraphIndex] = nullptr;
+    m_TopologicalOrder[layer->m_TopologicalIndex] = nullptr;
+    ++m_NumErased;
+    RemoveFromNameIndex(*layer);
+
+    layer->~Layer();
+
+    // Keeps iteration linear in the number of live layers.
+    if (m_NumErased > m_Layers.size() / 2)
+    {
+        Compact();
+    }
+}
+
+Layer* Graph::FindLayer(const std::string& name) const
+{
+    const StringPool::StringId id = m_StringPool.Find(name);
+    return id < m_LayersByName.size() ? m_LayersByName[id].m_First : nullptr;
+}
+
+std::vector<Layer*> Graph::FindLayers(const std::string& name) const
+{
+    std::vector<Layer*> layers;
+    for (Layer* layer = FindLayer(name); layer != nullptr; layer = layer->m_NextWithName)
+    {
+        layers.push_back(layer);
+    }
+    return layers;
+}
+
+void Graph::AddToNameIndex(Layer& layer)
+{
+    layer.m_NameId = m_StringPool.Intern(layer.m_ConstructorName);
+    layer.m_ConstructorName = nullptr;
+    if (m_StringPool.Get(layer.m_NameId).empty())
+    {
+        // Unnamed layers are not indexed: they would all be linked under the same name.
+        return;
+    }
+
+    if (layer.m_NameId >= m_LayersByName.size())
+    {
+        m_LayersByName.resize(m_StringPool.GetNumStrings());
+    }
+
+    NamedLayers& named = m_LayersByName[layer.m_NameId];
+    if (named.m_Last != nullptr)
+    {
+        named.m_Last->m_NextWithName = &layer;
+        layer.m_PreviousWithName = named.m_Last;
+    }
+    else
+    {
+        named.m_First = &layer;
+    }
+    named.m_Last = &layer;
+}
+
+void Graph::RemoveFromNameIndex(Layer& layer)
+{
+    if (m_StringPool.Get(layer.m_NameId).empty())
+    {
+        return;
+    }
+
+    NamedLayers& named = m_LayersByName[layer.m_NameId];
+
+    if (layer.m_PreviousWithName != nullptr)
+    {
+        layer.m_PreviousWithName->m_NextWithName = layer.m_NextWithName;
+    }
+    else
+    {
+        named.m_First = layer.m_NextWithName;
+    }
+
+    if (layer.m_NextWithName != nullptr)
+    {
+        layer.m_NextWithName->m_PreviousWithName = layer.m_PreviousWithName;
+    }
+    else
+    {
+        named.m_Last = layer.m_PreviousWithName;
+    }
+}
+
+void Graph::AddEdge(Layer& source, Layer& destination)
+{
+    if (source.m_Graph != this || destination.m_Graph != this)
+    {
+        throw InvalidArgumentException("Cannot connect layers that belong to different graphs");
+    }
+
+    const std::size_t lowerBound = destination.m_TopologicalIndex;
+    const std::size_t upperBound = source.m_TopologicalIndex;
+
+    if (upperBound < lowerBound)
+    {
+        // The new edge agrees with the current order.
+        return;
+    }
+
+    // Only the layers placed in [lowerBound, upperBound] can be out of order with the new edge: the ones reachable
+    // from the destination need to move after the ones the source is reachable from. Collecting them both and
+    // handing them back the same positions in that order keeps the order valid for all the other edges.
+    std::vector<Layer*> forward;
+    std::vector<Layer*> backward;
+
+    const bool isAcyclic =
+        (&source != &destination) &&
+        CollectReachable(destination, source,
+            [](const Layer& layer, std::vector<Layer*>& successors)
+            {
+                for (auto&& outputSlot : layer.GetOutputSlots())
+                {
+                    for (const InputSlot* connection : outputSlot.GetConnections())
+                    {
+                        successors.push_back(&connection->GetOwningLayer());
+                    }
+                }
+            },
+            [upperBound](const Layer& layer) { return layer.m_TopologicalIndex < upperBound; },
+            forward) &&
+        CollectReachable(source, destination,
+            [](const Layer& layer, std::vector<Layer*>& predecessors)
+            {
+                for (auto&& inputSlot : layer.GetInputSlots())
+                {
+                    const OutputSlot* const connection = inputSlot.GetConnectedOutputSlot();
+                    if (connection != nullptr)
+                    {
+                        predecessors.push_back(&connection->GetOwningLayer());
+                    }
+                }
+            },
+            [lowerBound](const Layer& layer) { return layer.m_TopologicalIndex > lowerBound; },
+            backward);
+
+    for (Layer* layer : forward)
+    {
+        layer->m_Visiting = false;
+    }
+    for (Layer* layer : backward)
+    {
+        layer->m_Visiting = false;
+    }
+
+    if (!isAcyclic)
+    {
+        throw GraphValidationException(
+            std::string("Connecting layer '") + source.GetName() + "' to layer '" + destination.GetName() +
+            "' would create a cycle");
+    }
+
+    auto topologicalIndexLess = [](const Layer* lhs, const Layer* rhs)
+    {
+        return lhs->m_TopologicalIndex < rhs->m_TopologicalIndex;
+    };
+    std::sort(backward.begin(), backward.end(), topologicalIndexLess);
+    std::sort(forward.begin(), forward.end(), topologicalIndexLess);
+
+    std::vector<std::size_t> positions;
+    positions.reserve(backward.size() + forward.size());
+    for (const Layer* layer : backward)
+    {
+        positions.push_back(layer->m_TopologicalIndex);
+    }
+    for (const Layer* layer : forward)
+    {
+        positions.push_back(layer->m_TopologicalIndex);
+    }
+    std::sort(positions.begin(), positions.end());
+
+    auto position = positions.begin();
+    for (auto* layers : { &backward, &forward })
+    {
+        for (Layer* layer : *layers)
+        {
+            layer->m_TopologicalIndex = *position;
+            m_TopologicalOrder[*position] = layer;
+            ++position;
+        }
+    }
+}
+
+void Graph::InferTensorInfos(unsigned int numThreads)
+{
+    // Levels are computed in a single pass over the topological order: a layer is one level above the deepest
+    // of the layers connected to its inputs, so all the layers of a level only depend on the previous levels.
+    std::vector<std::size_t> levels(m_TopologicalOrder.size(), 0);
+    std::size_t numLevels = 0;
+    for (const Layer* layer : TopologicalSort())
+    {
+        std::size_t level = 0;
+        for (auto&& inputSlot : layer->GetInputSlots())
+        {
+            const OutputSlot* const source = inputSlot.GetConnectedOutputSlot();
+            if (source != nullptr)
+            {
+                level = std::max(level, levels[source->GetOwningLayer().m_TopologicalIndex] + 1);
+            }
+        }
+        levels[layer->m_TopologicalIndex] = level;
+        numLevels = std::max(numLevels, level + 1);
+    }
+
+    // Sorts the layers by level (counting sort, stable so each level keeps the topological order).
+    std::vector<std::size_t> levelStarts(numLevels + 1, 0);
+    for (const Layer* layer : TopologicalSort())
+    {
+        ++levelStarts[levels[layer->m_TopologicalIndex] + 1];
+    }
+    std::partial_sum(levelStarts.begin(), levelStarts.end(), levelStarts.begin());
+
+    std::vector<Layer*> layersByLevel(GetNumLayers());
+    std::vector<std::size_t> nextInLevel(levelStarts.begin(), levelStarts.end() - 1);
+    std::size_t maxLevelSize = 0;
+    for (Layer* layer : TopologicalSort())
+    {
+        layersByLevel[nextInLevel[levels[layer->m_TopologicalIndex]]++] = layer;
+    }
+    for (std::size_t level = 0; level < numLevels; ++level)
+    {
+        maxLevelSize = std::max(maxLevelSize, levelStarts[level + 1] - levelStarts[level]);
+    }
+
+    if (numThreads == 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+        numThreads = static_cast<unsigned int>(
+            std::min<std::size_t>(numThreads, layersByLevel.size() / MinLayersPerThread));
+    }
+    numThreads = static_cast<unsigned int>(std::min<std::size_t>(numThreads, maxLevelSize));
+
+    if (numThreads <= 1)
+    {
+        for (Layer* layer : layersByLevel)
+        {
+            layer->InferTensorInfos();
+        }
+        return;
+    }
+
+    // Each level is split into a few tasks per thread, which threads take in level order from a shared counter.
+    // Before running a task, a thread waits for all the layers of the previous levels to be done: the task holding
+    // the lowest unfinished position never waits, so this cannot deadlock, and no thread ever waits on layers of
+    // its own level.
+    struct Task
+    {
+        std::size_t m_Begin;
+        std::size_t m_End;
+        std::size_t m_LevelBegin;
+    };
+    std::vector<Task> tasks;
+    for (std::size_t level = 0; level < numLevels; ++level)
+    {
+        const std::size_t levelSize = levelStarts[level + 1] - levelStarts[level];
+        const std::size_t taskSize  = std::max<std::size_t>(1, levelSize / (2 * numThreads));
+        for (std::size_t begin = levelStarts[level]; begin < levelStarts[level + 1]; begin += taskSize)
+        {
+            tasks.push_back({ begin, std::min(begin + taskSize, levelStarts[level + 1]), levelStarts[level] });
+        }
+    }
+
+    std::atomic<std::size_t> nextTask(0);
+    std::atomic<std::size_t> numDone(0);
+    std::atomic<bool> failed(false);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto worker = [&]()
+    {
+        for (std::size_t t = nextTask++; t < tasks.size(); t = nextTask++)
+        {
+            const Task& task = tasks[t];
+            while (numDone.load(std::memory_order_acquire) < task.m_LevelBegin)
+            {
+                std::this_thread::yield();
+            }
+
+            for (std::size_t i = task.m_Begin; i < task.m_End && !failed.load(std::memory_order_relaxed); ++i)
+            {
+                try
+                {
+                    layersByLevel[i]->InferTensorInfos();
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error)
+                    {
+                        error = std::current_exception();
+                    }
+                    failed = true;
+                }
+            }
+            numDone.fetch_add(task.m_End - task.m_Begin, std::memory_order_release);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (unsigned int i = 1; i < numThreads; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+void Graph::Compact()
+{
+    std::size_t numLayers = 0;
+    for (Layer* layer : m_Layers)
+    {
+        if (layer != nullptr)
+        {
+            layer->m_GraphIndex = numLayers;
+            m_Layers[numLayers++] = layer;
+        }
+    }
+    m_Layers.resize(numLayers);
+
+    // Relative order is preserved, so the topological order stays valid.
+    numLayers = 0;
+    for (Layer* layer : m_TopologicalOrder)
+    {
+        if (layer != nullptr)
+        {
+            layer->m_TopologicalIndex = numLayers;
+            m_TopologicalOrder[numLayers++] = layer;
+        }
+    }
+    m_TopologicalOrder.resize(numLayers);
+
+    m_NumErased = 0;
+}
+
+} // namespace armnn
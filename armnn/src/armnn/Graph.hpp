@@ -0,0 +1,232 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "ArenaAllocator.hpp"
+#include "ConstantPool.hpp"
+#include "Layer.hpp"
+#include "MemoryPlanner.hpp"
+#include "StringPool.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+/// Owns the layers of a network.
+/// Layers are constructed in place inside an arena, so the IConnectableLayer pointers given out by INetwork
+/// keep the same address for the lifetime of the graph. Adding a layer is O(1) and all the layer memory is
+/// returned in one go when the graph is destroyed.
+class Graph
+{
+public:
+    /// Forward iterator over a sequence of layer pointers which skips the entries of erased layers.
+    class Iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Layer*;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Layer* const*;
+        using reference         = Layer* const&;
+
+        Iterator(std::vector<Layer*>::const_iterator it, std::vector<Layer*>::const_iterator end)
+        : m_It(it)
+        , m_End(end)
+        {
+            SkipErased();
+        }
+
+        reference operator*() const { return *m_It; }
+        pointer operator->() const { return &*m_It; }
+
+        Iterator& operator++()
+        {
+            ++m_It;
+            SkipErased();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const { return m_It == other.m_It; }
+        bool operator!=(const Iterator& other) const { return m_It != other.m_It; }
+
+    private:
+        void SkipErased()
+        {
+            while (m_It != m_End && *m_It == nullptr)
+            {
+                ++m_It;
+            }
+        }
+
+        std::vector<Layer*>::const_iterator m_It;
+        std::vector<Layer*>::const_iterator m_End;
+    };
+
+    /// A sequence of layers, as stored by the graph.
+    class LayerRange
+    {
+    public:
+        explicit LayerRange(const std::vector<Layer*>& layers)
+        : m_Layers(layers)
+        {
+        }
+
+        Iterator begin() const { return Iterator(m_Layers.begin(), m_Layers.end()); }
+        Iterator end() const { return Iterator(m_Layers.end(), m_Layers.end()); }
+
+    private:
+        const std::vector<Layer*>& m_Layers;
+    };
+
+    Graph() = default;
+    ~Graph();
+
+    Graph(const Graph&) = delete;
+    Graph& operator=(const Graph&) = delete;
+
+    /// Adds a new layer, of type LayerT, to the graph constructed with the arguments passed.
+    template <typename LayerT, typename... Args>
+    LayerT* AddLayer(Args&&... args);
+
+    /// Deletes the layer. Its slots are disconnected from the rest of the graph.
+    /// The memory it used is only given back when the graph is destroyed.
+    void EraseLayer(Layer* layer);
+
+    /// Layers in the order they were added to the graph.
+    Iterator begin() const { return Iterator(m_Layers.begin(), m_Layers.end()); }
+    Iterator end() const { return Iterator(m_Layers.end(), m_Layers.end()); }
+
+    /// Layers in a topological order: every layer comes after the layers connected to its inputs.
+    /// The order is updated incrementally as connections are made (removing a connection never invalidates it),
+    /// so there is no sorting involved and iterating over the result is linear in the number of layers.
+    LayerRange TopologicalSort() const { return LayerRange(m_TopologicalOrder); }
+
+    std::size_t GetNumLayers() const { return m_Layers.size() - m_NumErased; }
+
+    /// Returns the layer with the given name, or nullptr if there is none. If several layers have that name,
+    /// returns the first of them added to the graph. Constant time: the graph indexes its layers by name. Unnamed
+    /// layers are not indexed, so are never found.
+    Layer* FindLayer(const std::string& name) const;
+
+    /// Returns the layers with the given name, in the order they were added to the graph.
+    std::vector<Layer*> FindLayers(const std::string& name) const;
+
+    /// Sets the TensorInfo of the outputs of every layer from those of its inputs (see Layer::InferTensorInfos()).
+    /// The outputs of the input layers must be set beforehand.
+    /// Layers are grouped by dependency level (the length of the longest path reaching them) and the layers of a
+    /// level are processed concurrently, by up to numThreads threads (0 picks a count suited to the graph).
+    void InferTensorInfos(unsigned int numThreads = 0);
+
+    const ArenaAllocator& GetAllocator() const { return m_Allocator; }
+
+    /// Placement of the intermediate tensors, set by PlanActivationMemory() (invalid until then).
+    const MemoryPlan& GetMemoryPlan() const { return m_MemoryPlan; }
+    void SetMemoryPlan(const MemoryPlan& plan) { m_MemoryPlan = plan; }
+
+    /// The names of the layers, and the other strings they hold.
+    StringPool& GetStringPool() { return m_StringPool; }
+    const StringPool& GetStringPool() const { return m_StringPool; }
+
+    /// Storage for the constant tensors of the layers.
+    ConstantPool& GetConstantPool() { return m_ConstantPool; }
+    const ConstantPool& GetConstantPool() const { return m_ConstantPool; }
+
+private:
+    template <typename LayerT>
+    class LayerInGraph;
+
+    friend class OutputSlot;
+
+    /// Called before a connection from source to destination is made. Moves the layers needed to keep the
+    /// topological order valid with the new edge (Pearce-Kelly), only the layers ordered between the two ends
+    /// of the edge are ever visited.
+    /// Throws GraphValidationException if the connection would create a cycle.
+    void AddEdge(Layer& source, Layer& destination);
+
+    /// Collects, with a depth-first search from start, the layers reached through getNeighbours that satisfy
+    /// isInRange. Visited layers are flagged with m_Visiting, which the caller must reset.
+    /// Returns false if the search reached target.
+    template <typename GetNeighbours, typename IsInRange>
+    static bool CollectReachable(Layer& start,
+                                 const Layer& target,
+                                 GetNeighbours getNeighbours,
+                                 IsInRange isInRange,
+                                 std::vector<Layer*>& reached);
+
+    /// Drops the entries left behind by erased layers.
+    void Compact();
+
+    /// Interns the name of a new layer and appends it to the layers with that name.
+    void AddToNameIndex(Layer& layer);
+    void RemoveFromNameIndex(Layer& layer);
+
+    /// The first and last layers with a name: the others are linked from one to the other, through
+    /// Layer::m_NextWithName and Layer::m_PreviousWithName.
+    struct NamedLayers
+    {
+        Layer* m_First = nullptr;
+        Layer* m_Last = nullptr;
+    };
+
+    ArenaAllocator m_Allocator;
+    StringPool m_StringPool{m_Allocator};
+    ConstantPool m_ConstantPool;
+    std::vector<Layer*> m_Layers;
+    std::vector<Layer*> m_TopologicalOrder;
+    std::size_t m_NumErased = 0;
+    /// Indexed by the id of the name.
+    std::vector<NamedLayers> m_LayersByName;
+    MemoryPlan m_MemoryPlan;
+};
+
+/// Gives the graph access to the protected constructors and destructors of the layer classes.
+template <typename LayerT>
+class Graph::LayerInGraph final : public LayerT
+{
+public:
+    template <typename... Args>
+    explicit LayerInGraph(Args&&... args)
+    : LayerT(std::forward<Args>(args)...)
+    {
+    }
+
+    ~LayerInGraph() override = default;
+};
+
+template <typename LayerT, typename... Args>
+inline LayerT* Graph::AddLayer(Args&&... args)
+{
+    LayerT* const layer = m_Allocator.New<LayerInGraph<LayerT>>(std::forward<Args>(args)...);
+
+    layer->m_Graph      = this;
+    layer->m_GraphIndex = m_Layers.size();
+    m_Layers.push_back(layer);
+
+    // A new layer has no connections yet, so it can go anywhere in the order.
+    layer->m_TopologicalIndex = m_TopologicalOrder.size();
+    m_TopologicalOrder.push_back(layer);
+
+    AddToNameIndex(*layer);
+
+    return layer;
+}
+
+} // namespace armnn
@@ -45,6 +45,18 @@ enum class LayerType
 
 const char* GetLayerTypeAsCString(LayerType type);
 
+/// Blocked layouts the weights of a layer can be packed in ahead of time, for the kernel reading them
+/// (see WeightPacking.hpp). Each value fixes the sizes of the blocks, so a kernel using other sizes adds its own.
+enum class PackedWeightLayout
+{
+    /// The weights are not packed.
+    None,
+    /// The A operand of Sgemm(): panels of 6 rows, in blocks of 256 columns.
+    GemmA6x256,
+    /// The B operand of Sgemm(): panels of 16 columns, in blocks of 256 rows.
+    GemmB16x256,
+};
+
 using Coordinates = std::array<unsigned int, MaxNumOfTensorDimensions>;
 using Dimensions = std::array<unsigned int, MaxNumOfTensorDimensions>;
 
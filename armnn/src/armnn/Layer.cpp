@@ -4,6 +4,8 @@
 //
 #include "Layer.hpp"
 
+#include "Graph.hpp"
+
 
 
 
@@ -12,11 +14,33 @@
 #include <boost/log/trivial.hpp>
 
 
+#include <atomic>
+#include <iostream>
 #include <numeric>
 
 namespace armnn
 {
 
+InputSlot::~InputSlot()
+{
+    if (m_Connection != nullptr)
+    {
+        try
+        {
+            // Coverity fix: Disconnect() may throw uncaught exceptions.
+            m_Connection->Disconnect(*this);
+        }
+        catch (const std::exception& e)
+        {
+            // Coverity fix: BOOST_LOG_TRIVIAL (typically used to report errors) may throw an
+            // exception of type std::length_error.
+            // Using stderr instead in this context as there is no point in nesting try-catch blocks here.
+            std::cerr << "WARNING: An error has occurred when disconnecting an input slot: "
+                      << e.what() << std::endl;
+        }
+    }
+}
+
 void InputSlot::Insert(Layer& layer)
 {
     BOOST_ASSERT(layer.GetNumOutputSlots() == 1);
@@ -34,13 +58,30 @@ void InputSlot::Insert(Layer& layer)
 
         // Sets tensor info for inserted layer.
         const TensorInfo& tensorInfo = prevSlot->GetTensorInfo();
-        .SetTensorInfo(tensorInfo);
+        layer.GetOutputSlot().SetTensorInfo(tensorInfo);
     }
 
     // Connects inserted layer to this.
     layer.GetOutputSlot(0).Connect(*this);
 }
 
+OutputSlot::~OutputSlot()
+{
+    try
+    {
+        // Coverity fix: DisconnectAll() may throw uncaught exceptions.
+        DisconnectAll();
+    }
+    catch (const std::exception& e)
+    {
+        // Coverity fix: BOOST_LOG_TRIVIAL (typically used to report errors) may throw an
+        // exception of type std::length_error.
+        // Using stderr instead in this context as there is no point in nesting try-catch blocks here.
+        std::cerr << "WARNING: An error has occurred when disconnecting all output slots: "
+                  << e.what() << std::endl;
+    }
+}
+
 const InputSlot* OutputSlot::GetConnection(unsigned int index) const
 {
     ValidateConnectionIndex(index);
@@ -63,12 +104,18 @@ void OutputSlot::SetTensorInfo(const TensorInfo& tensorInfo)
 }
 
 /// @brief - Gets the matching TensorInfo for the output.
-    /// @return - References to the output TensorInfo.
-    //m 2
-    const TensorInfo& GetTensorInfo() const { return m_TensorInfo; }
+/// @return - References to the output TensorInfo.
+//m 2
+const TensorInfo& OutputSlot::GetTensorInfo() const
+{
+    return m_TensorInfo;
+}
 
-  // modified 3
-   bool IsTensorInfoSet() const { return m_bTensorInfoSet; }
+// modified 3
+bool OutputSlot::IsTensorInfoSet() const
+{
+    return m_bTensorInfoSet;
+}
 
 
 //modified 4
@@ -80,34 +127,92 @@ bool OutputSlot::ValidateTensorShape(const TensorShape& shape) const
 
 int OutputSlot::Connect(InputSlot& destination)
 {
+    // Keeps the topological order of the graph valid with the new edge (throws if it would create a cycle).
+    Graph* const graph = GetOwningLayer().m_Graph;
+    if (graph != nullptr)
+    {
+        graph->AddEdge(GetOwningLayer(), destination.GetOwningLayer());
+    }
+
     destination.SetConnection(this);
+    destination.m_IndexInConnections = m_Connections.size();
     m_Connections.push_back(&destination);
     return boost::numeric_cast<int>(m_Connections.size() - 1);
 }
 
 void OutputSlot::Disconnect(InputSlot& slot)
 {
+    if (slot.GetConnectedOutputSlot() != this)
+    {
+        throw InvalidArgumentException("Tried to disconnect an input slot from an output slot it is not connected to");
+    }
+    BOOST_ASSERT(m_Connections[slot.m_IndexInConnections] == &slot);
+
+    InputSlot* const last = m_Connections.back();
+    m_Connections[slot.m_IndexInConnections] = last;
+    last->m_IndexInConnections = slot.m_IndexInConnections;
+    m_Connections.pop_back();
     slot.SetConnection(nullptr);
-    m_Connections.erase(std::remove(m_Connections.begin(), m_Connections.end(), &slot), m_Connections.end());
 }
 
 void OutputSlot::DisconnectAll()
 {
-    while (GetNumConnections() > 0)
+    for (InputSlot* connection : m_Connections)
     {
-        InputSlot& connection = *GetConnection(0);
-        Disconnect(connection);
+        connection->SetConnection(nullptr);
     }
+    m_Connections.clear();
 }
 
 void OutputSlot::MoveAllConnections(OutputSlot& destination)
 {
-    while (GetNumConnections() > 0)
+    if (&destination == this)
+    {
+        return;
+    }
+
+    destination.m_Connections.reserve(destination.m_Connections.size() + m_Connections.size());
+    std::size_t numMoved = 0;
+    try
+    {
+        for (; numMoved < m_Connections.size(); ++numMoved)
+        {
+            InputSlot& connection = *m_Connections[numMoved];
+            connection.SetConnection(nullptr);
+            destination.Connect(connection);
+        }
+    }
+    catch (...)
+    {
+        // Keeps the connections which were not moved (Connect() throws before connecting anything).
+        m_Connections[numMoved]->SetConnection(this);
+        m_Connections.erase(m_Connections.begin(),
+                            m_Connections.begin() + boost::numeric_cast<std::ptrdiff_t>(numMoved));
+        for (std::size_t i = 0; i < m_Connections.size(); ++i)
+        {
+            m_Connections[i]->m_IndexInConnections = i;
+        }
+        throw;
+    }
+    m_Connections.clear();
+}
+
+unsigned int OutputSlot::CalculateIndexOnOwner() const
+{
+    for (unsigned int i = 0; i < GetOwningLayer().GetNumOutputSlots(); i++)
     {
-        InputSlot& connection = *GetConnection(0);
-        Disconnect(connection);
-        destination.Connect(connection);
+        if (&GetOwningLayer().GetOutputSlot(i) == this)
+        {
+            return i;
+        }
     }
+    BOOST_ASSERT_MSG(false, "Did not find slot on owner.");
+    return 0; // Error
+}
+
+LayerGuid OutputSlot::GetOwningLayerGuid() const
+{
+    return GetOwningLayer().GetGuid();
 }
 
 void OutputSlot::ValidateConnectionIndex(unsigned int index) const
@@ -120,17 +225,27 @@ void OutputSlot::ValidateConnectionIndex(unsigned int index) const
 }
 
 namespace {
+/// Number of guids a thread reserves at once, so that threads building networks concurrently only touch the shared
+/// counter once every so many layers.
+constexpr LayerGuid LayerGuidBlockSize = 64;
+
 LayerGuid GenerateLayerGuid()
 {
-    // Note: Not thread safe.
-    static LayerGuid newGuid=0;
+    static std::atomic<LayerGuid> nextBlock(0);
+    thread_local LayerGuid newGuid = 0;
+    thread_local LayerGuid blockEnd = 0;
+    if (newGuid == blockEnd)
+    {
+        newGuid  = nextBlock.fetch_add(LayerGuidBlockSize, std::memory_order_relaxed);
+        blockEnd = newGuid + LayerGuidBlockSize;
+    }
     return newGuid++;
 }
 } // namespace
 
 Layer::Layer(unsigned int numInputSlots, unsigned int numOutputSlots, LayerType type, const char* name)
-: m_LayerName(name ? name : "")
-, m_Type(type)
+: m_Type(type)
+, m_ConstructorName(name)
 , m_Guid(GenerateLayerGuid())
 {
     m_InputSlots.reserve(numInputSlots);
@@ -142,11 +257,28 @@ Layer::Layer(unsigned int numInputSlots, unsigned int numOutputSlots, LayerType
     m_OutputSlots.reserve(numOutputSlots);
     for (unsigned int i = 0; i < numOutputSlots; ++i)
     {
-        m_OutputSlots.emplace_back(*this, m_OutputHandlers[i]);
+        m_OutputSlots.emplace_back(*this);
     }
 }
 
 
+std::string Layer::GetNameStr() const
+{
+    return GetName();
+}
+
+const char* Layer::GetName() const
+{
+    BOOST_ASSERT_MSG(m_Graph != nullptr, "The name of a layer is only set once it is added to a graph");
+    return m_Graph->GetStringPool().Get(m_NameId).data();
+}
+
+void Layer::AddRelatedLayerName(boost::string_ref layerName)
+{
+    BOOST_ASSERT(m_Graph != nullptr);
+    m_RelatedLayerNames.push_back(m_Graph->GetStringPool().Intern(layerName.data(), layerName.size()));
+}
+
 DataType Layer::GetDataType() const
 {
     if (GetNumInputSlots() > 0) // Ignore the input layer.
@@ -156,10 +288,88 @@ DataType Layer::GetDataType() const
     return GetOutputSlot(0).GetTensorInfo().GetDataType();
 }
 
-void Layer::ResetPriority() const
+std::vector<TensorShape> Layer::InferOutputShapes(const std::vector<TensorShape>& inputShapes) const
 {
-    m_Priority = 0;
-    m_Visiting = false;
+    BOOST_ASSERT(GetNumInputSlots() != 0);
+    BOOST_ASSERT(GetNumOutputSlots() != 0);
+
+    // By default we return what we got, meaning the output shape(s) are the same as the input(s).
+    // This only works if the number of inputs and outputs are the same. Since we are in the Layer
+    // base class, this means the implementation needs to be overridden in the specific layers for
+    // the other cases. So the missing implementation justifies the UnimplementedException.
+
+    if (GetNumInputSlots() != GetNumOutputSlots())
+    {
+        throw UnimplementedException(
+            boost::str(boost::format("Default implementation for InferOutputShapes can only be used for "
+                                     "layers with the same number of input and output slots. This doesn't "
+                                     "hold for %1% layer %2% (#inputs=%3% #outputs=%4%)")
+                       % GetLayerTypeAsCString(this->GetType())
+                       % GetNameStr()
+                       % GetNumInputSlots()
+                       % GetNumOutputSlots()));
+    }
+    return inputShapes;
+}
+
+void Layer::InferTensorInfos()
+{
+    if (GetNumInputSlots() == 0)
+    {
+        return;
+    }
+
+    const std::vector<TensorShape> inputShapes = GetInputShapes();
+    if (GetNumOutputSlots() > 0)
+    {
+        SetInferredShapes(InferOutputShapes(inputShapes));
+    }
+}
+
+std::vector<TensorShape> Layer::GetInputShapes() const
+{
+    std::vector<TensorShape> inputShapes;
+    inputShapes.reserve(GetNumInputSlots());
+
+    for (auto&& inputSlot : GetInputSlots())
+    {
+        const OutputSlot* const source = inputSlot.GetConnectedOutputSlot();
+        if (source == nullptr)
+        {
+            throw LayerValidationException(
+                boost::str(boost::format("Input slot %1% of %2% layer %3% is not connected")
+                           % inputSlot.GetSlotIndex()
+                           % GetLayerTypeAsCString(GetType())
+                           % GetNameStr()));
+        }
+        if (!source->IsTensorInfoSet())
+        {
+            throw LayerValidationException(
+                boost::str(boost::format("The TensorInfo connected to input slot %1% of %2% layer %3% is not set")
+                           % inputSlot.GetSlotIndex()
+                           % GetLayerTypeAsCString(GetType())
+                           % GetNameStr()));
+        }
+        inputShapes.push_back(source->GetTensorInfo().GetShape());
+    }
+    return inputShapes;
+}
+
+void Layer::SetInferredShapes(const std::vector<TensorShape>& outputShapes)
+{
+    BOOST_ASSERT(outputShapes.size() == GetNumOutputSlots());
+    BOOST_ASSERT(GetNumInputSlots() > 0);
+
+    const TensorInfo& firstInputInfo = GetInputSlot(0).GetConnectedOutputSlot()->GetTensorInfo();
+
+    for (unsigned int i = 0; i < GetNumOutputSlots(); ++i)
+    {
+        OutputSlot& outputSlot = GetOutputSlot(i);
+
+        TensorInfo tensorInfo = outputSlot.IsTensorInfoSet() ? outputSlot.GetTensorInfo() : firstInputInfo;
+        tensorInfo.SetShape(outputShapes[i]);
+        outputSlot.SetTensorInfo(tensorInfo);
+    }
 }
 
 
@@ -1,21 +1,35 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "InternalTypes.hpp"
+#include "MemoryPlanner.hpp"
+#include "SmallVector.hpp"
+#include "StringPool.hpp"
 
 #include <armnn/Types.hpp>
 #include <armnn/Tensor.hpp>
 #include <armnn/INetwork.hpp>
+#include <armnn/Exceptions.hpp>
 
+#include <boost/cast.hpp>
 
 #include <algorithm>
 
 #include <string>
 #include <vector>
-#include <iostream>
 #include <functional>
-#include <list>
 
 namespace armnn
 {
 
-    class InputSlot final : public IInputSlot
+class Graph;
+class Layer;
+class OutputSlot;
+
+class InputSlot final : public IInputSlot
 {
 public:
     explicit InputSlot(Layer& owner, unsigned int slotIndex)
@@ -52,9 +66,13 @@ public:
     IOutputSlot* GetConnection() override;
 
 private:
+    friend class OutputSlot;
+
     Layer& m_OwningLayer;
     OutputSlot* m_Connection;
     const unsigned int m_SlotIndex;
+    /// Position of the slot in the connections of m_Connection, so that it can be disconnected in constant time.
+    std::size_t m_IndexInConnections = 0;
 };
 
 
@@ -66,38 +84,28 @@ public:
      ,m_TensorInfo()
     {}
 
-    ~OutputSlot()
-    {
-        try
-        {
-            // Coverity fix: DisconnectAll() may throw uncaught exceptions.
-            DisconnectAll();
-        }
-        catch (const std::exception& e)
-        {
-            // Coverity fix: BOOST_LOG_TRIVIAL (typically used to report errors) may throw an
-            // exception of type std::length_error.
-            // Using stderr instead in this context as there is no point in nesting try-catch blocks here.
-            std::cerr << "WARNING: An error has occurred when disconnecting all output slots: "
-                      << e.what() << std::endl;
-        }
-    }
+    ~OutputSlot();
 
     Layer& GetOwningLayer() const { return m_OwningLayer; }
 
-
-
     int Connect(InputSlot& destination);
+
+    /// Disconnects one of the connections of the slot, in constant time: the last connection takes its place, so
+    /// the order of the connections is not preserved.
     void Disconnect(InputSlot& slot);
 
-    const std::vector<InputSlot*>& GetConnections() const { return m_Connections; }
+    /// Most outputs have a single consumer, which is stored without any allocation.
+    using Connections = SmallVector<InputSlot*, 1>;
+
+    const Connections& GetConnections() const { return m_Connections; }
 
     bool ValidateTensorShape(const TensorShape& shape) const;
 
     // Disconnect all conections.
     void DisconnectAll();
 
-    /// Moves all connections to another OutputSlot.
+    /// Moves all connections to another OutputSlot, where they are appended in their order, in time linear in their
+    /// number.
     void MoveAllConnections(OutputSlot& destination);
 
     // IOutputSlot
@@ -113,6 +121,11 @@ public:
     const TensorInfo& GetTensorInfo() const override;
     bool IsTensorInfoSet() const override;
 
+    /// Offset of the tensor in the activation arena of the graph, as planned by PlanActivationMemory(), or
+    /// InvalidMemoryOffset if it lives in a user buffer (or the graph has not been planned).
+    std::size_t GetMemoryOffset() const { return m_MemoryOffset; }
+    void SetMemoryOffset(std::size_t offset) { m_MemoryOffset = offset; }
+
     int Connect(IInputSlot& destination) override
     {
         return Connect(*boost::polymorphic_downcast<InputSlot*>(&destination));
@@ -123,20 +136,26 @@ public:
         return Disconnect(*boost::polymorphic_downcast<InputSlot*>(&slot));
     }
 
-    
+    unsigned int CalculateIndexOnOwner() const override;
+
+    LayerGuid GetOwningLayerGuid() const override;
 
 private:
     void ValidateConnectionIndex(unsigned int index) const;
     Layer& m_OwningLayer;
     TensorInfo m_TensorInfo;
     bool m_bTensorInfoSet = false;
-    std::vector<InputSlot*> m_Connections;
+    std::size_t m_MemoryOffset = InvalidMemoryOffset;
+    Connections m_Connections;
 };
 
+// InputSlot inlines that need OutputSlot declaration.
+
+inline const IOutputSlot* InputSlot::GetConnection() const { return GetConnectedOutputSlot(); }
+inline IOutputSlot* InputSlot::GetConnection() { return GetConnectedOutputSlot(); }
 
-// Base layer class
 
-using LayerPriority = unsigned int;
+// Base layer class
 
 class Layer : public IConnectableLayer
 {
@@ -145,23 +164,28 @@ public:
     Layer(unsigned int numInputSlots, unsigned int numOutputSlots, LayerType type, const char* name);
     Layer(unsigned int numInputSlots, unsigned int numOutputSlots, LayerType type, DataLayout layout, const char* name);
 
-    const std::string& GetNameStr() const
-    {
-        return m_LayerName;
-    }
+    /// The name of the layer, interned in the StringPool of its graph: layers with the same name share it. Returns
+    /// a copy: GetName() and GetNameId() don't copy it.
+    std::string GetNameStr() const;
+    StringPool::StringId GetNameId() const { return m_NameId; }
 
     
 
-    const std::vector<InputSlot>& GetInputSlots() const { return m_InputSlots; }
-    const std::vector<OutputSlot>& GetOutputSlots() const { return m_OutputSlots; }
+    /// Most layers have a single input and a single output, which are stored within the layer. The slots of the
+    /// others are allocated once, when the layer is constructed: their number never changes.
+    using InputSlots = SmallVector<InputSlot, 1>;
+    using OutputSlots = SmallVector<OutputSlot, 1>;
+
+    const InputSlots& GetInputSlots() const { return m_InputSlots; }
+    const OutputSlots& GetOutputSlots() const { return m_OutputSlots; }
 
     // Allows non-const access to input slots, but don't expose vector (vector size is fixed at layer construction).
-    std::vector<InputSlot>::iterator BeginInputSlots() { return m_InputSlots.begin(); }
-    std::vector<InputSlot>::iterator EndInputSlots() { return m_InputSlots.end(); }
+    InputSlots::iterator BeginInputSlots() { return m_InputSlots.begin(); }
+    InputSlots::iterator EndInputSlots() { return m_InputSlots.end(); }
 
     // Allows non-const access to output slots, but don't expose vector (vector size is fixed at layer construction).
-    std::vector<OutputSlot>::iterator BeginOutputSlots() { return m_OutputSlots.begin(); }
-    std::vector<OutputSlot>::iterator EndOutputSlots() { return m_OutputSlots.end(); }
+    OutputSlots::iterator BeginOutputSlots() { return m_OutputSlots.begin(); }
+    OutputSlots::iterator EndOutputSlots() { return m_OutputSlots.end(); }
 
     // Checks whether the outputs of this layer don't have any connection.
     bool IsOutputUnconnected()
@@ -184,7 +208,7 @@ public:
 
     // IConnectableLayer
 
-    const char* GetName() const override { return m_LayerName.c_str(); }
+    const char* GetName() const override;
 
     unsigned int GetNumInputSlots() const override { return static_cast<unsigned int>(m_InputSlots.size()); }
     unsigned int GetNumOutputSlots() const override { return static_cast<unsigned int>(m_OutputSlots.size()); }
@@ -194,30 +218,68 @@ public:
     const OutputSlot& GetOutputSlot(unsigned int index = 0) const override { return m_OutputSlots.at(index); }
     OutputSlot& GetOutputSlot(unsigned int index = 0) override { return m_OutputSlots.at(index); }
 
+    /// By default returns inputShapes if the number of inputs are equal to number of outputs,
+    /// otherwise infers the output shapes from given input shapes and layer properties.
+    std::vector<TensorShape> InferOutputShapes(const std::vector<TensorShape>& inputShapes) const override;
+
+    /// Sets the TensorInfo of the output slots from the ones connected to the inputs, using InferOutputShapes().
+    /// Outputs which already have a TensorInfo keep its data type and quantization parameters and only get their
+    /// shape updated; the others take those of the first input. Layers without inputs are left untouched,
+    /// layers without outputs only have their inputs checked.
+    /// Throws LayerValidationException if an input is not connected or has no TensorInfo.
+    virtual void InferTensorInfos();
+
     void SetGuid(LayerGuid guid) { m_Guid = guid; }
     LayerGuid GetGuid() const final { return m_Guid; }
 
-    void AddRelatedLayerName(const std::string layerName) { m_RelatedLayerNames.emplace_back(layerName); }
+    /// Records the name of a layer merged into this one (interned in the StringPool of the graph).
+    void AddRelatedLayerName(boost::string_ref layerName);
 
-    const std::list<std::string>& GetRelatedLayerNames() { return m_RelatedLayerNames; }
+    const std::vector<StringPool::StringId>& GetRelatedLayerNames() const { return m_RelatedLayerNames; }
 
+protected:
+    /// Shapes of the tensors connected to the input slots, in slot order.
+    std::vector<TensorShape> GetInputShapes() const;
 
-private:
-    const std::string m_LayerName;
+    /// Applies the shapes returned by InferOutputShapes() to the output slots (see InferTensorInfos()).
+    void SetInferredShapes(const std::vector<TensorShape>& outputShapes);
 
-    std::vector<InputSlot> m_InputSlots;
-    std::vector<OutputSlot> m_OutputSlots;
+    // Graph needs access to the virtual destructor.
+    friend class Graph;
+    virtual ~Layer() = default;
 
+    // OutputSlot notifies the owning graph of new connections.
+    friend class OutputSlot;
+
+private:
+    /// First, next to the pointer to the vtable: dispatching on the type of the layers of a graph reads it from
+    /// every layer, most of them not in the cache.
     const LayerType m_Type;
 
+    /// Set by Graph::AddLayer(), which interns m_ConstructorName: the name given to the constructor, only valid
+    /// until then.
+    StringPool::StringId m_NameId = StringPool::InvalidStringId;
+    const char* m_ConstructorName;
 
-    /// Used for sorting.
-   
-   
+    InputSlots m_InputSlots;
+    OutputSlots m_OutputSlots;
 
     LayerGuid m_Guid;
 
-    //std::list<std::string> m_RelatedLayerNames;
+    std::vector<StringPool::StringId> m_RelatedLayerNames;
+
+    /// Graph the layer belongs to, and its position in the storage and in the topological order of that graph
+    /// (managed by the Graph).
+    Graph* m_Graph = nullptr;
+    std::size_t m_GraphIndex = 0;
+    std::size_t m_TopologicalIndex = 0;
+
+    /// The layers of the graph with the same name, in the order they were added (managed by the Graph).
+    Layer* m_PreviousWithName = nullptr;
+    Layer* m_NextWithName = nullptr;
+
+    /// Marks the layers already reached by the searches of the incremental topological sort (see Graph::AddEdge()).
+    mutable bool m_Visiting = false;
 };
 
 // A layer user-provided data can be bound to (e.g. inputs, outputs).
@@ -243,5 +305,4 @@ private:
     LayerBindingId m_Id;
 };
 
-
-}
\ No newline at end of file
+} // namespace armnn
@@ -0,0 +1,397 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "LayerFusion.hpp"
+
+#include "ConstantPool.hpp"
+#include "Graph.hpp"
+#include "LayerVisitor.hpp"
+#include "LayersFwd.hpp"
+#include "WeightPacking.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/cast.hpp>
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// The parameters of the layers an activation or a batch normalization can be merged into, seen through a
+/// common interface.
+struct FusionTarget
+{
+    ConstTensor* m_Weight = nullptr;
+    ConstTensor* m_Bias = nullptr;
+    ActivationDescriptor* m_FusedActivation = nullptr;
+    bool* m_HasFusedActivation = nullptr;
+};
+
+bool GetFusionTarget(Layer& layer, FusionTarget& target)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Convolution2d:
+        {
+            auto& convLayer = *boost::polymorphic_downcast<Convolution2dLayer*>(&layer);
+            target = { &convLayer.m_Weight, &convLayer.m_Bias,
+                       &convLayer.m_FusedActivation, &convLayer.m_HasFusedActivation };
+            return true;
+        }
+        case LayerType::DepthwiseConvolution2d:
+        {
+            auto& convLayer = *boost::polymorphic_downcast<DepthwiseConvolution2dLayer*>(&layer);
+            target = { &convLayer.m_Weight, &convLayer.m_Bias,
+                       &convLayer.m_FusedActivation, &convLayer.m_HasFusedActivation };
+            return true;
+        }
+        case LayerType::FullyConnected:
+        {
+            auto& fcLayer = *boost::polymorphic_downcast<FullyConnectedLayer*>(&layer);
+            target = { &fcLayer.m_Weight, &fcLayer.m_Bias, &fcLayer.m_FusedActivation, &fcLayer.m_HasFusedActivation };
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+/// Returns the layer producing the input of the given one if it can absorb it: a Float32 Convolution2d,
+/// DepthwiseConvolution2d or FullyConnected layer whose only consumer is that layer, and which has no fused
+/// activation yet. Returns nullptr otherwise.
+Layer* GetFusableProducer(const Layer& layer, FusionTarget& target)
+{
+    const OutputSlot* const source = layer.GetInputSlot(0).GetConnectedOutputSlot();
+    if (source == nullptr || source->GetNumConnections() != 1)
+    {
+        return nullptr;
+    }
+
+    Layer& producer = source->GetOwningLayer();
+    if (!GetFusionTarget(producer, target) ||
+        *target.m_HasFusedActivation ||
+        target.m_Weight->GetInfo().GetDataType() != DataType::Float32)
+    {
+        return nullptr;
+    }
+    return &producer;
+}
+
+/// Computes the output channel each element of the weights of the producer contributes to, and the number of
+/// output channels. Returns false if the channels of the batch normalization are another dimension.
+bool GetOutputChannels(const Layer& producer,
+                       const TensorShape& weightShape,
+                       const BatchNormalizationDescriptor& batchNorm,
+                       std::vector<unsigned int>& channelOfWeight,
+                       unsigned int& numChannels)
+{
+    channelOfWeight.resize(weightShape.GetNumElements());
+
+    switch (producer.GetType())
+    {
+        case LayerType::Convolution2d:
+        {
+            // Weights are [O, ...] whatever the layout, the output channels being where the layout puts them.
+            const auto& convLayer = *boost::polymorphic_downcast<const Convolution2dLayer*>(&producer);
+            if (convLayer.GetParameters().m_DataLayout != batchNorm.m_DataLayout)
+            {
+                return false;
+            }
+            numChannels = weightShape[0];
+            const unsigned int channelSize = weightShape.GetNumElements() / numChannels;
+            for (unsigned int i = 0; i < channelOfWeight.size(); ++i)
+            {
+                channelOfWeight[i] = i / channelSize;
+            }
+            return true;
+        }
+        case LayerType::DepthwiseConvolution2d:
+        {
+            // Weights are [M, C, H, W], output channel c * M + m using filter (m, c).
+            const auto& convLayer = *boost::polymorphic_downcast<const DepthwiseConvolution2dLayer*>(&producer);
+            if (convLayer.GetParameters().m_DataLayout != batchNorm.m_DataLayout)
+            {
+                return false;
+            }
+            const unsigned int multiplier = weightShape[0];
+            const unsigned int channels   = weightShape[1];
+            const unsigned int filterSize = weightShape[2] * weightShape[3];
+            numChannels = multiplier * channels;
+            for (unsigned int i = 0; i < channelOfWeight.size(); ++i)
+            {
+                const unsigned int m = i / (channels * filterSize);
+                const unsigned int c = (i / filterSize) % channels;
+                channelOfWeight[i] = c * multiplier + m;
+            }
+            return true;
+        }
+        case LayerType::FullyConnected:
+        {
+            // The output is [N, O], so the channels are the second dimension whatever the layout of the batch
+            // normalization. Weights are [I, O], or [O, I] when transposed.
+            const auto& fcLayer = *boost::polymorphic_downcast<const FullyConnectedLayer*>(&producer);
+            const bool transposed = fcLayer.GetParameters().m_TransposeWeightMatrix;
+            numChannels = transposed ? weightShape[0] : weightShape[1];
+            const unsigned int inputSize = transposed ? weightShape[1] : weightShape[0];
+            for (unsigned int i = 0; i < channelOfWeight.size(); ++i)
+            {
+                channelOfWeight[i] = transposed ? i / inputSize : i % numChannels;
+            }
+            return true;
+        }
+        default:
+            BOOST_ASSERT_MSG(false, "Not a fusion target");
+            return false;
+    }
+}
+
+bool IsFloat32(const ConstTensor& tensor)
+{
+    return tensor.GetInfo().GetDataType() == DataType::Float32;
+}
+
+const float* GetData(const ConstTensor& tensor)
+{
+    return static_cast<const float*>(tensor.GetMemoryArea());
+}
+
+/// Enables the bias of the producer, whose bias tensor must have been set, and drops what was computed from its
+/// old weights.
+void EnableBias(Layer& producer)
+{
+    switch (producer.GetType())
+    {
+        case LayerType::Convolution2d:
+        {
+            auto& convLayer = *boost::polymorphic_downcast<Convolution2dLayer*>(&producer);
+            Convolution2dDescriptor descriptor = convLayer.GetParameters();
+            descriptor.m_BiasEnabled = true;
+            convLayer.SetParameters(descriptor);
+            convLayer.m_WinogradWeight = ConstTensor();
+            convLayer.m_PackedWeight = ConstTensor();
+            convLayer.m_PackedWeightLayout = PackedWeightLayout::None;
+            break;
+        }
+        case LayerType::DepthwiseConvolution2d:
+        {
+            auto& convLayer = *boost::polymorphic_downcast<DepthwiseConvolution2dLayer*>(&producer);
+            DepthwiseConvolution2dDescriptor descriptor = convLayer.GetParameters();
+            descriptor.m_BiasEnabled = true;
+            convLayer.SetParameters(descriptor);
+            break;
+        }
+        case LayerType::FullyConnected:
+        {
+            auto& fcLayer = *boost::polymorphic_downcast<FullyConnectedLayer*>(&producer);
+            FullyConnectedDescriptor descriptor = fcLayer.GetParameters();
+            descriptor.m_BiasEnabled = true;
+            fcLayer.SetParameters(descriptor);
+            fcLayer.m_PackedWeight = ConstTensor();
+            fcLayer.m_PackedWeightLayout = PackedWeightLayout::None;
+            break;
+        }
+        default:
+            BOOST_ASSERT_MSG(false, "Not a fusion target");
+    }
+}
+
+bool FoldBatchNormalizationLayer(Graph& graph, BatchNormalizationLayer& batchNorm)
+{
+    FusionTarget target;
+    Layer* const producer = GetFusableProducer(batchNorm, target);
+    if (producer == nullptr)
+    {
+        return false;
+    }
+    UnpackWeight(graph, *producer);
+
+    const BatchNormalizationDescriptor& descriptor = batchNorm.GetParameters();
+    std::vector<unsigned int> channelOfWeight;
+    unsigned int numChannels = 0;
+    if (!GetOutputChannels(*producer, target.m_Weight->GetShape(), descriptor, channelOfWeight, numChannels))
+    {
+        return false;
+    }
+
+    const bool hasBias = target.m_Bias->GetMemoryArea() != nullptr;
+    for (const ConstTensor* tensor :
+         { &batchNorm.m_Mean, &batchNorm.m_Variance, &batchNorm.m_Beta, &batchNorm.m_Gamma })
+    {
+        if (!IsFloat32(*tensor) || tensor->GetNumElements() != numChannels)
+        {
+            return false;
+        }
+    }
+    if (hasBias && (!IsFloat32(*target.m_Bias) || target.m_Bias->GetNumElements() != numChannels))
+    {
+        return false;
+    }
+
+    const float* const mean     = GetData(batchNorm.m_Mean);
+    const float* const variance = GetData(batchNorm.m_Variance);
+    const float* const beta     = GetData(batchNorm.m_Beta);
+    const float* const gamma    = GetData(batchNorm.m_Gamma);
+
+    std::vector<float> scale(numChannels);
+    for (unsigned int c = 0; c < numChannels; ++c)
+    {
+        scale[c] = gamma[c] / std::sqrt(variance[c] + descriptor.m_Eps);
+    }
+
+    const TensorInfo& weightInfo = target.m_Weight->GetInfo();
+    ConstantPool::Buffer weightData(weightInfo.GetNumBytes());
+    float* const weight = reinterpret_cast<float*>(weightData.data());
+    const float* const oldWeight = GetData(*target.m_Weight);
+    for (unsigned int i = 0; i < channelOfWeight.size(); ++i)
+    {
+        weight[i] = oldWeight[i] * scale[channelOfWeight[i]];
+    }
+
+    const TensorInfo biasInfo(TensorShape({ numChannels }), DataType::Float32);
+    ConstantPool::Buffer biasData(biasInfo.GetNumBytes());
+    float* const bias = reinterpret_cast<float*>(biasData.data());
+    const float* const oldBias = hasBias ? GetData(*target.m_Bias) : nullptr;
+    for (unsigned int c = 0; c < numChannels; ++c)
+    {
+        bias[c] = ((hasBias ? oldBias[c] : 0.0f) - mean[c]) * scale[c] + beta[c];
+    }
+
+    ConstantPool& constantPool = graph.GetConstantPool();
+    *target.m_Weight = constantPool.Add(weightInfo, std::move(weightData));
+    *target.m_Bias = constantPool.Add(hasBias ? target.m_Bias->GetInfo() : biasInfo, std::move(biasData));
+    EnableBias(*producer);
+
+    producer->AddRelatedLayerName(batchNorm.GetNameStr());
+    batchNorm.GetOutputSlot(0).MoveAllConnections(producer->GetOutputSlot(0));
+    graph.EraseLayer(&batchNorm);
+    return true;
+}
+
+bool FuseActivationLayer(Graph& graph, ActivationLayer& activation)
+{
+    FusionTarget target;
+    Layer* const producer = GetFusableProducer(activation, target);
+    if (producer == nullptr || !IsFusableActivation(activation.GetParameters()))
+    {
+        return false;
+    }
+
+    SetFusedActivation(*producer, activation.GetParameters());
+
+    producer->AddRelatedLayerName(activation.GetNameStr());
+    activation.GetOutputSlot(0).MoveAllConnections(producer->GetOutputSlot(0));
+    graph.EraseLayer(&activation);
+    return true;
+}
+
+/// Collects the layers of class LayerT.
+template <typename LayerT>
+struct LayerCollector
+{
+    void Visit(LayerT& layer) { m_Layers.push_back(&layer); }
+
+    std::vector<LayerT*> m_Layers;
+};
+
+/// Calls fuse on every layer of class LayerT, invalidating the memory plan if any is removed.
+template <typename LayerT, typename Fuse>
+unsigned int FuseEach(Graph& graph, Fuse fuse)
+{
+    // Collected first: erasing layers reorganizes the storage of the graph.
+    LayerCollector<LayerT> collector;
+    VisitLayers(graph, collector);
+
+    unsigned int numFused = 0;
+    for (LayerT* layer : collector.m_Layers)
+    {
+        if (fuse(graph, *layer))
+        {
+            ++numFused;
+        }
+    }
+
+    if (numFused != 0)
+    {
+        graph.SetMemoryPlan(MemoryPlan());
+    }
+    return numFused;
+}
+
+} // namespace
+
+bool IsFusableActivation(const ActivationDescriptor& descriptor)
+{
+    switch (descriptor.m_Function)
+    {
+        case ActivationFunction::ReLu:
+            return true;
+        case ActivationFunction::BoundedReLu:
+            return descriptor.m_B <= descriptor.m_A;
+        default:
+            return false;
+    }
+}
+
+void GetActivationBounds(const ActivationDescriptor& descriptor, float& min, float& max)
+{
+    BOOST_ASSERT(IsFusableActivation(descriptor));
+
+    // BoundedReLu computes min(a, max(b, x)).
+    const bool bounded = descriptor.m_Function == ActivationFunction::BoundedReLu;
+    min = bounded ? descriptor.m_B : 0.0f;
+    max = bounded ? descriptor.m_A : std::numeric_limits<float>::infinity();
+}
+
+const ActivationDescriptor* GetFusedActivation(const Layer& layer)
+{
+    FusionTarget target;
+    if (!GetFusionTarget(const_cast<Layer&>(layer), target) || !*target.m_HasFusedActivation)
+    {
+        return nullptr;
+    }
+    return target.m_FusedActivation;
+}
+
+void SetFusedActivation(Layer& layer, const ActivationDescriptor& descriptor)
+{
+    FusionTarget target;
+    if (!GetFusionTarget(layer, target))
+    {
+        throw InvalidArgumentException(std::string("Activations cannot be fused into ") +
+                                       GetLayerTypeAsCString(layer.GetType()) + " layers");
+    }
+    if (!IsFusableActivation(descriptor))
+    {
+        throw InvalidArgumentException("Only ReLu and BoundedReLu activations can be fused into a layer");
+    }
+
+    *target.m_FusedActivation = descriptor;
+    *target.m_HasFusedActivation = true;
+}
+
+unsigned int FoldBatchNormalization(Graph& graph)
+{
+    return FuseEach<BatchNormalizationLayer>(graph, &FoldBatchNormalizationLayer);
+}
+
+unsigned int FuseActivations(Graph& graph)
+{
+    return FuseEach<ActivationLayer>(graph, &FuseActivationLayer);
+}
+
+unsigned int FuseLayers(Graph& graph)
+{
+    const unsigned int numFolded = FoldBatchNormalization(graph);
+    return numFolded + FuseActivations(graph);
+}
+
+} // namespace armnn
@@ -0,0 +1,54 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+
+namespace armnn
+{
+
+class Graph;
+class Layer;
+
+/// Whether an activation can be merged into the layer producing its input: it must clamp its input to a range,
+/// i.e. be a ReLu or a BoundedReLu.
+bool IsFusableActivation(const ActivationDescriptor& descriptor);
+
+/// The range [min, max] a fusable activation (see IsFusableActivation()) clamps its input to. The bounds are
+/// infinite where the activation doesn't clamp.
+void GetActivationBounds(const ActivationDescriptor& descriptor, float& min, float& max);
+
+/// The activation merged into a Convolution2d, DepthwiseConvolution2d or FullyConnected layer by
+/// FuseActivations(), nullptr if there is none (or the layer is of another type).
+const ActivationDescriptor* GetFusedActivation(const Layer& layer);
+
+/// Merges the activation into a Convolution2d, DepthwiseConvolution2d or FullyConnected layer, as FuseActivations()
+/// does (e.g. when loading a network optimized before). Throws InvalidArgumentException if the layer is of another
+/// type or the activation is not fusable.
+void SetFusedActivation(Layer& layer, const ActivationDescriptor& descriptor);
+
+/// Folds every BatchNormalization layer which follows a Float32 Convolution2d, DepthwiseConvolution2d or
+/// FullyConnected layer into the weights and bias of that layer, and removes it: with
+/// scale = gamma / sqrt(variance + eps), the weights of output channel c are multiplied by scale[c] and its bias
+/// becomes (bias[c] - mean[c]) * scale[c] + beta[c]. The producer must have no other consumer nor a fused
+/// activation, and the channels of both layers must be the same dimension.
+/// The folded tensors are new constants of the graph, so layers sharing weights with the producer are unaffected.
+/// The memory plan of the graph is invalidated if any layer is removed.
+/// @return The number of BatchNormalization layers folded.
+unsigned int FoldBatchNormalization(Graph& graph);
+
+/// Merges every ReLu or BoundedReLu Activation layer which follows a Float32 Convolution2d,
+/// DepthwiseConvolution2d or FullyConnected layer into it, and removes it. The producer must have no other
+/// consumer; its kernels then clamp the results as they store them, instead of a separate pass over the tensor.
+/// The memory plan of the graph is invalidated if any layer is removed.
+/// @return The number of Activation layers merged.
+unsigned int FuseActivations(Graph& graph);
+
+/// Runs FoldBatchNormalization() then FuseActivations(), so Convolution/BatchNormalization/ReLu sequences end up
+/// as a single layer.
+/// @return The number of layers removed.
+unsigned int FuseLayers(Graph& graph);
+
+} // namespace armnn
@@ -0,0 +1,142 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "LayersFwd.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <tuple>
+#include <utility>
+
+namespace armnn
+{
+
+/// A constant tensor compared by identity: same data and same TensorInfo.
+struct ConstantId
+{
+    explicit ConstantId(const ConstTensor& tensor)
+    : m_Data(tensor.GetMemoryArea())
+    , m_Info(tensor.GetInfo())
+    {
+    }
+
+    bool operator==(const ConstantId& rhs) const { return m_Data == rhs.m_Data && m_Info == rhs.m_Info; }
+
+    const void* m_Data;
+    TensorInfo  m_Info;
+};
+
+/// The state of the layers of each class besides their connections, name and output TensorInfos: descriptor,
+/// constant tensors and fused activation, as a tuple that can be compared and hashed field by field. Layer classes
+/// without an overload (Input and Output) are identified by their binding instead.
+/// @{
+inline std::tuple<ActivationDescriptor> GetState(const ActivationLayer& layer)
+{
+    return std::make_tuple(layer.GetParameters());
+}
+
+inline std::tuple<BatchNormalizationDescriptor, ConstantId, ConstantId, ConstantId, ConstantId>
+GetState(const BatchNormalizationLayer& layer)
+{
+    return std::make_tuple(layer.GetParameters(),
+                           ConstantId(layer.m_Mean),
+                           ConstantId(layer.m_Variance),
+                           ConstantId(layer.m_Beta),
+                           ConstantId(layer.m_Gamma));
+}
+
+inline std::tuple<ConstantId> GetState(const ConstantLayer& layer)
+{
+    return std::make_tuple(ConstantId(layer.m_LayerOutput));
+}
+
+inline std::tuple<> GetState(const ConvertFp16ToFp32Layer&)
+{
+    return std::make_tuple();
+}
+
+inline std::tuple<> GetState(const ConvertFp32ToFp16Layer&)
+{
+    return std::make_tuple();
+}
+
+inline std::tuple<Convolution2dDescriptor, ConstantId, ConstantId, ConstantId, ConstantId, PackedWeightLayout, bool,
+                  ActivationDescriptor>
+GetState(const Convolution2dLayer& layer)
+{
+    return std::make_tuple(layer.GetParameters(),
+                           ConstantId(layer.m_Weight),
+                           ConstantId(layer.m_Bias),
+                           ConstantId(layer.m_WinogradWeight),
+                           ConstantId(layer.m_PackedWeight),
+                           layer.m_PackedWeightLayout,
+                           layer.m_HasFusedActivation,
+                           layer.m_HasFusedActivation ? layer.m_FusedActivation : ActivationDescriptor());
+}
+
+inline std::tuple<DepthwiseConvolution2dDescriptor, ConstantId, ConstantId, bool, ActivationDescriptor>
+GetState(const DepthwiseConvolution2dLayer& layer)
+{
+    return std::make_tuple(layer.GetParameters(),
+                           ConstantId(layer.m_Weight),
+                           ConstantId(layer.m_Bias),
+                           layer.m_HasFusedActivation,
+                           layer.m_HasFusedActivation ? layer.m_FusedActivation : ActivationDescriptor());
+}
+
+inline std::tuple<FullyConnectedDescriptor, ConstantId, ConstantId, ConstantId, PackedWeightLayout, bool,
+                  ActivationDescriptor>
+GetState(const FullyConnectedLayer& layer)
+{
+    return std::make_tuple(layer.GetParameters(),
+                           ConstantId(layer.m_Weight),
+                           ConstantId(layer.m_Bias),
+                           ConstantId(layer.m_PackedWeight),
+                           layer.m_PackedWeightLayout,
+                           layer.m_HasFusedActivation,
+                           layer.m_HasFusedActivation ? layer.m_FusedActivation : ActivationDescriptor());
+}
+
+inline std::tuple<NormalizationDescriptor> GetState(const NormalizationLayer& layer)
+{
+    return std::make_tuple(layer.GetParameters());
+}
+
+inline std::tuple<PermuteDescriptor> GetState(const PermuteLayer& layer)
+{
+    return std::make_tuple(layer.GetParameters());
+}
+
+inline std::tuple<Pooling2dDescriptor> GetState(const Pooling2dLayer& layer)
+{
+    return std::make_tuple(layer.GetParameters());
+}
+
+inline std::tuple<SoftmaxDescriptor> GetState(const SoftmaxLayer& layer)
+{
+    return std::make_tuple(layer.GetParameters());
+}
+/// @}
+
+/// Calls function(field) on each field of a layer state, in order.
+/// @{
+template <typename Function, typename... Fields, std::size_t... Indices>
+void ForEachField(const std::tuple<Fields...>& state, Function& function, std::index_sequence<Indices...>)
+{
+    (void) std::initializer_list<int>{ (function(std::get<Indices>(state)), 0)... };
+}
+
+template <typename Function, typename... Fields>
+void ForEachField(const std::tuple<Fields...>& state, Function& function)
+{
+    ForEachField(state, function, std::index_sequence_for<Fields...>());
+}
+/// @}
+
+} // namespace armnn
@@ -0,0 +1,174 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Graph.hpp"
+#include "LayersFwd.hpp"
+#include "Network.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/cast.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace armnn
+{
+
+/// Visitors of layers are classes with a Visit() overload for each layer class they handle, taking the layer by
+/// reference: Visit(Convolution2dLayer&), Visit(const PermuteLayer&)... An overload taking a Layer handles the layer
+/// types no other overload does. The layer types a visitor ignores are simply not visited.
+///
+/// The overload each layer type goes to is resolved at compile time, into a table indexed by LayerType: visiting a
+/// layer costs one indirect call (none for the types the visitor ignores), where double dispatch would cost two
+/// virtual calls and testing the type of the layer with dynamic_cast one call per type tested.
+///
+/// Visitors may modify the layers they visit, but must not add layers to the graph or erase any: collect the layers
+/// to erase, then erase them once the visit is over.
+template <typename Visitor, typename LayerT>
+class LayerDispatchTable
+{
+    static_assert(std::is_same<typename std::remove_const<LayerT>::type, Layer>::value,
+                  "Layers are dispatched from a Layer or a const Layer");
+
+public:
+    using VisitFunction = void (*)(Visitor&, LayerT&);
+
+    static constexpr std::size_t NumLayerTypes = static_cast<std::size_t>(LayerType::LastLayer) + 1;
+    using Table = std::array<VisitFunction, NumLayerTypes>;
+
+    /// The function visiting each LayerType, nullptr for the types the visitor ignores.
+    static const Table& GetTable()
+    {
+        static constexpr Table table = MakeTable(std::make_index_sequence<NumLayerTypes>());
+        return table;
+    }
+
+    static constexpr bool VisitsAnyLayerType()
+    {
+        const Table table = MakeTable(std::make_index_sequence<NumLayerTypes>());
+        for (std::size_t i = 0; i < NumLayerTypes; ++i)
+        {
+            if (table[i] != nullptr)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    /// LayerClass, with the constness of LayerT.
+    template <typename LayerClass>
+    using Qualified = typename std::conditional<std::is_const<LayerT>::value, const LayerClass, LayerClass>::type;
+
+    /// The entry of a layer type the visitor ignores, or which has no layer class.
+    template <LayerType Type, typename = void>
+    struct Entry
+    {
+        static constexpr VisitFunction Get() { return nullptr; }
+    };
+
+    template <LayerType Type>
+    struct Entry<Type, decltype(void(std::declval<Visitor&>().Visit(std::declval<Qualified<LayerTypeOf<Type>>&>())))>
+    {
+        static void Visit(Visitor& visitor, LayerT& layer)
+        {
+            visitor.Visit(*boost::polymorphic_downcast<Qualified<LayerTypeOf<Type>>*>(&layer));
+        }
+
+        static constexpr VisitFunction Get() { return &Visit; }
+    };
+
+    template <std::size_t... Indices>
+    static constexpr Table MakeTable(std::index_sequence<Indices...>)
+    {
+        return {{ Entry<static_cast<LayerType>(Indices)>::Get()... }};
+    }
+};
+
+/// Calls visitor.Visit() with the layer downcast to its class, if the visitor handles that type of layer.
+template <typename Visitor>
+void VisitLayer(Layer& layer, Visitor& visitor)
+{
+    using DispatchTable = LayerDispatchTable<Visitor, Layer>;
+    static_assert(DispatchTable::VisitsAnyLayerType(), "The visitor has no Visit() overload for any layer class");
+
+    const typename DispatchTable::VisitFunction visit =
+        DispatchTable::GetTable()[static_cast<std::size_t>(layer.GetType())];
+    if (visit != nullptr)
+    {
+        visit(visitor, layer);
+    }
+}
+
+template <typename Visitor>
+void VisitLayer(const Layer& layer, Visitor& visitor)
+{
+    using DispatchTable = LayerDispatchTable<Visitor, const Layer>;
+    static_assert(DispatchTable::VisitsAnyLayerType(), "The visitor has no Visit() overload for any layer class");
+
+    const typename DispatchTable::VisitFunction visit =
+        DispatchTable::GetTable()[static_cast<std::size_t>(layer.GetType())];
+    if (visit != nullptr)
+    {
+        visit(visitor, layer);
+    }
+}
+
+/// Visits the layers of the graph in topological order: a layer is visited after the layers connected to its inputs.
+template <typename Visitor>
+void VisitLayers(Graph& graph, Visitor& visitor)
+{
+    using DispatchTable = LayerDispatchTable<Visitor, Layer>;
+    static_assert(DispatchTable::VisitsAnyLayerType(), "The visitor has no Visit() overload for any layer class");
+
+    const typename DispatchTable::Table& table = DispatchTable::GetTable();
+    const std::size_t numLayers = graph.GetNumLayers();
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        const typename DispatchTable::VisitFunction visit = table[static_cast<std::size_t>(layer->GetType())];
+        if (visit != nullptr)
+        {
+            visit(visitor, *layer);
+        }
+    }
+    BOOST_ASSERT_MSG(graph.GetNumLayers() == numLayers, "Layers were added or erased during the visit");
+    boost::ignore_unused(numLayers);
+}
+
+template <typename Visitor>
+void VisitLayers(const Graph& graph, Visitor& visitor)
+{
+    using DispatchTable = LayerDispatchTable<Visitor, const Layer>;
+    static_assert(DispatchTable::VisitsAnyLayerType(), "The visitor has no Visit() overload for any layer class");
+
+    const typename DispatchTable::Table& table = DispatchTable::GetTable();
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        const typename DispatchTable::VisitFunction visit = table[static_cast<std::size_t>(layer->GetType())];
+        if (visit != nullptr)
+        {
+            visit(visitor, *layer);
+        }
+    }
+}
+
+template <typename Visitor>
+void Network::Accept(Visitor& visitor) const
+{
+    VisitLayers(GetGraph(), visitor);
+}
+
+template <typename Visitor>
+void Network::Accept(Visitor& visitor)
+{
+    VisitLayers(GetGraph(), visitor);
+}
+
+} // namespace armnn
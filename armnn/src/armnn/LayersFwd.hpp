@@ -0,0 +1,69 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "InternalTypes.hpp"
+
+#include "layers/ActivationLayer.hpp"
+#include "layers/BatchNormalizationLayer.hpp"
+#include "layers/ConstantLayer.hpp"
+#include "layers/ConvertFp16ToFp32Layer.hpp"
+#include "layers/ConvertFp32ToFp16Layer.hpp"
+#include "layers/Convolution2dLayer.hpp"
+#include "layers/DepthwiseConvolution2dLayer.hpp"
+#include "layers/FullyConnectedLayer.hpp"
+#include "layers/InputLayer.hpp"
+#include "layers/NormalizationLayer.hpp"
+#include "layers/OutputLayer.hpp"
+#include "layers/PermuteLayer.hpp"
+#include "layers/Pooling2dLayer.hpp"
+#include "layers/SoftmaxLayer.hpp"
+
+namespace armnn
+{
+
+/// The class of the layers of a LayerType, for the types which have one (see DECLARE_LAYER).
+template <LayerType Type>
+struct LayerTypeOfImpl
+{
+};
+
+template <LayerType Type>
+using LayerTypeOf = typename LayerTypeOfImpl<Type>::Type;
+
+/// The LayerType of a layer class.
+template <typename T>
+constexpr LayerType LayerEnumOf(const T* = nullptr);
+
+#define DECLARE_LAYER_IMPL(_, LayerName)                         \
+    template <>                                                  \
+    struct LayerTypeOfImpl<LayerType::_##LayerName>              \
+    {                                                            \
+        using Type = _##LayerName##Layer;                        \
+    };                                                           \
+    template <>                                                  \
+    constexpr LayerType LayerEnumOf(const _##LayerName##Layer*)  \
+    {                                                            \
+        return LayerType::_##LayerName;                          \
+    }
+
+#define DECLARE_LAYER(LayerName) DECLARE_LAYER_IMPL(, LayerName)
+
+DECLARE_LAYER(Activation)
+DECLARE_LAYER(BatchNormalization)
+DECLARE_LAYER(Constant)
+DECLARE_LAYER(ConvertFp16ToFp32)
+DECLARE_LAYER(ConvertFp32ToFp16)
+DECLARE_LAYER(Convolution2d)
+DECLARE_LAYER(DepthwiseConvolution2d)
+DECLARE_LAYER(FullyConnected)
+DECLARE_LAYER(Input)
+DECLARE_LAYER(Normalization)
+DECLARE_LAYER(Output)
+DECLARE_LAYER(Permute)
+DECLARE_LAYER(Pooling2d)
+DECLARE_LAYER(Softmax)
+
+} // namespace armnn
@@ -0,0 +1,607 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "LayoutOptimization.hpp"
+
+#include "ConstantPool.hpp"
+#include "Graph.hpp"
+#include "LayersFwd.hpp"
+#include "WeightPacking.hpp"
+
+#include <Permute.hpp>
+
+#include <armnn/TypesUtils.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/cast.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+namespace
+{
+
+/// A group of connected layers sharing a layout (see OptimizeLayout()).
+struct Region
+{
+    std::vector<Layer*> m_Layers;
+    DataLayout m_Layout = DataLayout::NCHW;
+};
+
+/// Tensors crossing the boundary of a region, each with the input slots it feeds on the other side.
+struct RegionBoundary
+{
+    using Crossing = std::pair<OutputSlot*, std::vector<InputSlot*>>;
+
+    /// Produced outside the region, consumed inside.
+    std::vector<Crossing> m_Inputs;
+    /// Produced inside the region, consumed outside.
+    std::vector<Crossing> m_Outputs;
+};
+
+using RegionMap = std::unordered_map<const Layer*, unsigned int>;
+
+const char* GetLayoutName(DataLayout layout)
+{
+    return layout == DataLayout::NHWC ? "nhwc" : "nchw";
+}
+
+/// The permutation taking 4D tensors, and the weights of convolutions, from one layout to the other.
+PermutationVector GetLayoutPermutation(DataLayout from, DataLayout to)
+{
+    BOOST_ASSERT(from != to);
+    // Each dimension goes where the destination layout puts it: NCHW to NHWC moves C to 3, H to 1 and W to 2.
+    return from == DataLayout::NCHW ? PermutationVector({ 0, 3, 1, 2 }) : PermutationVector({ 0, 2, 3, 1 });
+}
+
+/// The permutation applying first then second.
+PermutationVector Compose(const PermutationVector& first, const PermutationVector& second)
+{
+    BOOST_ASSERT(first.GetSize() == second.GetSize());
+    PermutationVector::ValueType mappings[MaxNumOfTensorDimensions] = {};
+    for (unsigned int i = 0; i < first.GetSize(); ++i)
+    {
+        mappings[i] = second[first[i]];
+    }
+    return PermutationVector(mappings, first.GetSize());
+}
+
+bool IsIdentity(const PermutationVector& permutation)
+{
+    for (unsigned int i = 0; i < permutation.GetSize(); ++i)
+    {
+        if (permutation[i] != i)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+const PermuteLayer* AsPermute(const Layer& layer)
+{
+    return layer.GetType() == LayerType::Permute ? boost::polymorphic_downcast<const PermuteLayer*>(&layer) : nullptr;
+}
+
+/// Removes the Permute layer or merges it with the one producing its input. Returns the number of layers removed.
+unsigned int CancelPermute(Graph& graph, PermuteLayer& permute)
+{
+    OutputSlot* const source = permute.GetInputSlot(0).GetConnectedOutputSlot();
+    if (source == nullptr)
+    {
+        return 0;
+    }
+
+    PermuteLayer* const previous = source->GetOwningLayer().GetType() == LayerType::Permute ?
+        boost::polymorphic_downcast<PermuteLayer*>(&source->GetOwningLayer()) : nullptr;
+    OutputSlot* const previousSource = previous != nullptr ?
+        previous->GetInputSlot(0).GetConnectedOutputSlot() : nullptr;
+    if (previous != nullptr && previousSource == nullptr)
+    {
+        return 0;
+    }
+
+    const PermutationVector permutation = previous != nullptr ?
+        Compose(previous->GetPermutation(), permute.GetPermutation()) : permute.GetPermutation();
+
+    if (IsIdentity(permutation))
+    {
+        // The consumers take the tensor from before the permutations.
+        permute.GetOutputSlot(0).MoveAllConnections(previous != nullptr ? *previousSource : *source);
+        graph.EraseLayer(&permute);
+        if (previous != nullptr && previous->GetOutputSlot(0).GetNumConnections() == 0)
+        {
+            graph.EraseLayer(previous);
+            return 2;
+        }
+        return 1;
+    }
+
+    if (previous != nullptr && source->GetNumConnections() == 1)
+    {
+        // A single permutation does the work of both.
+        permute.SetParameters(PermuteDescriptor(permutation));
+        permute.AddRelatedLayerName(previous->GetName());
+        source->Disconnect(permute.GetInputSlot(0));
+        previousSource->Connect(permute.GetInputSlot(0));
+        graph.EraseLayer(previous);
+        return 1;
+    }
+
+    return 0;
+}
+
+/// The layout the layer interprets its 4D tensors in. Returns false for layers which don't depend on it.
+bool GetDataLayout(const Layer& layer, DataLayout& layout)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::BatchNormalization:
+            layout = boost::polymorphic_downcast<const BatchNormalizationLayer*>(&layer)->GetParameters().m_DataLayout;
+            return true;
+        case LayerType::Convolution2d:
+            layout = boost::polymorphic_downcast<const Convolution2dLayer*>(&layer)->GetParameters().m_DataLayout;
+            return true;
+        case LayerType::DepthwiseConvolution2d:
+            layout = boost::polymorphic_downcast<const DepthwiseConvolution2dLayer*>(&layer)->GetParameters()
+                .m_DataLayout;
+            return true;
+        case LayerType::Normalization:
+            layout = boost::polymorphic_downcast<const NormalizationLayer*>(&layer)->GetParameters().m_DataLayout;
+            return true;
+        case LayerType::Pooling2d:
+            layout = boost::polymorphic_downcast<const Pooling2dLayer*>(&layer)->GetParameters().m_DataLayout;
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool Is4d(const OutputSlot& slot)
+{
+    return slot.IsTensorInfoSet() && slot.GetTensorInfo().GetNumDimensions() == 4;
+}
+
+/// Whether the layer can be part of a region: it has a single 4D input and output, and computes the same thing
+/// in either layout once its descriptor says so (or whatever the layout, for element-wise layers).
+bool IsConvertible(const Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Activation:
+        case LayerType::BatchNormalization:
+        case LayerType::Convolution2d:
+        case LayerType::DepthwiseConvolution2d:
+        case LayerType::Normalization:
+        case LayerType::Pooling2d:
+        {
+            const OutputSlot* const source = layer.GetInputSlot(0).GetConnectedOutputSlot();
+            return source != nullptr && Is4d(*source) && Is4d(layer.GetOutputSlot(0));
+        }
+        default:
+            return false;
+    }
+}
+
+/// Groups the convertible layers into regions, in topological order. Regions whose layers don't agree on a
+/// layout (which the shapes of the tensors may allow) are left out, as are those without any layer depending on
+/// the layout.
+std::vector<Region> FindRegions(const Graph& graph, RegionMap& regionOf)
+{
+    std::vector<Region> regions;
+    std::unordered_map<const Layer*, bool> visited;
+
+    for (Layer* seed : graph.TopologicalSort())
+    {
+        if (visited[seed] || !IsConvertible(*seed))
+        {
+            continue;
+        }
+
+        Region region;
+        bool hasLayout = false;
+        bool isConsistent = true;
+
+        std::vector<Layer*> toVisit = { seed };
+        visited[seed] = true;
+        while (!toVisit.empty())
+        {
+            Layer* const layer = toVisit.back();
+            toVisit.pop_back();
+            region.m_Layers.push_back(layer);
+
+            DataLayout layout;
+            if (GetDataLayout(*layer, layout))
+            {
+                isConsistent = isConsistent && (!hasLayout || layout == region.m_Layout);
+                region.m_Layout = layout;
+                hasLayout = true;
+            }
+
+            auto visit = [&](Layer& neighbour)
+            {
+                if (!visited[&neighbour] && IsConvertible(neighbour))
+                {
+                    visited[&neighbour] = true;
+                    toVisit.push_back(&neighbour);
+                }
+            };
+            visit(layer->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer());
+            for (InputSlot* consumer : layer->GetOutputSlot(0).GetConnections())
+            {
+                visit(consumer->GetOwningLayer());
+            }
+        }
+
+        if (hasLayout && isConsistent)
+        {
+            for (const Layer* layer : region.m_Layers)
+            {
+                regionOf[layer] = boost::numeric_cast<unsigned int>(regions.size());
+            }
+            regions.push_back(std::move(region));
+        }
+    }
+    return regions;
+}
+
+RegionBoundary GetBoundary(const Region& region, unsigned int regionIndex, const RegionMap& regionOf)
+{
+    auto isInRegion = [&](const Layer& layer)
+    {
+        auto it = regionOf.find(&layer);
+        return it != regionOf.end() && it->second == regionIndex;
+    };
+
+    RegionBoundary boundary;
+    for (Layer* layer : region.m_Layers)
+    {
+        InputSlot& input = layer->GetInputSlot(0);
+        OutputSlot* const source = input.GetConnectedOutputSlot();
+        if (!isInRegion(source->GetOwningLayer()))
+        {
+            auto it = std::find_if(boundary.m_Inputs.begin(), boundary.m_Inputs.end(),
+                                   [source](const RegionBoundary::Crossing& crossing)
+                                   {
+                                       return crossing.first == source;
+                                   });
+            if (it == boundary.m_Inputs.end())
+            {
+                boundary.m_Inputs.emplace_back(source, std::vector<InputSlot*>());
+                it = std::prev(boundary.m_Inputs.end());
+            }
+            it->second.push_back(&input);
+        }
+
+        OutputSlot& output = layer->GetOutputSlot(0);
+        std::vector<InputSlot*> outsideConsumers;
+        for (InputSlot* consumer : output.GetConnections())
+        {
+            if (!isInRegion(consumer->GetOwningLayer()))
+            {
+                outsideConsumers.push_back(consumer);
+            }
+        }
+        if (!outsideConsumers.empty())
+        {
+            boundary.m_Outputs.emplace_back(&output, std::move(outsideConsumers));
+        }
+    }
+    return boundary;
+}
+
+/// Change in the cost of the graph if the region was converted to the other layout, including the Permutes
+/// inserted at its boundary and those cancelling with them.
+double GetConversionCost(const Region& region,
+                         unsigned int regionIndex,
+                         const RegionMap& regionOf,
+                         const LayoutCostModel& costModel)
+{
+    const DataLayout from = region.m_Layout;
+    const DataLayout to = from == DataLayout::NCHW ? DataLayout::NHWC : DataLayout::NCHW;
+    const PermutationVector toRegion = GetLayoutPermutation(from, to);
+    const PermutationVector fromRegion = GetLayoutPermutation(to, from);
+
+    double cost = 0.0;
+    for (const Layer* layer : region.m_Layers)
+    {
+        cost += costModel.GetLayerCost(*layer, to) - costModel.GetLayerCost(*layer, from);
+    }
+
+    const RegionBoundary boundary = GetBoundary(region, regionIndex, regionOf);
+    for (const RegionBoundary::Crossing& input : boundary.m_Inputs)
+    {
+        const OutputSlot& source = *input.first;
+        const double permuteCost = costModel.GetPermuteCost(source.GetTensorInfo().GetShape());
+        const bool onlyFeedsRegion = source.GetNumConnections() == input.second.size();
+
+        // The Permute inserted either cancels or merges with a Permute producing the tensor, when the tensor is
+        // used by nothing else.
+        const PermuteLayer* const previous = AsPermute(source.GetOwningLayer());
+        if (previous != nullptr && IsIdentity(Compose(previous->GetPermutation(), toRegion)))
+        {
+            cost -= onlyFeedsRegion ? permuteCost : 0.0;
+        }
+        else if (previous == nullptr || !onlyFeedsRegion)
+        {
+            cost += permuteCost;
+        }
+    }
+
+    for (const RegionBoundary::Crossing& output : boundary.m_Outputs)
+    {
+        const double permuteCost = costModel.GetPermuteCost(output.first->GetTensorInfo().GetShape());
+
+        // Permute consumers get a Permute of their own, which cancels or merges with them. The others share one.
+        bool hasOtherConsumers = false;
+        for (const InputSlot* consumer : output.second)
+        {
+            const PermuteLayer* const next = AsPermute(consumer->GetOwningLayer());
+            if (next == nullptr)
+            {
+                hasOtherConsumers = true;
+            }
+            else if (IsIdentity(Compose(fromRegion, next->GetPermutation())))
+            {
+                cost -= permuteCost;
+            }
+        }
+        cost += hasOtherConsumers ? permuteCost : 0.0;
+    }
+    return cost;
+}
+
+ConstTensor PermuteConstant(ConstantPool& constantPool, const ConstTensor& tensor, const PermutationVector& mappings)
+{
+    TensorInfo info = tensor.GetInfo();
+    info.SetShape(Permuted(info.GetShape(), mappings));
+
+    ConstantPool::Buffer data(info.GetNumBytes());
+    Permute(info.GetShape(), mappings, tensor.GetMemoryArea(), data.data(), GetDataTypeSize(info.GetDataType()));
+    return constantPool.Add(info, std::move(data));
+}
+
+template <typename LayerT>
+LayerT& SetDataLayout(Layer& layer, DataLayout layout)
+{
+    auto& typedLayer = *boost::polymorphic_downcast<LayerT*>(&layer);
+    auto descriptor = typedLayer.GetParameters();
+    descriptor.m_DataLayout = layout;
+    typedLayer.SetParameters(descriptor);
+    return typedLayer;
+}
+
+/// Switches the layer to the other layout, leaving its connections alone.
+void ConvertLayer(Graph& graph, Layer& layer, DataLayout to, const PermutationVector& toRegion)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::BatchNormalization:
+            SetDataLayout<BatchNormalizationLayer>(layer, to);
+            break;
+        case LayerType::Convolution2d:
+        {
+            // The weights are [O, I, H, W] for NCHW and [O, H, W, I] for NHWC: the tensors' own permutation.
+            auto& convLayer = SetDataLayout<Convolution2dLayer>(layer, to);
+            UnpackWeight(graph, convLayer);
+            convLayer.m_Weight = PermuteConstant(graph.GetConstantPool(), convLayer.m_Weight, toRegion);
+            convLayer.m_WinogradWeight = ConstTensor();
+            convLayer.m_PackedWeight = ConstTensor();
+            convLayer.m_PackedWeightLayout = PackedWeightLayout::None;
+            break;
+        }
+        case LayerType::DepthwiseConvolution2d:
+            // The weights are [M, C, H, W] in both layouts.
+            SetDataLayout<DepthwiseConvolution2dLayer>(layer, to);
+            break;
+        case LayerType::Normalization:
+            SetDataLayout<NormalizationLayer>(layer, to);
+            break;
+        case LayerType::Pooling2d:
+            SetDataLayout<Pooling2dLayer>(layer, to);
+            break;
+        default:
+            // Element-wise, the same in any layout.
+            break;
+    }
+
+    OutputSlot& output = layer.GetOutputSlot(0);
+    TensorInfo info = output.GetTensorInfo();
+    info.SetShape(Permuted(info.GetShape(), toRegion));
+    output.SetTensorInfo(info);
+}
+
+/// Adds a Permute layer reading source and feeding the consumers instead of it.
+void InsertPermute(Graph& graph,
+                   OutputSlot& source,
+                   const std::vector<InputSlot*>& consumers,
+                   const PermutationVector& permutation,
+                   DataLayout to)
+{
+    const std::string sourceName = source.GetOwningLayer().GetNameStr();
+    const std::string name = (sourceName.empty() ? "" : sourceName + "/") + "permute_to_" + GetLayoutName(to);
+    PermuteLayer* const permute = graph.AddLayer<PermuteLayer>(PermuteDescriptor(permutation), name.c_str());
+
+    TensorInfo info = source.GetTensorInfo();
+    info.SetShape(Permuted(info.GetShape(), permutation));
+    permute->GetOutputSlot(0).SetTensorInfo(info);
+
+    source.Connect(permute->GetInputSlot(0));
+    for (InputSlot* consumer : consumers)
+    {
+        source.Disconnect(*consumer);
+        permute->GetOutputSlot(0).Connect(*consumer);
+    }
+}
+
+void ConvertRegion(Graph& graph, Region& region, unsigned int regionIndex, const RegionMap& regionOf)
+{
+    const DataLayout from = region.m_Layout;
+    const DataLayout to = from == DataLayout::NCHW ? DataLayout::NHWC : DataLayout::NCHW;
+    const PermutationVector toRegion = GetLayoutPermutation(from, to);
+    const PermutationVector fromRegion = GetLayoutPermutation(to, from);
+
+    const RegionBoundary boundary = GetBoundary(region, regionIndex, regionOf);
+
+    for (Layer* layer : region.m_Layers)
+    {
+        ConvertLayer(graph, *layer, to, toRegion);
+    }
+    region.m_Layout = to;
+
+    for (const RegionBoundary::Crossing& input : boundary.m_Inputs)
+    {
+        InsertPermute(graph, *input.first, input.second, toRegion, to);
+    }
+
+    for (const RegionBoundary::Crossing& output : boundary.m_Outputs)
+    {
+        // Permute consumers get a Permute of their own so that CancelPermutes() can fold it into them.
+        std::vector<InputSlot*> otherConsumers;
+        for (InputSlot* consumer : output.second)
+        {
+            if (consumer->GetOwningLayer().GetType() == LayerType::Permute)
+            {
+                InsertPermute(graph, *output.first, { consumer }, fromRegion, from);
+            }
+            else
+            {
+                otherConsumers.push_back(consumer);
+            }
+        }
+        if (!otherConsumers.empty())
+        {
+            InsertPermute(graph, *output.first, otherConsumers, fromRegion, from);
+        }
+    }
+}
+
+} // namespace
+
+double LayoutCostModel::GetLayerCost(const Layer& layer, DataLayout layout) const
+{
+    const double numOutputs = layer.GetOutputSlot(0).GetTensorInfo().GetNumElements();
+
+    switch (layer.GetType())
+    {
+        case LayerType::Convolution2d:
+        {
+            const TensorShape& weightShape =
+                boost::polymorphic_downcast<const Convolution2dLayer*>(&layer)->m_Weight.GetShape();
+            return numOutputs * (weightShape.GetNumElements() / weightShape[0]);
+        }
+        case LayerType::DepthwiseConvolution2d:
+        {
+            // Weights [M, C, H, W].
+            const TensorShape& weightShape =
+                boost::polymorphic_downcast<const DepthwiseConvolution2dLayer*>(&layer)->m_Weight.GetShape();
+            const bool isVectorized = layout == DataLayout::NHWC && weightShape[0] == 1;
+            return numOutputs * weightShape[2] * weightShape[3] * (isVectorized ? 1.0 : m_GenericDepthwiseSlowdown);
+        }
+        case LayerType::Normalization:
+        {
+            const auto& normLayer = *boost::polymorphic_downcast<const NormalizationLayer*>(&layer);
+            return numOutputs * normLayer.GetParameters().m_NormSize;
+        }
+        case LayerType::Pooling2d:
+        {
+            // Global pooling reads the whole input.
+            const Pooling2dDescriptor& descriptor =
+                boost::polymorphic_downcast<const Pooling2dLayer*>(&layer)->GetParameters();
+            if (descriptor.m_StrideX == 0 && descriptor.m_StrideY == 0)
+            {
+                return layer.GetInputSlot(0).GetConnectedOutputSlot()->GetTensorInfo().GetNumElements();
+            }
+            return numOutputs * descriptor.m_PoolWidth * descriptor.m_PoolHeight;
+        }
+        default:
+            return numOutputs;
+    }
+}
+
+double LayoutCostModel::GetPermuteCost(const TensorShape& shape) const
+{
+    return m_PermuteCostPerElement * shape.GetNumElements();
+}
+
+unsigned int CancelPermutes(Graph& graph)
+{
+    // Collected first: erasing layers reorganizes the storage of the graph. Each Permute is only merged into the
+    // next one, so the Permutes erased have been processed already.
+    std::vector<PermuteLayer*> permutes;
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        if (layer->GetType() == LayerType::Permute)
+        {
+            permutes.push_back(boost::polymorphic_downcast<PermuteLayer*>(layer));
+        }
+    }
+
+    unsigned int numRemoved = 0;
+    for (PermuteLayer* permute : permutes)
+    {
+        numRemoved += CancelPermute(graph, *permute);
+    }
+
+    if (numRemoved != 0)
+    {
+        graph.SetMemoryPlan(MemoryPlan());
+    }
+    return numRemoved;
+}
+
+unsigned int OptimizeLayout(Graph& graph, LayoutSelection selection, const LayoutCostModel& costModel)
+{
+    CancelPermutes(graph);
+
+    RegionMap regionOf;
+    std::vector<Region> regions = FindRegions(graph, regionOf);
+
+    // With a single layout for the graph, the one for which converting the regions using the other is cheaper.
+    DataLayout graphLayout = DataLayout::NCHW;
+    if (selection == LayoutSelection::WholeGraph)
+    {
+        double toNchwCost = 0.0;
+        double toNhwcCost = 0.0;
+        for (unsigned int i = 0; i < regions.size(); ++i)
+        {
+            double& cost = regions[i].m_Layout == DataLayout::NCHW ? toNhwcCost : toNchwCost;
+            cost += GetConversionCost(regions[i], i, regionOf, costModel);
+        }
+        graphLayout = toNhwcCost < toNchwCost ? DataLayout::NHWC : DataLayout::NCHW;
+    }
+
+    unsigned int numConverted = 0;
+    for (unsigned int i = 0; i < regions.size(); ++i)
+    {
+        // The cost of a region depends on the Permutes around it, so it is evaluated once the regions before it
+        // are settled.
+        const bool convert = selection == LayoutSelection::WholeGraph ?
+            regions[i].m_Layout != graphLayout :
+            GetConversionCost(regions[i], i, regionOf, costModel) < 0.0;
+        if (convert)
+        {
+            ConvertRegion(graph, regions[i], i, regionOf);
+            CancelPermutes(graph);
+            ++numConverted;
+        }
+    }
+
+    if (numConverted != 0)
+    {
+        graph.SetMemoryPlan(MemoryPlan());
+    }
+    return numConverted;
+}
+
+} // namespace armnn
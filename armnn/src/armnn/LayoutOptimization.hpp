@@ -0,0 +1,75 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+namespace armnn
+{
+
+class Graph;
+class Layer;
+
+/// Estimates of the time spent running layers in a given data layout and permuting tensors between layouts, used
+/// by OptimizeLayout() to choose the layout of each part of a graph. Costs are in arbitrary units which only need
+/// to be consistent with each other. The defaults reflect the kernels of the reference backend.
+class LayoutCostModel
+{
+public:
+    virtual ~LayoutCostModel() = default;
+
+    /// Cost of running the layer (a Convolution2d, DepthwiseConvolution2d, Pooling2d, Normalization,
+    /// BatchNormalization or Activation layer on 4D tensors) with its tensors in the given layout.
+    /// By default the number of multiply-accumulates or comparisons it makes, whatever the layout, except for
+    /// depthwise convolutions which are m_GenericDepthwiseSlowdown times as costly unless they can use the
+    /// vectorized NHWC kernel.
+    virtual double GetLayerCost(const Layer& layer, DataLayout layout) const;
+
+    /// Cost of a Permute layer producing a tensor of the given shape.
+    virtual double GetPermuteCost(const TensorShape& shape) const;
+
+    /// Cost of permuting one element, relative to a multiply-accumulate: the reads or the writes are strided.
+    double m_PermuteCostPerElement = 4.0;
+
+    /// How much slower the generic depthwise convolution is than the NHWC kernel for a depth multiplier of 1.
+    double m_GenericDepthwiseSlowdown = 16.0;
+};
+
+/// How OptimizeLayout() assigns layouts.
+enum class LayoutSelection
+{
+    /// Each region gets the layout that is the cheapest for it, given the layouts of the layers around it.
+    PerRegion,
+    /// All the regions get the same layout, the one that is the cheapest for the graph as a whole.
+    WholeGraph
+};
+
+/// Simplifies the chains of Permute layers: a Permute followed by its inverse is removed (the consumers of the
+/// second take the input of the first, which is also removed if it has no other consumer), a Permute whose only
+/// consumer is another Permute is merged into it, and the Permutes which leave tensors unchanged are removed.
+/// The memory plan of the graph is invalidated if any layer is removed.
+/// @return The number of Permute layers removed.
+unsigned int CancelPermutes(Graph& graph);
+
+/// Chooses the data layout, NCHW or NHWC, of the layers which work on 4D tensors in either, so as to minimize
+/// the cost of the graph according to the cost model. The TensorInfos of the graph must be set.
+///
+/// The graph is split into regions: the largest groups of connected Convolution2d, DepthwiseConvolution2d,
+/// Pooling2d, Normalization, BatchNormalization and Activation layers on 4D tensors, which therefore all share a
+/// layout. Converting a region to the other layout changes the descriptors of its layers (and transposes the
+/// weights of its convolutions) and puts a Permute layer on each tensor crossing its boundary. These then cancel
+/// with the Permutes already there (see CancelPermutes()), so that a region surrounded by layout conversions, as
+/// imported from a framework using the other layout, ends up with none. Regions are converted when that lowers
+/// the cost, the Permutes inserted or removed included, one after the other in topological order.
+/// The TensorInfos of the converted layers are updated, and the memory plan of the graph is invalidated if the
+/// graph changes. The layers outside the regions keep the layout of their tensors, so the network computes the
+/// same results.
+/// @return The number of regions whose layout was changed.
+unsigned int OptimizeLayout(Graph& graph,
+                            LayoutSelection selection = LayoutSelection::PerRegion,
+                            const LayoutCostModel& costModel = LayoutCostModel());
+
+} // namespace armnn
@@ -0,0 +1,174 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "MemoryPlanner.hpp"
+
+#include "Graph.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// An intermediate tensor to place in the arena.
+struct TensorUsage
+{
+    OutputSlot* m_Slot;
+    std::size_t m_Size;
+    /// Lifetime, as positions in the execution order (inclusive).
+    std::size_t m_First;
+    std::size_t m_Last;
+    std::size_t m_Offset;
+};
+
+bool IsBoundToUserBuffer(const OutputSlot& outputSlot)
+{
+    // The output of a constant layer is read straight from its constant tensor.
+    const LayerType type = outputSlot.GetOwningLayer().GetType();
+    if (type == LayerType::Input || type == LayerType::Constant)
+    {
+        return true;
+    }
+    for (const InputSlot* connection : outputSlot.GetConnections())
+    {
+        if (connection->GetOwningLayer().GetType() == LayerType::Output)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// The tensors alive at the current point of the execution, by offset.
+using LiveTensors = std::multimap<std::size_t, const TensorUsage*>;
+
+/// Returns the offset at which a tensor of the given size fits between the live tensors. Picks the smallest gap that
+/// fits (best fit) to keep large gaps for later tensors, and the end of the live tensors if none does.
+std::size_t FindOffset(const LiveTensors& live, std::size_t size)
+{
+    std::size_t bestOffset = 0;
+    std::size_t bestGap    = std::numeric_limits<std::size_t>::max();
+    std::size_t end        = 0;
+
+    for (auto&& placed : live)
+    {
+        if (placed.first >= end)
+        {
+            const std::size_t gap = placed.first - end;
+            if (gap >= size && gap < bestGap)
+            {
+                bestGap    = gap;
+                bestOffset = end;
+            }
+        }
+        end = std::max(end, placed.first + placed.second->m_Size);
+    }
+
+    // Past the last tensor only wins when no gap fits.
+    return bestGap != std::numeric_limits<std::size_t>::max() ? bestOffset : end;
+}
+
+} // namespace
+
+MemoryPlan PlanActivationMemory(Graph& graph, std::size_t alignment)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+        throw InvalidArgumentException("The alignment of the activation arena must be a power of two");
+    }
+
+    std::unordered_map<const Layer*, std::size_t> positions;
+    positions.reserve(graph.GetNumLayers());
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        positions.emplace(layer, positions.size());
+    }
+
+    std::vector<TensorUsage> tensors;
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        const std::size_t position = positions.at(layer);
+
+        for (auto outputSlot = layer->BeginOutputSlots(); outputSlot != layer->EndOutputSlots(); ++outputSlot)
+        {
+            outputSlot->SetMemoryOffset(InvalidMemoryOffset);
+            if (IsBoundToUserBuffer(*outputSlot))
+            {
+                continue;
+            }
+
+            if (!outputSlot->IsTensorInfoSet())
+            {
+                throw LayerValidationException(
+                    boost::str(boost::format("Cannot plan the memory of %1% layer %2%: "
+                                             "the TensorInfo of output slot %3% is not set")
+                               % GetLayerTypeAsCString(layer->GetType())
+                               % layer->GetNameStr()
+                               % outputSlot->CalculateIndexOnOwner()));
+            }
+
+            // Unconnected outputs are still written, they only live while their layer runs.
+            std::size_t last = position;
+            for (const InputSlot* connection : outputSlot->GetConnections())
+            {
+                last = std::max(last, positions.at(&connection->GetOwningLayer()));
+            }
+
+            const std::size_t size = (outputSlot->GetTensorInfo().GetNumBytes() + alignment - 1) & ~(alignment - 1);
+            tensors.push_back({ &*outputSlot, size, position, last, InvalidMemoryOffset });
+        }
+    }
+
+    // In execution order, largest first among the tensors produced by the same layer.
+    std::stable_sort(tensors.begin(), tensors.end(), [](const TensorUsage& lhs, const TensorUsage& rhs)
+    {
+        return lhs.m_First != rhs.m_First ? lhs.m_First < rhs.m_First : lhs.m_Size > rhs.m_Size;
+    });
+
+    MemoryPlan plan;
+    plan.m_Alignment = alignment;
+
+    // Only the tensors still alive constrain the placement: the others are dropped as the execution passes their
+    // last reader, which keeps each placement proportional to the number of live tensors.
+    using Expiry = std::pair<std::size_t, LiveTensors::iterator>;
+    auto laterExpiry = [](const Expiry& lhs, const Expiry& rhs) { return lhs.first > rhs.first; };
+    std::priority_queue<Expiry, std::vector<Expiry>, decltype(laterExpiry)> expiries(laterExpiry);
+    LiveTensors live;
+
+    for (TensorUsage& tensor : tensors)
+    {
+        while (!expiries.empty() && expiries.top().first < tensor.m_First)
+        {
+            live.erase(expiries.top().second);
+            expiries.pop();
+        }
+
+        tensor.m_Offset = FindOffset(live, tensor.m_Size);
+        BOOST_ASSERT(tensor.m_Offset % alignment == 0);
+        tensor.m_Slot->SetMemoryOffset(tensor.m_Offset);
+        expiries.emplace(tensor.m_Last, live.emplace(tensor.m_Offset, &tensor));
+
+        plan.m_ArenaSize = std::max(plan.m_ArenaSize, tensor.m_Offset + tensor.m_Size);
+        plan.m_TotalTensorSize += tensor.m_Size;
+    }
+
+    graph.SetMemoryPlan(plan);
+    return plan;
+}
+
+} // namespace armnn
@@ -0,0 +1,50 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <cstddef>
+#include <limits>
+
+namespace armnn
+{
+
+class Graph;
+
+/// Marks an output slot whose tensor doesn't live in the activation arena (see PlanActivationMemory()).
+constexpr std::size_t InvalidMemoryOffset = std::numeric_limits<std::size_t>::max();
+
+/// Placement of the intermediate tensors of a graph in a single block of memory.
+struct MemoryPlan
+{
+    /// Size, in bytes, of the arena holding all the planned tensors.
+    std::size_t m_ArenaSize = 0;
+    /// Alignment, in bytes, of the offsets within the arena (0 if the graph has not been planned).
+    std::size_t m_Alignment = 0;
+    /// Sum of the (aligned) sizes of the planned tensors, i.e. the memory they would need without any reuse.
+    std::size_t m_TotalTensorSize = 0;
+
+    bool IsValid() const { return m_Alignment != 0; }
+};
+
+/// Default alignment of the tensors in the activation arena, in bytes.
+constexpr std::size_t DefaultActivationAlignment = 64;
+
+/// Assigns every intermediate tensor of the graph an offset in a shared arena, so that tensors which are never
+/// alive at the same time share memory.
+///
+/// Layers are assumed to execute in the topological order of the graph: the tensor of an output slot is alive
+/// from the layer producing it to the last layer reading it. Tensors are placed greedily in that order, each in the
+/// smallest gap between the tensors alive at the same time which fits it (best fit), or after them if none does.
+///
+/// The outputs of input layers and the outputs connected to output layers are bound to user buffers and are not
+/// planned, nor are the outputs of constant layers, read from their constant tensor. All the other output slots
+/// must have their TensorInfo set. The offsets are recorded on the output slots (OutputSlot::GetMemoryOffset())
+/// and the plan on the graph (Graph::GetMemoryPlan()); they describe the graph as it is when planned and need
+/// computing again if it changes.
+///
+/// @param alignment Alignment of every tensor within the arena, in bytes (a power of two).
+MemoryPlan PlanActivationMemory(Graph& graph, std::size_t alignment = DefaultActivationAlignment);
+
+} // namespace armnn
@@ -4,9 +4,11 @@
 //
 
 #include "Network.hpp"
-//#include "Graph.hpp"
+#include "Graph.hpp"
 #include "Layer.hpp"
+#include "LayersFwd.hpp"
 
+#include <armnn/WeightSource.hpp>
 
 #include <fcntl.h>
 #include <algorithm>
@@ -58,10 +60,7 @@ Network::~Network()
 
 IConnectableLayer* Network::AddInputLayer(LayerBindingId id, const char* name)
 {
-    //return m_Graph->AddLayer<InputLayer>(id, name);
-    Layer l=new InputLayer(id,name);
-    m_Graph.push_back(l);
-    return l;
+    return m_Graph->AddLayer<InputLayer>(id, name);
 }
 
 
@@ -75,17 +74,20 @@ IConnectableLayer* Network::AddFullyConnectedLayerImpl(const FullyConnectedDescr
         throw InvalidArgumentException("AddFullyConnectedLayer: biases cannot be NULL");
     }
 
-    //const auto layer = m_Graph->AddLayer<FullyConnectedLayer>(fullyConnectedDescriptor, name);
-    Layer layer=new FullyConnectedLayer(fullyConnectedDescriptor,name);
-    layer->m_Weight = weights;
+    const auto layer = m_Graph->AddLayer<FullyConnectedLayer>(fullyConnectedDescriptor, name);
+
+    // The pool keeps a copy of the data, shared with any identical tensor of the network.
+    ConstantPool& constantPool = m_Graph->GetConstantPool();
+
+    layer->m_Weight = constantPool.Add(weights);
 
     if (fullyConnectedDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = *biases;
+        layer->m_Bias = constantPool.Add(*biases);
     }
-    m_Graph.push_back(layer);
+
     return layer;
-} 
+}
 
 IConnectableLayer* Network::AddFullyConnectedLayer(const FullyConnectedDescriptor& fullyConnectedDescriptor,
                                                    const ConstTensor& weights,
@@ -112,15 +114,18 @@ IConnectableLayer* Network::AddConvolution2dLayerImpl(const Convolution2dDescrip
         throw InvalidArgumentException("AddConvolution2dLayer: biases cannot be NULL");
     }
 
-    //const auto layer = m_Graph->AddLayer<Convolution2dLayer>(convolution2dDescriptor, name);
-    Layer layer = new Convolution2dLayer(convolution2dDescriptor,name);
-    layer->m_Weight = weights;
+    const auto layer = m_Graph->AddLayer<Convolution2dLayer>(convolution2dDescriptor, name);
+
+    // The pool keeps a copy of the data, shared with any identical tensor of the network.
+    ConstantPool& constantPool = m_Graph->GetConstantPool();
+
+    layer->m_Weight = constantPool.Add(weights);
 
     if (convolution2dDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = *biases;
+        layer->m_Bias = constantPool.Add(*biases);
     }
-    layer.push_back(layer);
+
     return layer;
 }
 
@@ -149,15 +154,17 @@ IConnectableLayer* Network::AddDepthwiseConvolution2dLayerImpl(
         throw InvalidArgumentException("AddDepthwiseConvolution2dLayer: biases cannot be NULL");
     }
 
-    //const auto layer = m_Graph->AddLayer<DepthwiseConvolution2dLayer>(convolution2dDescriptor, name);
-    Layer layer = new DepthwiseConvolution2dLayer(convolution2dDescriptor,name);
-    layer->m_Weight = weights;
+    const auto layer = m_Graph->AddLayer<DepthwiseConvolution2dLayer>(convolution2dDescriptor, name);
+
+    // The pool keeps a copy of the data, shared with any identical tensor of the network.
+    ConstantPool& constantPool = m_Graph->GetConstantPool();
+
+    layer->m_Weight = constantPool.Add(weights);
 
     if (convolution2dDescriptor.m_BiasEnabled)
     {
-        layer->m_Bias = *biases;
+        layer->m_Bias = constantPool.Add(*biases);
     }
-    m_Graph.push_back(layer);
 
     return layer;
 }
@@ -178,21 +185,51 @@ IConnectableLayer* Network::AddDepthwiseConvolution2dLayer(
     return AddDepthwiseConvolution2dLayerImpl(convolution2dDescriptor, weights, &biases, name);
 }
 
+IConnectableLayer* Network::AddPermuteLayer(const PermuteDescriptor& permuteDescriptor,
+    const char* name)
+{
+    return m_Graph->AddLayer<PermuteLayer>(permuteDescriptor, name);
+}
 
 IConnectableLayer* Network::AddPooling2dLayer(const Pooling2dDescriptor& pooling2dDescriptor,
     const char* name)
 {
-   // return m_Graph->AddLayer<Pooling2dLayer>(pooling2dDescriptor, name);
-   Layer layer = new Pooling2dLayer(pooling2dDescriptor,name);
-   return layer;
+    return m_Graph->AddLayer<Pooling2dLayer>(pooling2dDescriptor, name);
 }
 
 IConnectableLayer* Network::AddActivationLayer(const ActivationDescriptor& activationDescriptor,
     const char* name)
 {
-    //return m_Graph->AddLayer<ActivationLayer>(activationDescriptor, name);
-    Layer layer=new ActivationLayer(activationDescriptor,name);
-    m_Graph.push_back(layer);
+    return m_Graph->AddLayer<ActivationLayer>(activationDescriptor, name);
+}
+
+IConnectableLayer* Network::AddBatchNormalizationLayer(const BatchNormalizationDescriptor& desc,
+                                                       const ConstTensor& mean,
+                                                       const ConstTensor& variance,
+                                                       const ConstTensor& beta,
+                                                       const ConstTensor& gamma,
+                                                       const char* name)
+{
+    const auto layer = m_Graph->AddLayer<BatchNormalizationLayer>(desc, name);
+
+    ConstantPool& constantPool = m_Graph->GetConstantPool();
+
+    layer->m_Mean     = constantPool.Add(mean);
+    layer->m_Variance = constantPool.Add(variance);
+    layer->m_Beta     = constantPool.Add(beta);
+    layer->m_Gamma    = constantPool.Add(gamma);
+
+    return layer;
+}
+
+IConnectableLayer* Network::AddConstantLayer(const ConstTensor& input, const char* name)
+{
+    const auto layer = m_Graph->AddLayer<ConstantLayer>(name);
+
+    layer->m_LayerOutput = m_Graph->GetConstantPool().Add(input);
+    layer->GetOutputSlot(0).SetTensorInfo(input.GetInfo());
+
+    return layer;
 }
 
 IConnectableLayer* Network::AddNormalizationLayer(const NormalizationDescriptor&
@@ -216,22 +253,19 @@ IConnectableLayer* Network::AddOutputLayer(LayerBindingId id, const char* name)
     return m_Graph->AddLayer<OutputLayer>(id, name);
 }
 
+ConstTensor Network::AddConstantData(const TensorInfo& tensorInfo, const WeightSource& source)
+{
+    return m_Graph->GetConstantPool().Add(tensorInfo, source);
+}
 
-// void Network::Accept(ILayerVisitor& visitor) const
-// {
-//     for (auto layer : GetGraph())
-//     {
-//         layer->Accept(visitor);
-//     };
-// }
-
-OptimizedNetwork::OptimizedNetwork(std::unique_ptr<Graph> graph)
-    : m_Graph(std::move(graph))
+void Network::SetConstantStorageDirectory(const std::string& directory)
 {
+    m_Graph->GetConstantPool().SetStorageDirectory(directory);
 }
 
-OptimizedNetwork::~OptimizedNetwork()
+void Network::InferTensorInfos()
 {
+    m_Graph->InferTensorInfos();
 }
 
 } // namespace armnn
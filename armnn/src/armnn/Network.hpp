@@ -11,9 +11,9 @@
 
 #include <armnn/INetwork.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
-#include "Layer.hpp"
 
 namespace armnn
 {
@@ -26,7 +26,8 @@ public:
     Network();
     ~Network();
 
-    // const Graph& GetGraph() const { return *m_Graph; }
+    const Graph& GetGraph() const { return *m_Graph; }
+    Graph& GetGraph() { return *m_Graph; }
 
     // Status PrintGraph() override;
 
@@ -64,6 +65,8 @@ public:
         const ConstTensor& biases,
         const char* name = nullptr) override;
 
+    IConnectableLayer* AddPermuteLayer(const PermuteDescriptor& permuteDescriptor,
+        const char* name = nullptr) override;
 
     IConnectableLayer* AddPooling2dLayer(const Pooling2dDescriptor& pooling2dDescriptor,
         const char* name = nullptr) override;
@@ -71,12 +74,35 @@ public:
     IConnectableLayer* AddActivationLayer(const ActivationDescriptor& activationDescriptor,
         const char* name = nullptr) override;
 
+    IConnectableLayer* AddBatchNormalizationLayer(const BatchNormalizationDescriptor& desc,
+        const ConstTensor& mean,
+        const ConstTensor& variance,
+        const ConstTensor& beta,
+        const ConstTensor& gamma,
+        const char* name = nullptr) override;
+
+    IConnectableLayer* AddConstantLayer(const ConstTensor& input, const char* name = nullptr) override;
+
     IConnectableLayer* AddNormalizationLayer(const NormalizationDescriptor& normalizationDescriptor,
         const char* name = nullptr) override;
 
     IConnectableLayer* AddSoftmaxLayer(const SoftmaxDescriptor& softmaxDescriptor,
         const char* name = nullptr) override;
 
+    IConnectableLayer* AddOutputLayer(LayerBindingId id, const char* name = nullptr) override;
+
+    ConstTensor AddConstantData(const TensorInfo& tensorInfo, const WeightSource& source) override;
+
+    void SetConstantStorageDirectory(const std::string& directory) override;
+
+    void InferTensorInfos() override;
+
+    /// Calls visitor.Visit() on each layer, in topological order, with the layer downcast to its class.
+    /// Defined in LayerVisitor.hpp, which describes the visitors.
+    template <typename Visitor>
+    void Accept(Visitor& visitor) const;
+    template <typename Visitor>
+    void Accept(Visitor& visitor);
 
 private:
     IConnectableLayer* AddFullyConnectedLayerImpl(const FullyConnectedDescriptor& fullyConnectedDescriptor,
@@ -95,8 +121,7 @@ private:
         const ConstTensor* biases,
         const char* name);
 
-    //std::unique_ptr<Graph> m_Graph;
-    std::vector<Layer> m_Graph;
+    std::unique_ptr<Graph> m_Graph;
 };
 
 
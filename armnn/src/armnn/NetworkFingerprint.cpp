@@ -0,0 +1,178 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "NetworkFingerprint.hpp"
+
+#include "ConstantPool.hpp"
+#include "DescriptorHash.hpp"
+#include "Graph.hpp"
+#include "LayerState.hpp"
+#include "LayerVisitor.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <Hash.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/format.hpp>
+#include <boost/utility/string_ref.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Hashes the state of each layer. Unlike in EliminateCommonSubexpressions(), the constant tensors are hashed by
+/// contents.
+class LayerHasher
+{
+public:
+    LayerHasher(const ConstantPool& constantPool, uint64_t seed)
+    : m_ConstantPool(constantPool)
+    , m_Hash(seed)
+    , m_IsKnown(false)
+    {
+    }
+
+    template <typename LayerT>
+    auto Visit(const LayerT& layer) -> decltype(GetState(layer), void())
+    {
+        ForEachField(GetState(layer), *this);
+        m_IsKnown = true;
+    }
+
+    void Visit(const Convolution2dLayer& layer) { VisitWithPackedWeight(layer); }
+    void Visit(const FullyConnectedLayer& layer) { VisitWithPackedWeight(layer); }
+    void Visit(const InputLayer& layer) { VisitBindable(layer); }
+    void Visit(const OutputLayer& layer) { VisitBindable(layer); }
+
+    template <typename Descriptor>
+    void operator()(const Descriptor& descriptor) { m_Hash = HashDescriptor(descriptor, m_Hash); }
+
+    void operator()(const ConstantId& constant)
+    {
+        m_Hash = HashTensorInfo(constant.m_Info, m_Hash);
+        if (constant.m_Data == nullptr)
+        {
+            m_Hash = armnnUtils::HashCombine(m_Hash, 0u);
+            return;
+        }
+
+        // The pool hashed its data already, with the same function; the data mapped from a file is hashed here.
+        uint64_t dataHash = m_ConstantPool.GetHash(constant.m_Data);
+        if (dataHash == 0)
+        {
+            dataHash = armnnUtils::Hash64(constant.m_Data, constant.m_Info.GetNumBytes());
+        }
+        m_Hash = armnnUtils::HashCombine(m_Hash, dataHash);
+    }
+
+    void operator()(PackedWeightLayout layout) { m_Hash = armnnUtils::HashCombine(m_Hash, uint64_t(layout)); }
+    void operator()(bool value) { m_Hash = armnnUtils::HashCombine(m_Hash, value ? 1u : 0u); }
+
+    uint64_t GetHash() const { return m_Hash; }
+    bool IsKnown() const { return m_IsKnown; }
+
+private:
+    /// Weights with a packed copy are saved and loaded as that copy only (see ISerializer): hashes the TensorInfo of
+    /// the weights but not their data, so that the network has the same fingerprint before saving and once loaded.
+    template <typename LayerT>
+    void VisitWithPackedWeight(const LayerT& layer)
+    {
+        auto state = GetState(layer);
+        ConstantId& weight = std::get<1>(state);
+        BOOST_ASSERT(weight.m_Info == layer.m_Weight.GetInfo());
+        if (layer.m_PackedWeight.GetMemoryArea() != nullptr)
+        {
+            weight.m_Data = nullptr;
+        }
+        ForEachField(state, *this);
+        m_IsKnown = true;
+    }
+
+    void VisitBindable(const BindableLayer& layer)
+    {
+        m_Hash = armnnUtils::HashCombine(m_Hash, static_cast<uint64_t>(static_cast<int64_t>(layer.GetBindingId())));
+        m_IsKnown = true;
+    }
+
+    const ConstantPool& m_ConstantPool;
+    uint64_t            m_Hash;
+    bool                m_IsKnown;
+};
+
+uint64_t HashString(boost::string_ref value, uint64_t seed)
+{
+    return armnnUtils::Hash64(value.data(), value.size(), armnnUtils::HashCombine(seed, value.size()));
+}
+
+} // namespace
+
+uint64_t ComputeFingerprint(const Graph& graph)
+{
+    // Hash of each layer, including the hashes of the layers producing its inputs.
+    std::unordered_map<const Layer*, uint64_t> layerHashes;
+    layerHashes.reserve(graph.GetNumLayers());
+
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        LayerHasher hasher(graph.GetConstantPool(), armnnUtils::HashCombine(0, uint64_t(layer->GetType())));
+        VisitLayer(*layer, hasher);
+        if (!hasher.IsKnown())
+        {
+            throw InvalidArgumentException(boost::str(boost::format("Cannot fingerprint layer %1% of type %2%")
+                                                      % layer->GetNameStr() % GetLayerTypeAsCString(layer->GetType())));
+        }
+        uint64_t hash = hasher.GetHash();
+
+        hash = HashString(graph.GetStringPool().Get(layer->GetNameId()), hash);
+
+        hash = armnnUtils::HashCombine(hash, layer->GetNumInputSlots());
+        for (auto&& inputSlot : layer->GetInputSlots())
+        {
+            const OutputSlot* const source = inputSlot.GetConnectedOutputSlot();
+            if (source == nullptr)
+            {
+                hash = armnnUtils::HashCombine(hash, ~uint64_t(0));
+                continue;
+            }
+            hash = armnnUtils::HashCombine(hash, layerHashes.at(&source->GetOwningLayer()));
+            hash = armnnUtils::HashCombine(hash, source->CalculateIndexOnOwner());
+        }
+
+        hash = armnnUtils::HashCombine(hash, layer->GetNumOutputSlots());
+        for (auto&& outputSlot : layer->GetOutputSlots())
+        {
+            hash = HashTensorInfo(outputSlot.GetTensorInfo(), hash);
+        }
+
+        layerHashes.emplace(layer, hash);
+    }
+
+    // Combined in sorted order: the topological order of a graph depends on the order its layers were added in.
+    std::vector<uint64_t> sortedHashes;
+    sortedHashes.reserve(layerHashes.size());
+    for (const auto& layerHash : layerHashes)
+    {
+        sortedHashes.push_back(layerHash.second);
+    }
+    std::sort(sortedHashes.begin(), sortedHashes.end());
+
+    uint64_t hash = armnnUtils::HashCombine(0, sortedHashes.size());
+    for (uint64_t layerHash : sortedHashes)
+    {
+        hash = armnnUtils::HashCombine(hash, layerHash);
+    }
+    return hash;
+}
+
+} // namespace armnn
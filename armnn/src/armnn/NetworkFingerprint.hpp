@@ -0,0 +1,28 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <cstdint>
+
+namespace armnn
+{
+
+class Graph;
+
+/// A hash of everything that defines a network, layer by layer: type, name, binding of the Input and Output layers,
+/// descriptor and fused activation, TensorInfo and contents of the constant tensors, producers of the inputs and
+/// TensorInfos of the outputs. The names of the layers fused or folded into a layer are not part of it, as they are
+/// not saved with the network. A layer's producers are identified by their own hashes, and the network's hash
+/// combines those of its layers in sorted order, so it doesn't depend on the order the layers were added in.
+/// It only depends on contents, never on addresses, so it is stable across runs and processes (on machines of the
+/// same endianness): the same network loaded twice, from the same file or not, has the same fingerprint, and so has
+/// a network once saved and loaded again. As only their packed copy is saved, the data of packed weights is hashed
+/// through that copy.
+/// The hash is not cryptographic: it tells identical networks apart from accidentally different ones, not from
+/// networks crafted to collide.
+/// Throws InvalidArgumentException for layers of a type it doesn't know the state of.
+uint64_t ComputeFingerprint(const Graph& graph);
+
+} // namespace armnn
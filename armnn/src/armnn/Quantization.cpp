@@ -0,0 +1,455 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "Quantization.hpp"
+
+#include "ConstantPool.hpp"
+#include "Graph.hpp"
+#include "LayersFwd.hpp"
+#include "WeightPacking.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/cast.hpp>
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace armnn
+{
+
+namespace
+{
+
+constexpr int32_t QuantizedMin = 0;
+constexpr int32_t QuantizedMax = 255;
+
+std::string GetSlotDescription(const OutputSlot& slot)
+{
+    const Layer& layer = slot.GetOwningLayer();
+    return boost::str(boost::format("output %1% of %2% layer %3%")
+                      % slot.CalculateIndexOnOwner()
+                      % GetLayerTypeAsCString(layer.GetType())
+                      % layer.GetNameStr());
+}
+
+/// The layers whose outputs only hold values of their input, and therefore get its quantization parameters.
+bool PreservesRange(const Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Permute:
+            return true;
+        case LayerType::Pooling2d:
+        {
+            const PoolingAlgorithm algorithm =
+                boost::polymorphic_downcast<const Pooling2dLayer*>(&layer)->GetParameters().m_PoolType;
+            return algorithm == PoolingAlgorithm::Max || algorithm == PoolingAlgorithm::Average;
+        }
+        default:
+            return false;
+    }
+}
+
+/// The layers whose outputs are always in [0, 1].
+bool HasUnitRange(const Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Softmax:
+            return true;
+        case LayerType::Activation:
+            return boost::polymorphic_downcast<const ActivationLayer*>(&layer)->GetParameters().m_Function ==
+                ActivationFunction::Sigmoid;
+        default:
+            return false;
+    }
+}
+
+/// Whether the reference backend has a QuantisedAsymm8 kernel for the layer. Batch normalizations and
+/// normalizations only run in Float32: the former must be folded into the layers producing their input first.
+bool HasQuantizedKernel(const Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::BatchNormalization:
+        case LayerType::Normalization:
+            return false;
+        default:
+            return true;
+    }
+}
+
+/// The constant tensors of the layer, in place.
+std::vector<ConstTensor*> GetConstants(Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Constant:
+            return { &boost::polymorphic_downcast<ConstantLayer*>(&layer)->m_LayerOutput };
+        case LayerType::Convolution2d:
+        {
+            auto& convLayer = *boost::polymorphic_downcast<Convolution2dLayer*>(&layer);
+            return { &convLayer.m_Weight, &convLayer.m_Bias };
+        }
+        case LayerType::DepthwiseConvolution2d:
+        {
+            auto& convLayer = *boost::polymorphic_downcast<DepthwiseConvolution2dLayer*>(&layer);
+            return { &convLayer.m_Weight, &convLayer.m_Bias };
+        }
+        case LayerType::FullyConnected:
+        {
+            auto& fcLayer = *boost::polymorphic_downcast<FullyConnectedLayer*>(&layer);
+            return { &fcLayer.m_Weight, &fcLayer.m_Bias };
+        }
+        default:
+            return {};
+    }
+}
+
+void CheckFloat32(const TensorInfo& info, const std::string& what)
+{
+    if (info.GetDataType() != DataType::Float32)
+    {
+        throw InvalidArgumentException("Cannot quantize " + what + ": it is not Float32");
+    }
+}
+
+ConstTensor QuantizeConstant(ConstantPool& constantPool,
+                             const ConstTensor& tensor,
+                             const std::pair<float, int32_t>& parameters)
+{
+    const float* const values = static_cast<const float*>(tensor.GetMemoryArea());
+    const unsigned int numValues = tensor.GetNumElements();
+
+    ConstantPool::Buffer quantized(numValues);
+    for (unsigned int i = 0; i < numValues; ++i)
+    {
+        const int32_t value = static_cast<int32_t>(std::round(values[i] / parameters.first)) + parameters.second;
+        quantized[i] = static_cast<uint8_t>(std::min(std::max(value, QuantizedMin), QuantizedMax));
+    }
+
+    TensorInfo info = tensor.GetInfo();
+    info.SetDataType(DataType::QuantisedAsymm8);
+    info.SetQuantizationScale(parameters.first);
+    info.SetQuantizationOffset(parameters.second);
+    return constantPool.Add(info, std::move(quantized));
+}
+
+/// Quantizes the tensor with the parameters of its own range.
+ConstTensor QuantizeConstant(ConstantPool& constantPool, const ConstTensor& tensor)
+{
+    const float* const values = static_cast<const float*>(tensor.GetMemoryArea());
+    const unsigned int numValues = tensor.GetNumElements();
+
+    float min = 0.0f;
+    float max = 0.0f;
+    if (numValues > 0)
+    {
+        const auto range = std::minmax_element(values, values + numValues);
+        min = *range.first;
+        max = *range.second;
+    }
+    return QuantizeConstant(constantPool, tensor, GetQuantizationParameters(min, max));
+}
+
+ConstTensor QuantizeBias(ConstantPool& constantPool, const ConstTensor& bias, float scale)
+{
+    const float* const values = static_cast<const float*>(bias.GetMemoryArea());
+    const unsigned int numValues = bias.GetNumElements();
+
+    ConstantPool::Buffer quantized(numValues * sizeof(int32_t));
+    for (unsigned int i = 0; i < numValues; ++i)
+    {
+        const double value = std::round(double(values[i]) / scale);
+        const int32_t clamped = static_cast<int32_t>(
+            std::min(std::max(value, double(std::numeric_limits<int32_t>::min())),
+                     double(std::numeric_limits<int32_t>::max())));
+        std::memcpy(quantized.data() + i * sizeof(int32_t), &clamped, sizeof(int32_t));
+    }
+
+    TensorInfo info = bias.GetInfo();
+    info.SetDataType(DataType::Signed32);
+    info.SetQuantizationScale(scale);
+    info.SetQuantizationOffset(0);
+    return constantPool.Add(info, std::move(quantized));
+}
+
+/// Quantizes the constants of the layer, whose input is already quantized, and drops those computed for Float32
+/// kernels.
+void QuantizeConstants(Layer& layer, ConstantPool& constantPool)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Constant:
+        {
+            // With the parameters of its output, which the layers reading it expect.
+            ConstTensor& constant = boost::polymorphic_downcast<ConstantLayer*>(&layer)->m_LayerOutput;
+            const TensorInfo& outputInfo = layer.GetOutputSlot(0).GetTensorInfo();
+            constant = QuantizeConstant(constantPool, constant,
+                                        { outputInfo.GetQuantizationScale(), outputInfo.GetQuantizationOffset() });
+            break;
+        }
+        case LayerType::Convolution2d:
+        case LayerType::DepthwiseConvolution2d:
+        case LayerType::FullyConnected:
+        {
+            const std::vector<ConstTensor*> constants = GetConstants(layer);
+            ConstTensor& weight = *constants[0];
+            ConstTensor& bias = *constants[1];
+
+            weight = QuantizeConstant(constantPool, weight);
+            if (bias.GetMemoryArea() != nullptr)
+            {
+                const float inputScale =
+                    layer.GetInputSlot(0).GetConnectedOutputSlot()->GetTensorInfo().GetQuantizationScale();
+                bias = QuantizeBias(constantPool, bias, inputScale * weight.GetInfo().GetQuantizationScale());
+            }
+
+            if (layer.GetType() == LayerType::Convolution2d)
+            {
+                auto& convLayer = *boost::polymorphic_downcast<Convolution2dLayer*>(&layer);
+                convLayer.m_WinogradWeight = ConstTensor();
+                convLayer.m_PackedWeight = ConstTensor();
+                convLayer.m_PackedWeightLayout = PackedWeightLayout::None;
+            }
+            else if (layer.GetType() == LayerType::FullyConnected)
+            {
+                auto& fcLayer = *boost::polymorphic_downcast<FullyConnectedLayer*>(&layer);
+                fcLayer.m_PackedWeight = ConstTensor();
+                fcLayer.m_PackedWeightLayout = PackedWeightLayout::None;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+} // namespace
+
+Calibrator::Calibrator(CalibrationMethod method, float percentile)
+: m_Method(method)
+, m_Percentile(percentile)
+{
+    if (method == CalibrationMethod::Percentile && !(percentile > 50.0f && percentile <= 100.0f))
+    {
+        throw InvalidArgumentException(
+            boost::str(boost::format("Invalid calibration percentile %1%: must be in (50, 100]") % percentile));
+    }
+}
+
+void Calibrator::Observe(const OutputSlot& slot, const void* data)
+{
+    const TensorInfo& info = slot.GetTensorInfo();
+    CheckFloat32(info, GetSlotDescription(slot));
+
+    // Non-finite values (e.g. from a division by zero in a sample) would make the range useless.
+    const float* const values = static_cast<const float*>(data);
+    const unsigned int numValues = info.GetNumElements();
+    float min = std::numeric_limits<float>::infinity();
+    float max = -std::numeric_limits<float>::infinity();
+    for (unsigned int i = 0; i < numValues; ++i)
+    {
+        if (std::isfinite(values[i]))
+        {
+            min = std::min(min, values[i]);
+            max = std::max(max, values[i]);
+        }
+    }
+    if (min > max)
+    {
+        return;
+    }
+
+    auto inserted = m_Statistics.emplace(&slot, TensorStatistics());
+    TensorStatistics& statistics = inserted.first->second;
+    statistics.m_Min = inserted.second ? min : std::min(statistics.m_Min, min);
+    statistics.m_Max = inserted.second ? max : std::max(statistics.m_Max, max);
+
+    if (m_Method == CalibrationMethod::Percentile)
+    {
+        AddToHistogram(statistics, values, numValues);
+    }
+}
+
+void Calibrator::AddToHistogram(TensorStatistics& statistics, const float* values, unsigned int numValues) const
+{
+    std::vector<uint64_t>& histogram = statistics.m_Histogram;
+    const float maxMagnitude = std::max(std::fabs(statistics.m_Min), std::fabs(statistics.m_Max));
+
+    if (histogram.empty())
+    {
+        // The smallest power of two above the values, for the finest bins.
+        int exponent = 0;
+        std::frexp(maxMagnitude, &exponent);
+        statistics.m_HistogramRange = maxMagnitude > 0.0f ? std::ldexp(1.0f, exponent) : 1.0f;
+        histogram.assign(NumHistogramBins, 0);
+    }
+    while (maxMagnitude >= statistics.m_HistogramRange)
+    {
+        // Each pair of bins becomes a bin of the middle half of the histogram, which covers the old range.
+        std::vector<uint64_t> merged(NumHistogramBins, 0);
+        for (unsigned int i = 0; i < NumHistogramBins / 2; ++i)
+        {
+            merged[NumHistogramBins / 4 + i] = histogram[2 * i] + histogram[2 * i + 1];
+        }
+        histogram.swap(merged);
+        statistics.m_HistogramRange *= 2.0f;
+    }
+
+    const float binsPerUnit = NumHistogramBins / (2.0f * statistics.m_HistogramRange);
+    for (unsigned int i = 0; i < numValues; ++i)
+    {
+        if (std::isfinite(values[i]))
+        {
+            const auto bin = static_cast<unsigned int>((values[i] + statistics.m_HistogramRange) * binsPerUnit);
+            ++histogram[std::min(bin, NumHistogramBins - 1)];
+        }
+    }
+}
+
+bool Calibrator::HasRange(const OutputSlot& slot) const
+{
+    return m_Statistics.find(&slot) != m_Statistics.end();
+}
+
+std::pair<float, float> Calibrator::GetRange(const OutputSlot& slot) const
+{
+    const auto it = m_Statistics.find(&slot);
+    if (it == m_Statistics.end())
+    {
+        throw InvalidArgumentException("No values were recorded for " + GetSlotDescription(slot));
+    }
+    const TensorStatistics& statistics = it->second;
+    if (m_Method == CalibrationMethod::MinMax)
+    {
+        return { statistics.m_Min, statistics.m_Max };
+    }
+
+    // The number of values allowed below the range, and the same above it.
+    const std::vector<uint64_t>& histogram = statistics.m_Histogram;
+    uint64_t numValues = 0;
+    for (uint64_t count : histogram)
+    {
+        numValues += count;
+    }
+    const double numOutliers = double(numValues) * (100.0 - m_Percentile) / 100.0;
+
+    unsigned int lowerBin = 0;
+    for (uint64_t count = 0; lowerBin < NumHistogramBins - 1; ++lowerBin)
+    {
+        count += histogram[lowerBin];
+        if (double(count) > numOutliers)
+        {
+            break;
+        }
+    }
+    unsigned int upperBin = NumHistogramBins - 1;
+    for (uint64_t count = 0; upperBin > lowerBin; --upperBin)
+    {
+        count += histogram[upperBin];
+        if (double(count) > numOutliers)
+        {
+            break;
+        }
+    }
+
+    const float binSize = 2.0f * statistics.m_HistogramRange / NumHistogramBins;
+    const float lower = -statistics.m_HistogramRange + float(lowerBin) * binSize;
+    const float upper = -statistics.m_HistogramRange + float(upperBin + 1) * binSize;
+    return { std::max(lower, statistics.m_Min), std::min(upper, statistics.m_Max) };
+}
+
+std::pair<float, int32_t> GetQuantizationParameters(float min, float max)
+{
+    min = std::min(min, 0.0f);
+    max = std::max(max, 0.0f);
+    if (max == min)
+    {
+        // Only zeros: any scale represents them.
+        return { 1.0f, 0 };
+    }
+
+    const float scale = (max - min) / float(QuantizedMax - QuantizedMin);
+    const int32_t offset = QuantizedMin + static_cast<int32_t>(std::round(-min / scale));
+    return { scale, std::min(std::max(offset, QuantizedMin), QuantizedMax) };
+}
+
+void QuantizeGraph(Graph& graph, const Calibrator& calibrator)
+{
+    // Everything is checked before anything changes, so that a graph which cannot be quantized is left as it was.
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        if (!HasQuantizedKernel(*layer))
+        {
+            throw UnimplementedException(
+                boost::str(boost::format("Cannot quantize %1% layer %2%: it only runs in Float32")
+                           % GetLayerTypeAsCString(layer->GetType())
+                           % layer->GetNameStr()));
+        }
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            const OutputSlot& slot = layer->GetOutputSlot(i);
+            if (!slot.IsTensorInfoSet())
+            {
+                throw LayerValidationException("Cannot quantize " + GetSlotDescription(slot) +
+                                               ": its TensorInfo is not set");
+            }
+            CheckFloat32(slot.GetTensorInfo(), GetSlotDescription(slot));
+            if (!PreservesRange(*layer) && !HasUnitRange(*layer) && !calibrator.HasRange(slot))
+            {
+                throw InvalidArgumentException("No values were recorded for " + GetSlotDescription(slot));
+            }
+        }
+        for (const ConstTensor* constant : GetConstants(*layer))
+        {
+            if (constant->GetMemoryArea() != nullptr)
+            {
+                CheckFloat32(constant->GetInfo(), "the constants of " + layer->GetNameStr());
+            }
+        }
+    }
+
+    // In topological order, so that the parameters of the inputs of each layer are known.
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            OutputSlot& slot = layer->GetOutputSlot(i);
+            std::pair<float, int32_t> parameters;
+            if (PreservesRange(*layer))
+            {
+                const TensorInfo& inputInfo = layer->GetInputSlot(0).GetConnectedOutputSlot()->GetTensorInfo();
+                parameters = { inputInfo.GetQuantizationScale(), inputInfo.GetQuantizationOffset() };
+            }
+            else if (HasUnitRange(*layer))
+            {
+                parameters = { 1.0f / 256.0f, 0 };
+            }
+            else
+            {
+                const std::pair<float, float> range = calibrator.GetRange(slot);
+                parameters = GetQuantizationParameters(range.first, range.second);
+            }
+
+            TensorInfo info = slot.GetTensorInfo();
+            info.SetDataType(DataType::QuantisedAsymm8);
+            info.SetQuantizationScale(parameters.first);
+            info.SetQuantizationOffset(parameters.second);
+            slot.SetTensorInfo(info);
+        }
+
+        UnpackWeight(graph, *layer);
+        QuantizeConstants(*layer, graph.GetConstantPool());
+    }
+
+    graph.SetMemoryPlan(MemoryPlan());
+}
+
+} // namespace armnn
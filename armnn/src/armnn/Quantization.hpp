@@ -0,0 +1,98 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+class Graph;
+class OutputSlot;
+
+/// Post-training quantization of Float32 networks to QuantisedAsymm8.
+///
+/// A Calibrator is shown the tensors of the network as it runs on sample inputs (see RefExecutor::Execute()) and
+/// records the range each of them takes. QuantizeGraph() then derives the quantization parameters of every tensor
+/// from these ranges and converts the constant tensors of the layers.
+
+/// How a Calibrator derives the range of a tensor from the values it took.
+enum class CalibrationMethod
+{
+    /// The smallest and largest values.
+    MinMax,
+    /// The values at the given percentiles of the distribution, so that a few outliers don't spread the
+    /// quantization steps over values which hardly ever occur.
+    Percentile
+};
+
+/// Records the range of values of the tensors of a graph over calibration runs.
+class Calibrator
+{
+public:
+    /// @param percentile - For CalibrationMethod::Percentile, the percentage of the values the range covers: the
+    /// range goes from the (100 - percentile)th percentile to the percentile-th one.
+    explicit Calibrator(CalibrationMethod method = CalibrationMethod::MinMax, float percentile = 99.99f);
+
+    /// Records the values of the tensor produced by the slot, laid out as described by its TensorInfo, which
+    /// must be Float32. Meant to be called by the observer of RefExecutor::Execute().
+    void Observe(const OutputSlot& slot, const void* data);
+
+    /// Whether any values of the tensor produced by the slot were recorded.
+    bool HasRange(const OutputSlot& slot) const;
+
+    /// The range of the values of the tensor produced by the slot (see CalibrationMethod).
+    /// Throws if none were recorded.
+    std::pair<float, float> GetRange(const OutputSlot& slot) const;
+
+    /// Number of values in the histograms kept for CalibrationMethod::Percentile.
+    static constexpr unsigned int NumHistogramBins = 2048;
+
+private:
+    struct TensorStatistics
+    {
+        float m_Min = 0.0f;
+        float m_Max = 0.0f;
+        /// Histogram of the values over [-m_HistogramRange, m_HistogramRange), for CalibrationMethod::Percentile.
+        /// The range doubles, merging pairs of bins, when values fall outside it.
+        float m_HistogramRange = 0.0f;
+        std::vector<uint64_t> m_Histogram;
+    };
+
+    void AddToHistogram(TensorStatistics& statistics, const float* values, unsigned int numValues) const;
+
+    CalibrationMethod m_Method;
+    float m_Percentile;
+    std::unordered_map<const OutputSlot*, TensorStatistics> m_Statistics;
+};
+
+/// QuantisedAsymm8 quantization parameters (scale, offset) representing the range [min, max], extended to
+/// include 0 so that it is represented exactly (zero padding, ReLu). real = scale * (quantized - offset).
+std::pair<float, int32_t> GetQuantizationParameters(float min, float max);
+
+/// Quantizes a Float32 graph to QuantisedAsymm8:
+/// - The TensorInfo of every output slot gets the QuantisedAsymm8 data type and the quantization parameters of
+///   the range the calibrator recorded for it. The layers which only move values around (Permute, and Max and
+///   Average pooling) give their output the parameters of their input, so that their kernels don't need to
+///   requantize, and Softmax and Sigmoid outputs get the fixed range [0, 1].
+/// - The weights of convolutions and fully connected layers are quantized to QuantisedAsymm8 with the parameters
+///   of their own range. Biases are quantized to Signed32 with
+///   the scale of the input times the scale of the weights and no offset, as the accumulators of the kernels.
+///   The tensors of constant layers are quantized with the parameters of their output.
+/// - The constants precomputed for Float32 kernels (Winograd and packed weights) are dropped.
+/// The inputs of the network are QuantisedAsymm8 too: they must be quantized with the parameters of the TensorInfo
+/// of the input layers, and the outputs dequantized with those of the layers producing them. The memory plan of the
+/// graph is invalidated, the tensors being smaller.
+/// Throws if the graph is not entirely Float32, the calibrator recorded no range for one of its tensors, or it has
+/// layers without quantized kernels: batch normalizations which were not folded (see FoldBatchNormalization()) and
+/// normalizations.
+void QuantizeGraph(Graph& graph, const Calibrator& calibrator);
+
+} // namespace armnn
@@ -0,0 +1,214 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace armnn
+{
+
+/// A vector storing up to InlineCapacity elements within itself, which only allocates memory when it grows beyond
+/// that. Used for the short sequences every layer holds (its slots, the connections of its outputs), so that
+/// building a graph doesn't cost several allocations per layer.
+///
+/// Like std::vector, it relocates its elements when it grows. Types which cannot be moved (OutputSlot) can only
+/// have their capacity reserved while the vector is empty.
+template <typename T, std::size_t InlineCapacity>
+class SmallVector
+{
+    static_assert(InlineCapacity > 0, "SmallVector needs room for at least one element");
+    static_assert(alignof(T) <= alignof(std::max_align_t), "SmallVector doesn't support over-aligned types");
+
+public:
+    using value_type     = T;
+    using size_type      = std::size_t;
+    using iterator       = T*;
+    using const_iterator = const T*;
+
+    SmallVector()
+    : m_Data(GetInlineData())
+    , m_Size(0)
+    , m_Capacity(InlineCapacity)
+    {}
+
+    ~SmallVector()
+    {
+        clear();
+        FreeData();
+    }
+
+    SmallVector(const SmallVector&) = delete;
+    SmallVector& operator=(const SmallVector&) = delete;
+
+    iterator begin() { return m_Data; }
+    iterator end() { return m_Data + m_Size; }
+    const_iterator begin() const { return m_Data; }
+    const_iterator end() const { return m_Data + m_Size; }
+
+    size_type size() const { return m_Size; }
+    size_type capacity() const { return m_Capacity; }
+    bool empty() const { return m_Size == 0; }
+
+    T* data() { return m_Data; }
+    const T* data() const { return m_Data; }
+
+    T& operator[](size_type index)
+    {
+        BOOST_ASSERT(index < m_Size);
+        return m_Data[index];
+    }
+
+    const T& operator[](size_type index) const
+    {
+        BOOST_ASSERT(index < m_Size);
+        return m_Data[index];
+    }
+
+    T& at(size_type index)
+    {
+        CheckIndex(index);
+        return m_Data[index];
+    }
+
+    const T& at(size_type index) const
+    {
+        CheckIndex(index);
+        return m_Data[index];
+    }
+
+    T& front() { return (*this)[0]; }
+    const T& front() const { return (*this)[0]; }
+    T& back() { return (*this)[m_Size - 1]; }
+    const T& back() const { return (*this)[m_Size - 1]; }
+
+    void reserve(size_type capacity)
+    {
+        if (capacity > m_Capacity)
+        {
+            T* const data = Allocate(capacity);
+            Relocate(data, capacity);
+        }
+    }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (m_Size < m_Capacity)
+        {
+            new (m_Data + m_Size) T(std::forward<Args>(args)...);
+        }
+        else
+        {
+            // Constructed before the elements are relocated, as the arguments may refer to them.
+            const size_type capacity = 2 * m_Capacity;
+            T* const data = Allocate(capacity);
+            try
+            {
+                new (data + m_Size) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                ::operator delete(data);
+                throw;
+            }
+            Relocate(data, capacity);
+        }
+        return m_Data[m_Size++];
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back()
+    {
+        BOOST_ASSERT(m_Size > 0);
+        m_Data[--m_Size].~T();
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        T* const begin = m_Data + (first - m_Data);
+        T* const end = m_Data + (last - m_Data);
+        BOOST_ASSERT(m_Data <= begin && begin <= end && end <= m_Data + m_Size);
+
+        T* const newEnd = std::move(end, m_Data + m_Size, begin);
+        for (T* element = newEnd; element != m_Data + m_Size; ++element)
+        {
+            element->~T();
+        }
+        m_Size = static_cast<size_type>(newEnd - m_Data);
+        return begin;
+    }
+
+    void clear()
+    {
+        for (size_type i = 0; i < m_Size; ++i)
+        {
+            m_Data[i].~T();
+        }
+        m_Size = 0;
+    }
+
+private:
+    T* GetInlineData() { return reinterpret_cast<T*>(&m_InlineStorage); }
+
+    void CheckIndex(size_type index) const
+    {
+        if (index >= m_Size)
+        {
+            throw std::out_of_range("SmallVector index out of range");
+        }
+    }
+
+    static T* Allocate(size_type capacity)
+    {
+        return static_cast<T*>(::operator new(capacity * sizeof(T)));
+    }
+
+    void FreeData()
+    {
+        if (m_Data != GetInlineData())
+        {
+            ::operator delete(m_Data);
+        }
+    }
+
+    /// Moves the elements to newly allocated memory, which becomes the storage of the vector.
+    void Relocate(T* data, size_type capacity)
+    {
+        MoveElements(data, typename std::is_move_constructible<T>::type());
+        FreeData();
+        m_Data = data;
+        m_Capacity = capacity;
+    }
+
+    void MoveElements(T* data, std::true_type)
+    {
+        for (size_type i = 0; i < m_Size; ++i)
+        {
+            new (data + i) T(std::move_if_noexcept(m_Data[i]));
+            m_Data[i].~T();
+        }
+    }
+
+    void MoveElements(T*, std::false_type)
+    {
+        BOOST_ASSERT_MSG(m_Size == 0, "The elements of the SmallVector cannot be moved");
+    }
+
+    T*        m_Data;
+    size_type m_Size;
+    size_type m_Capacity;
+    typename std::aligned_storage<sizeof(T) * InlineCapacity, alignof(T)>::type m_InlineStorage;
+};
+
+} // namespace armnn
@@ -0,0 +1,99 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "StringPool.hpp"
+
+#include <Hash.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace armnn
+{
+
+namespace
+{
+
+constexpr std::size_t MinNumSlots = 16;
+
+} // namespace
+
+constexpr StringPool::StringId StringPool::InvalidStringId;
+
+StringPool::StringId StringPool::Intern(const char* string, std::size_t length)
+{
+    if (2 * (m_Strings.size() + 1) > m_Slots.size())
+    {
+        Grow();
+    }
+
+    const uint64_t hash = armnnUtils::Hash64(string, length);
+    const std::size_t slot = FindSlot(string, length, hash);
+    if (m_Slots[slot] != 0)
+    {
+        return m_Slots[slot] - 1;
+    }
+
+    if (m_Strings.size() >= InvalidStringId)
+    {
+        throw InvalidArgumentException("StringPool: too many strings");
+    }
+    const StringId id = static_cast<StringId>(m_Strings.size());
+    char* const characters = static_cast<char*>(m_Allocator.Allocate(length + 1, 1));
+    std::copy(string, string + length, characters);
+    characters[length] = '\0';
+    m_Strings.emplace_back(characters, length);
+    m_Hashes.push_back(hash);
+    m_Slots[slot] = id + 1;
+    return id;
+}
+
+StringPool::StringId StringPool::Intern(const char* string)
+{
+    return string != nullptr ? Intern(string, std::strlen(string)) : Intern("", 0);
+}
+
+StringPool::StringId StringPool::Find(const char* string, std::size_t length) const
+{
+    if (m_Slots.empty())
+    {
+        return InvalidStringId;
+    }
+    const std::size_t slot = FindSlot(string, length, armnnUtils::Hash64(string, length));
+    return m_Slots[slot] != 0 ? m_Slots[slot] - 1 : InvalidStringId;
+}
+
+std::size_t StringPool::FindSlot(const char* string, std::size_t length, uint64_t hash) const
+{
+    const std::size_t mask = m_Slots.size() - 1;
+    for (std::size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+    {
+        const StringId entry = m_Slots[slot];
+        if (entry == 0 ||
+            (m_Hashes[entry - 1] == hash && m_Strings[entry - 1] == boost::string_ref(string, length)))
+        {
+            return slot;
+        }
+    }
+}
+
+void StringPool::Grow()
+{
+    std::vector<StringId> slots(std::max(MinNumSlots, 2 * m_Slots.size()), 0);
+    const std::size_t mask = slots.size() - 1;
+    for (StringId id = 0; id < m_Strings.size(); ++id)
+    {
+        std::size_t slot = m_Hashes[id] & mask;
+        while (slots[slot] != 0)
+        {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = id + 1;
+    }
+    m_Slots.swap(slots);
+}
+
+} // namespace armnn
@@ -0,0 +1,73 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "ArenaAllocator.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/utility/string_ref.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+
+/// Interned strings (the names of the layers of a graph).
+/// Each distinct string is stored once and identified by its index in the pool, a StringId: strings interned in
+/// the same pool are equal if and only if their ids are. The characters are copied to the arena the pool is given
+/// (that of the graph), so they stay valid for the lifetime of the arena, even when nothing refers to them any
+/// more. Interning only allocates as the arena and the tables of the pool grow, not for each string.
+class StringPool
+{
+public:
+    using StringId = uint32_t;
+
+    /// Returned by Find() for strings which are not in the pool.
+    static constexpr StringId InvalidStringId = std::numeric_limits<StringId>::max();
+
+    explicit StringPool(ArenaAllocator& allocator) : m_Allocator(allocator) {}
+
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    /// Returns the id of the string, adding it to the pool if it is not there yet (nullptr is the empty string).
+    StringId Intern(const char* string, std::size_t length);
+    StringId Intern(const char* string);
+    StringId Intern(const std::string& string) { return Intern(string.data(), string.size()); }
+
+    /// Returns the id of the string, or InvalidStringId if it was never interned.
+    StringId Find(const char* string, std::size_t length) const;
+    StringId Find(const std::string& string) const { return Find(string.data(), string.size()); }
+
+    /// The characters of the string are followed by a null character, so its data() is also a C string.
+    boost::string_ref Get(StringId id) const
+    {
+        BOOST_ASSERT(id < m_Strings.size());
+        return m_Strings[id];
+    }
+
+    /// Number of distinct strings held by the pool.
+    std::size_t GetNumStrings() const { return m_Strings.size(); }
+
+private:
+    /// Index in m_Slots of the string, or of the empty slot where it would go.
+    std::size_t FindSlot(const char* string, std::size_t length, uint64_t hash) const;
+
+    void Grow();
+
+    ArenaAllocator& m_Allocator;
+    std::vector<boost::string_ref> m_Strings;
+    std::vector<uint64_t> m_Hashes;
+
+    /// Open addressing hash table, with linear probing: each slot holds the id of a string plus one, 0 if empty.
+    /// Its size is a power of two, at least twice the number of strings.
+    std::vector<StringId> m_Slots;
+};
+
+} // namespace armnn
@@ -0,0 +1,301 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "WeightPacking.hpp"
+
+#include "ConstantPool.hpp"
+#include "Graph.hpp"
+#include "LayersFwd.hpp"
+#include "Winograd.hpp"
+
+#include <ThreadPool.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/cast.hpp>
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// The members of the layers with packable weights, seen through a common interface.
+struct PackingTarget
+{
+    ConstTensor* m_Weight = nullptr;
+    ConstTensor* m_PackedWeight = nullptr;
+    PackedWeightLayout* m_PackedWeightLayout = nullptr;
+};
+
+bool GetPackingTarget(Layer& layer, PackingTarget& target)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Convolution2d:
+        {
+            auto& convLayer = *boost::polymorphic_downcast<Convolution2dLayer*>(&layer);
+            target = { &convLayer.m_Weight, &convLayer.m_PackedWeight, &convLayer.m_PackedWeightLayout };
+            return true;
+        }
+        case LayerType::FullyConnected:
+        {
+            auto& fcLayer = *boost::polymorphic_downcast<FullyConnectedLayer*>(&layer);
+            target = { &fcLayer.m_Weight, &fcLayer.m_PackedWeight, &fcLayer.m_PackedWeightLayout };
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+/// The weights of a layer as an operand of Sgemm(): op(A) of outputs x depth values, or op(B) of depth x outputs.
+struct GemmWeight
+{
+    unsigned int m_Outputs;
+    unsigned int m_Depth;
+    unsigned int m_LeadingDimension;
+    bool         m_Transpose;
+};
+
+GemmWeight GetGemmWeight(const Layer& layer, PackedWeightLayout layout)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Convolution2d:
+        {
+            // The weights are [O, K] with K = I * H * W in either layout: A as is for NCHW, B transposed for NHWC.
+            const TensorShape& shape = boost::polymorphic_downcast<const Convolution2dLayer*>(&layer)->m_Weight
+                .GetShape();
+            const unsigned int depth = shape.GetNumElements() / shape[0];
+            return { shape[0], depth, depth, layout == PackedWeightLayout::GemmB16x256 };
+        }
+        case LayerType::FullyConnected:
+        {
+            // B, [I, O], or [O, I] when m_TransposeWeightMatrix is set.
+            const auto& fcLayer = *boost::polymorphic_downcast<const FullyConnectedLayer*>(&layer);
+            const TensorShape& shape = fcLayer.m_Weight.GetShape();
+            const bool transposed = fcLayer.GetParameters().m_TransposeWeightMatrix;
+            return transposed ? GemmWeight{ shape[0], shape[1], shape[1], true } :
+                                GemmWeight{ shape[1], shape[0], shape[1], false };
+        }
+        default:
+            throw InvalidArgumentException(std::string("The weights of ") + GetLayerTypeAsCString(layer.GetType()) +
+                                           " layers cannot be packed");
+    }
+}
+
+/// Calls copy(packedIndex, index) for every value of the weights, index being its position in the weights and
+/// packedIndex its position once packed (see WeightPacking.hpp).
+template <typename Copy>
+void ForEachPackedValue(const GemmWeight& weight, PackedWeightLayout layout, Copy copy)
+{
+    const bool isA = layout == PackedWeightLayout::GemmA6x256;
+    const unsigned int panelSize = isA ? GemmPanelRows : GemmPanelColumns;
+    const unsigned int ld = weight.m_LeadingDimension;
+    // Output o and depth k are at o * ld + k in A as is and in B transposed, at k * ld + o otherwise.
+    const bool outputMajor = isA != weight.m_Transpose;
+
+    for (unsigned int p = 0; p < weight.m_Depth; p += GemmBlockDepth)
+    {
+        const unsigned int depth = std::min(GemmBlockDepth, weight.m_Depth - p);
+        for (unsigned int i = 0; i < weight.m_Outputs; i += panelSize)
+        {
+            const unsigned int width = std::min(panelSize, weight.m_Outputs - i);
+            std::size_t packedIndex = std::size_t(p) * weight.m_Outputs + std::size_t(i) * depth;
+            for (unsigned int k = p; k < p + depth; ++k)
+            {
+                for (unsigned int o = i; o < i + width; ++o, ++packedIndex)
+                {
+                    copy(packedIndex, outputMajor ? std::size_t(o) * ld + k : std::size_t(k) * ld + o);
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+void PackGemmPanelsA(unsigned int rows, unsigned int depth, const float* a, unsigned int lda, bool transposeA,
+                     float* packed)
+{
+    for (unsigned int ir = 0; ir < rows; ir += GemmPanelRows)
+    {
+        const unsigned int mr = std::min(GemmPanelRows, rows - ir);
+        for (unsigned int p = 0; p < depth; ++p)
+        {
+            for (unsigned int i = 0; i < mr; ++i)
+            {
+                packed[i] = transposeA ? a[p * lda + ir + i] : a[(ir + i) * lda + p];
+            }
+            std::fill(packed + mr, packed + GemmPanelRows, 0.0f);
+            packed += GemmPanelRows;
+        }
+    }
+}
+
+void PackGemmPanelsB(unsigned int depth, unsigned int columns, const float* b, unsigned int ldb, bool transposeB,
+                     float* packed)
+{
+    for (unsigned int jr = 0; jr < columns; jr += GemmPanelColumns)
+    {
+        const unsigned int nr = std::min(GemmPanelColumns, columns - jr);
+        for (unsigned int p = 0; p < depth; ++p)
+        {
+            if (transposeB)
+            {
+                for (unsigned int j = 0; j < nr; ++j)
+                {
+                    packed[j] = b[(jr + j) * ldb + p];
+                }
+            }
+            else
+            {
+                std::memcpy(packed, b + p * ldb + jr, nr * sizeof(float));
+            }
+            std::fill(packed + nr, packed + GemmPanelColumns, 0.0f);
+            packed += GemmPanelColumns;
+        }
+    }
+}
+
+PackedWeightLayout ChoosePackedWeightLayout(const Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Convolution2d:
+        {
+            const auto& convLayer = *boost::polymorphic_downcast<const Convolution2dLayer*>(&layer);
+            const ConstTensor& weight = convLayer.m_Weight;
+            if (weight.GetInfo().GetDataType() != DataType::Float32)
+            {
+                return PackedWeightLayout::None;
+            }
+
+            const OutputSlot& outputSlot = convLayer.GetOutputSlot(0);
+            if (!outputSlot.IsTensorInfoSet())
+            {
+                throw LayerValidationException(
+                    boost::str(boost::format("Cannot pack the weights of convolution %1%: its TensorInfo is not set")
+                               % convLayer.GetNameStr()));
+            }
+            if (ChooseWinogradOutputTile(convLayer.GetParameters(), DataType::Float32, weight.GetShape(),
+                                         outputSlot.GetTensorInfo().GetShape()) != 0)
+            {
+                return PackedWeightLayout::None;
+            }
+
+            return convLayer.GetParameters().m_DataLayout == DataLayout::NHWC ?
+                PackedWeightLayout::GemmB16x256 : PackedWeightLayout::GemmA6x256;
+        }
+        case LayerType::FullyConnected:
+        {
+            const auto& fcLayer = *boost::polymorphic_downcast<const FullyConnectedLayer*>(&layer);
+            return fcLayer.m_Weight.GetInfo().GetDataType() == DataType::Float32 ?
+                PackedWeightLayout::GemmB16x256 : PackedWeightLayout::None;
+        }
+        default:
+            return PackedWeightLayout::None;
+    }
+}
+
+TensorShape GetPackedWeightShape(const Layer& layer, PackedWeightLayout layout)
+{
+    BOOST_ASSERT(layout != PackedWeightLayout::None);
+    const GemmWeight weight = GetGemmWeight(layer, layout);
+    return TensorShape({ weight.m_Depth, weight.m_Outputs });
+}
+
+unsigned int PackWeights(Graph& graph, armnnUtils::ThreadPool* threadPool)
+{
+    struct PackingJob
+    {
+        Layer*               m_Layer;
+        PackingTarget        m_Target;
+        PackedWeightLayout   m_Layout;
+        TensorInfo           m_PackedInfo;
+    };
+
+    std::vector<PackingJob> jobs;
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        PackingTarget target;
+        if (!GetPackingTarget(*layer, target))
+        {
+            continue;
+        }
+
+        const PackedWeightLayout layout = ChoosePackedWeightLayout(*layer);
+        if (layout == PackedWeightLayout::None ||
+            (*target.m_PackedWeightLayout == layout && target.m_PackedWeight->GetMemoryArea() != nullptr))
+        {
+            continue;
+        }
+
+        // Packed in another layout when loaded.
+        UnpackWeight(graph, *layer);
+        if (target.m_Weight->GetMemoryArea() == nullptr)
+        {
+            throw LayerValidationException(
+                boost::str(boost::format("Cannot pack the weights of %1%: they have no data") % layer->GetNameStr()));
+        }
+
+        const TensorInfo packedInfo(GetPackedWeightShape(*layer, layout), DataType::Float32);
+        jobs.push_back({ layer, target, layout, packedInfo });
+    }
+
+    // Packing only reads the weights, so the layers are packed in parallel. Each result goes to the pool as soon as
+    // it is ready, which bounds the memory outside the pool to one layer per thread.
+    std::mutex poolMutex;
+    armnnUtils::ParallelFor(threadPool, jobs.size(), [&jobs, &graph, &poolMutex](std::size_t i)
+    {
+        const PackingJob& job = jobs[i];
+        ConstantPool::Buffer packed(job.m_PackedInfo.GetNumBytes());
+        const float* const weight = static_cast<const float*>(job.m_Target.m_Weight->GetMemoryArea());
+        float* const packedWeight = reinterpret_cast<float*>(packed.data());
+        ForEachPackedValue(GetGemmWeight(*job.m_Layer, job.m_Layout), job.m_Layout,
+                           [weight, packedWeight](std::size_t packedIndex, std::size_t index)
+                           {
+                               packedWeight[packedIndex] = weight[index];
+                           });
+
+        // Through the pool, so that layers sharing their weights share the packed ones too.
+        std::lock_guard<std::mutex> lock(poolMutex);
+        *job.m_Target.m_PackedWeight = graph.GetConstantPool().Add(job.m_PackedInfo, std::move(packed));
+        *job.m_Target.m_PackedWeightLayout = job.m_Layout;
+    });
+    return boost::numeric_cast<unsigned int>(jobs.size());
+}
+
+void UnpackWeight(Graph& graph, Layer& layer)
+{
+    PackingTarget target;
+    if (!GetPackingTarget(layer, target) ||
+        target.m_Weight->GetMemoryArea() != nullptr ||
+        target.m_PackedWeight->GetMemoryArea() == nullptr)
+    {
+        return;
+    }
+
+    const PackedWeightLayout layout = *target.m_PackedWeightLayout;
+    ConstantPool::Buffer data(target.m_Weight->GetNumBytes());
+    const float* const packedWeight = static_cast<const float*>(target.m_PackedWeight->GetMemoryArea());
+    float* const weight = reinterpret_cast<float*>(data.data());
+    ForEachPackedValue(GetGemmWeight(layer, layout), layout,
+                       [weight, packedWeight](std::size_t packedIndex, std::size_t index)
+                       {
+                           weight[index] = packedWeight[packedIndex];
+                       });
+
+    *target.m_Weight = graph.GetConstantPool().Add(target.m_Weight->GetInfo(), std::move(data));
+}
+
+} // namespace armnn
@@ -0,0 +1,79 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "InternalTypes.hpp"
+
+#include <armnn/Tensor.hpp>
+
+#include <cstddef>
+
+namespace armnnUtils
+{
+class ThreadPool;
+}
+
+namespace armnn
+{
+
+class Graph;
+class Layer;
+
+/// Weights packed ahead of time in the blocked layouts the GEMM kernels read (see Sgemm()).
+///
+/// Sgemm() multiplies op(A), m x k, by op(B), k x n, in blocks of GemmBlockDepth values of k. Within a block it
+/// reads op(A) as panels of GemmPanelRows rows and op(B) as panels of GemmPanelColumns columns. Each panel is
+/// stored one value of k after the other (the GemmPanelRows values of a column of A, then those of the next
+/// column), the last panel being padded with zeros. It packs the panels of both operands as it goes, at every
+/// call; weights packed ahead of time are read as they are.
+///
+/// Weights packed ahead of time hold all their blocks one after the other: the block starting at k = p starts at
+/// p * size, size being m (or n), and within it the panel starting at row (or column) i starts at i * depth, depth
+/// being the number of values of k in the block. The last panel is not padded: it holds the remaining rows (or
+/// columns) only, and the kernels pad it as they read it. Packed weights are tensors of shape [k, size], as many
+/// values as the weights.
+
+/// Rows of the panels of op(A).
+constexpr unsigned int GemmPanelRows = 6;
+/// Columns of the panels of op(B).
+constexpr unsigned int GemmPanelColumns = 16;
+/// Values of k in a block.
+constexpr unsigned int GemmBlockDepth = 256;
+
+/// Packs rows [0, rows) and columns [0, depth) of op(A) as panels of GemmPanelRows rows, padding the last one.
+void PackGemmPanelsA(unsigned int rows, unsigned int depth, const float* a, unsigned int lda, bool transposeA,
+                     float* packed);
+
+/// Packs rows [0, depth) and columns [0, columns) of op(B) as panels of GemmPanelColumns columns, padding the last
+/// one.
+void PackGemmPanelsB(unsigned int depth, unsigned int columns, const float* b, unsigned int ldb, bool transposeB,
+                     float* packed);
+
+/// The layout the weights of the layer are best packed in for the reference kernels: GemmA6x256 for NCHW
+/// convolutions, GemmB16x256 for NHWC convolutions and fully connected layers. None for the other layers, the
+/// layers which are not Float32, and the convolutions computed with Winograd (see ChooseWinogradOutputTile()).
+/// The TensorInfo of the output of convolutions must be set.
+PackedWeightLayout ChoosePackedWeightLayout(const Layer& layer);
+
+/// Shape of the weights of the layer (a Convolution2d or FullyConnected layer) once packed in the given layout.
+TensorShape GetPackedWeightShape(const Layer& layer, PackedWeightLayout layout);
+
+/// Packs the weights of every layer for which ChoosePackedWeightLayout() returns a layout, and stores them in the
+/// layer (m_PackedWeight and m_PackedWeightLayout), so that they are serialized with the network and the kernels
+/// read them without rearranging them at each execution. Fully connected layers then no longer depend on
+/// m_TransposeWeightMatrix. The original weights are kept in the graph, but only the packed ones are serialized:
+/// a network loaded back has weights without data (see UnpackWeight()). The TensorInfos of the graph must be set.
+/// Layers whose weights are already packed in the right layout are left as they are.
+/// Passes which change the weights of a layer drop its packed weights, so this is best run last.
+/// @param threadPool - If not nullptr, the weights of the layers are packed in parallel on it.
+/// @return The number of layers whose weights were packed.
+unsigned int PackWeights(Graph& graph, armnnUtils::ThreadPool* threadPool = nullptr);
+
+/// Gives back its weights to a Convolution2d or FullyConnected layer which only has them packed (as loaded from a
+/// serialized network), by unpacking them into the constant pool. Does nothing for the other layers. The passes
+/// which read the weights call it first; the kernels read the packed weights and don't need it.
+void UnpackWeight(Graph& graph, Layer& layer);
+
+} // namespace armnn
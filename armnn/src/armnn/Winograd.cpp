@@ -0,0 +1,357 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "Winograd.hpp"
+
+#include "ConstantPool.hpp"
+#include "Graph.hpp"
+#include "LayersFwd.hpp"
+#include "WeightPacking.hpp"
+
+#include <DataLayoutIndexed.hpp>
+#include <ThreadPool.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/cast.hpp>
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Convolutions with fewer input or output channels spend more time transforming tiles than multiplying them.
+constexpr unsigned int MinWinogradChannels = 8;
+
+// Transforms of F(2x2, 3x3).
+const float G2[4][3] =
+{
+    { 1.0f,  0.0f, 0.0f },
+    { 0.5f,  0.5f, 0.5f },
+    { 0.5f, -0.5f, 0.5f },
+    { 0.0f,  0.0f, 1.0f },
+};
+const float BT2[4][4] =
+{
+    { 1.0f,  0.0f, -1.0f,  0.0f },
+    { 0.0f,  1.0f,  1.0f,  0.0f },
+    { 0.0f, -1.0f,  1.0f,  0.0f },
+    { 0.0f,  1.0f,  0.0f, -1.0f },
+};
+const float AT2[2][4] =
+{
+    { 1.0f, 1.0f,  1.0f,  0.0f },
+    { 0.0f, 1.0f, -1.0f, -1.0f },
+};
+
+// Transforms of F(4x4, 3x3), with interpolation points 0, +-1, +-2 and infinity.
+const float G4[6][3] =
+{
+    {  1.0f /  4,  0.0f,        0.0f      },
+    { -1.0f /  6, -1.0f /  6,  -1.0f / 6  },
+    { -1.0f /  6,  1.0f /  6,  -1.0f / 6  },
+    {  1.0f / 24,  1.0f / 12,   1.0f / 6  },
+    {  1.0f / 24, -1.0f / 12,   1.0f / 6  },
+    {  0.0f,       0.0f,        1.0f      },
+};
+const float BT4[6][6] =
+{
+    { 4.0f,  0.0f, -5.0f,  0.0f, 1.0f, 0.0f },
+    { 0.0f, -4.0f, -4.0f,  1.0f, 1.0f, 0.0f },
+    { 0.0f,  4.0f, -4.0f, -1.0f, 1.0f, 0.0f },
+    { 0.0f, -2.0f, -1.0f,  2.0f, 1.0f, 0.0f },
+    { 0.0f,  2.0f, -1.0f, -2.0f, 1.0f, 0.0f },
+    { 0.0f,  4.0f,  0.0f, -5.0f, 0.0f, 1.0f },
+};
+const float AT4[4][6] =
+{
+    { 1.0f, 1.0f,  1.0f, 1.0f,  1.0f, 0.0f },
+    { 0.0f, 1.0f, -1.0f, 2.0f, -2.0f, 0.0f },
+    { 0.0f, 1.0f,  1.0f, 4.0f,  4.0f, 0.0f },
+    { 0.0f, 1.0f, -1.0f, 8.0f, -8.0f, 1.0f },
+};
+
+/// Computes X D X^T, for X of R x C and D of C x C. Element (i, j) of D is read from
+/// input[i * inputStrideY + j * inputStrideX] and element (i, j) of the result written to
+/// output[(i * R + j) * outputStride].
+template <unsigned int R, unsigned int C>
+void Sandwich(const float (&x)[R][C],
+              const float* input, std::size_t inputStrideY, std::size_t inputStrideX,
+              float* output, std::size_t outputStride)
+{
+    // X D, then (X D) X^T.
+    float left[R][C];
+    for (unsigned int i = 0; i < R; ++i)
+    {
+        for (unsigned int j = 0; j < C; ++j)
+        {
+            float sum = 0.0f;
+            for (unsigned int k = 0; k < C; ++k)
+            {
+                sum += x[i][k] * input[k * inputStrideY + j * inputStrideX];
+            }
+            left[i][j] = sum;
+        }
+    }
+
+    for (unsigned int i = 0; i < R; ++i)
+    {
+        for (unsigned int j = 0; j < R; ++j)
+        {
+            float sum = 0.0f;
+            for (unsigned int k = 0; k < C; ++k)
+            {
+                sum += left[i][k] * x[j][k];
+            }
+            output[(i * R + j) * outputStride] = sum;
+        }
+    }
+}
+
+/// Same as Sandwich() for WinogradTileLanes interleaved matrices: element (i, j) of D l is read from
+/// input[(i * C + j) * inputStride + l] and element (i, j) of the result l written to
+/// output[(i * R + j) * outputStride + l].
+template <unsigned int R, unsigned int C>
+void SandwichLanes(const float (&x)[R][C],
+                   const float* input, std::size_t inputStride,
+                   float* output, std::size_t outputStride)
+{
+    constexpr unsigned int L = WinogradTileLanes;
+
+    float left[R][C][L];
+    for (unsigned int i = 0; i < R; ++i)
+    {
+        for (unsigned int j = 0; j < C; ++j)
+        {
+            float sum[L] = {};
+            for (unsigned int k = 0; k < C; ++k)
+            {
+                const float* const in = input + (k * C + j) * inputStride;
+                for (unsigned int l = 0; l < L; ++l)
+                {
+                    sum[l] += x[i][k] * in[l];
+                }
+            }
+            std::copy(sum, sum + L, left[i][j]);
+        }
+    }
+
+    for (unsigned int i = 0; i < R; ++i)
+    {
+        for (unsigned int j = 0; j < R; ++j)
+        {
+            float sum[L] = {};
+            for (unsigned int k = 0; k < C; ++k)
+            {
+                for (unsigned int l = 0; l < L; ++l)
+                {
+                    sum[l] += left[i][k][l] * x[j][k];
+                }
+            }
+            std::copy(sum, sum + L, output + (i * R + j) * outputStride);
+        }
+    }
+}
+
+unsigned int DivideRoundUp(unsigned int value, unsigned int divisor)
+{
+    return (value + divisor - 1) / divisor;
+}
+
+} // namespace
+
+unsigned int ChooseWinogradOutputTile(const Convolution2dDescriptor& descriptor,
+                                      DataType dataType,
+                                      const TensorShape& weightShape,
+                                      const TensorShape& outputShape)
+{
+    if (dataType != DataType::Float32 || descriptor.m_StrideX != 1 || descriptor.m_StrideY != 1 ||
+        weightShape.GetNumDimensions() != 4 || outputShape.GetNumDimensions() != 4)
+    {
+        return 0;
+    }
+
+    const DataLayoutIndexed dataLayout(descriptor.m_DataLayout);
+    if (weightShape[dataLayout.GetHeightIndex()] != WinogradKernelSize ||
+        weightShape[dataLayout.GetWidthIndex()] != WinogradKernelSize ||
+        weightShape[0] < MinWinogradChannels ||
+        weightShape[dataLayout.GetChannelsIndex()] < MinWinogradChannels)
+    {
+        return 0;
+    }
+
+    // Multiply-adds per pair of channels, for each tile size: partial tiles cost as much as whole ones.
+    const unsigned int outputHeight = outputShape[dataLayout.GetHeightIndex()];
+    const unsigned int outputWidth  = outputShape[dataLayout.GetWidthIndex()];
+    auto cost = [&](unsigned int tile)
+    {
+        return DivideRoundUp(outputHeight, tile) * DivideRoundUp(outputWidth, tile) * (tile + 2) * (tile + 2);
+    };
+    return cost(4) <= cost(2) ? 4 : 2;
+}
+
+unsigned int GetWinogradOutputTile(const TensorShape& transformedWeightShape)
+{
+    if (transformedWeightShape.GetNumDimensions() != 4 ||
+        transformedWeightShape[0] != transformedWeightShape[1] ||
+        (transformedWeightShape[0] != 4 && transformedWeightShape[0] != 6))
+    {
+        return 0;
+    }
+    return transformedWeightShape[0] - 2;
+}
+
+TensorShape GetWinogradWeightShape(unsigned int outputTile, unsigned int outputChannels, unsigned int inputChannels)
+{
+    BOOST_ASSERT(outputTile == 2 || outputTile == 4);
+    return TensorShape({ outputTile + 2, outputTile + 2, outputChannels, inputChannels });
+}
+
+void TransformWinogradWeights(const ConstTensor& weight,
+                              DataLayout dataLayout,
+                              unsigned int outputTile,
+                              float* transformed)
+{
+    const DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const TensorShape& shape = weight.GetShape();
+    const unsigned int outputChannels = shape[0];
+    const unsigned int inputChannels  = shape[dataLayoutIndexed.GetChannelsIndex()];
+    BOOST_ASSERT(shape[dataLayoutIndexed.GetHeightIndex()] == WinogradKernelSize);
+    BOOST_ASSERT(shape[dataLayoutIndexed.GetWidthIndex()] == WinogradKernelSize);
+
+    // Strides of the filter elements, and of the input channels, in the weights.
+    const bool nhwc = dataLayout == DataLayout::NHWC;
+    const std::size_t strideX = nhwc ? inputChannels : 1;
+    const std::size_t strideY = strideX * WinogradKernelSize;
+    const std::size_t strideChannel = nhwc ? 1 : WinogradKernelSize * WinogradKernelSize;
+
+    const float* const data = static_cast<const float*>(weight.GetMemoryArea());
+    const std::size_t matrixSize = std::size_t(outputChannels) * inputChannels;
+
+    for (unsigned int o = 0; o < outputChannels; ++o)
+    {
+        for (unsigned int i = 0; i < inputChannels; ++i)
+        {
+            const float* const filter = data + o * (inputChannels * WinogradKernelSize * WinogradKernelSize) +
+                                        i * strideChannel;
+            float* const output = transformed + o * inputChannels + i;
+            if (outputTile == 2)
+            {
+                Sandwich(G2, filter, strideY, strideX, output, matrixSize);
+            }
+            else
+            {
+                Sandwich(G4, filter, strideY, strideX, output, matrixSize);
+            }
+        }
+    }
+}
+
+void TransformWinogradInput(unsigned int outputTile,
+                            const float* tiles,
+                            float* transformed,
+                            std::size_t transformedStride)
+{
+    if (outputTile == 2)
+    {
+        SandwichLanes(BT2, tiles, WinogradTileLanes, transformed, transformedStride);
+    }
+    else
+    {
+        SandwichLanes(BT4, tiles, WinogradTileLanes, transformed, transformedStride);
+    }
+}
+
+void TransformWinogradOutput(unsigned int outputTile,
+                             const float* products,
+                             std::size_t productsStride,
+                             float* tiles)
+{
+    if (outputTile == 2)
+    {
+        SandwichLanes(AT2, products, productsStride, tiles, WinogradTileLanes);
+    }
+    else
+    {
+        SandwichLanes(AT4, products, productsStride, tiles, WinogradTileLanes);
+    }
+}
+
+unsigned int PrepareWinogradConvolutions(Graph& graph, ThreadPool* threadPool)
+{
+    struct TransformJob
+    {
+        Convolution2dLayer*  m_Layer;
+        unsigned int         m_OutputTile;
+        TensorInfo           m_TransformedInfo;
+    };
+
+    std::vector<TransformJob> jobs;
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        if (layer->GetType() != LayerType::Convolution2d)
+        {
+            continue;
+        }
+
+        auto convLayer = boost::polymorphic_downcast<Convolution2dLayer*>(layer);
+        if (convLayer->m_WinogradWeight.GetMemoryArea() != nullptr)
+        {
+            continue;
+        }
+
+        const OutputSlot& outputSlot = convLayer->GetOutputSlot(0);
+        if (!outputSlot.IsTensorInfoSet())
+        {
+            throw LayerValidationException(
+                boost::str(boost::format("Cannot prepare convolution %1% for Winograd: its TensorInfo is not set")
+                           % convLayer->GetNameStr()));
+        }
+
+        const ConstTensor& weight = convLayer->m_Weight;
+        const unsigned int outputTile = ChooseWinogradOutputTile(convLayer->GetParameters(),
+                                                                 weight.GetInfo().GetDataType(),
+                                                                 weight.GetShape(),
+                                                                 outputSlot.GetTensorInfo().GetShape());
+        if (outputTile == 0)
+        {
+            continue;
+        }
+
+        const DataLayoutIndexed dataLayout(convLayer->GetParameters().m_DataLayout);
+        const TensorInfo transformedInfo(
+            GetWinogradWeightShape(outputTile, weight.GetShape()[0], weight.GetShape()[dataLayout.GetChannelsIndex()]),
+            DataType::Float32);
+        UnpackWeight(graph, *convLayer);
+        jobs.push_back({ convLayer, outputTile, transformedInfo });
+    }
+
+    // The transforms only read the filters, so they are computed in parallel, each result going to the pool as soon
+    // as it is ready rather than all of them being held until the end.
+    std::mutex poolMutex;
+    ParallelFor(threadPool, jobs.size(), [&jobs, &graph, &poolMutex](std::size_t i)
+    {
+        const TransformJob& job = jobs[i];
+        ConstantPool::Buffer transformed(job.m_TransformedInfo.GetNumBytes());
+        TransformWinogradWeights(job.m_Layer->m_Weight, job.m_Layer->GetParameters().m_DataLayout, job.m_OutputTile,
+                                 reinterpret_cast<float*>(transformed.data()));
+
+        // Through the pool, so that convolutions sharing their filters share the transformed ones too.
+        std::lock_guard<std::mutex> lock(poolMutex);
+        job.m_Layer->m_WinogradWeight = graph.GetConstantPool().Add(job.m_TransformedInfo, std::move(transformed));
+    });
+    return boost::numeric_cast<unsigned int>(jobs.size());
+}
+
+} // namespace armnn
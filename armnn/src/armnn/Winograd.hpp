@@ -0,0 +1,85 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+namespace armnnUtils
+{
+class ThreadPool;
+}
+
+namespace armnn
+{
+
+class ConstantPool;
+class Graph;
+
+/// Winograd minimal filtering F(m x m, 3 x 3) for 3x3 stride-1 convolutions.
+///
+/// The output is computed in m x m tiles, each from an (m + 2) x (m + 2) tile of input. Filters g and input
+/// tiles d are transformed to U = G g G^T and V = B^T d B; the tile of output is Y = A^T [sum over channels of
+/// U . V] A, where . is the element-wise product. The sum over channels is (m + 2)^2 independent matrix
+/// multiplications, which take 2.25x (m = 2) or 4x (m = 4) fewer multiply-adds than the direct convolution.
+///
+/// Transformed filters are stored as a tensor of shape [m + 2, m + 2, outputChannels, inputChannels], the tile
+/// size being implied by the first dimension.
+
+/// Size of the filters the Winograd transforms apply to.
+constexpr unsigned int WinogradKernelSize = 3;
+
+/// Returns the size of the output tile (2 or 4) to compute the convolution with, or 0 if Winograd doesn't apply:
+/// the convolution must be Float32 with 3x3 filters and unit strides, and have enough input and output channels
+/// for the transforms to pay off. The tile giving the fewest multiply-adds for the output size is chosen.
+/// @param [in] weightShape Shape of the weights, in the layout of the descriptor.
+/// @param [in] outputShape Shape of the output of the convolution.
+unsigned int ChooseWinogradOutputTile(const Convolution2dDescriptor& descriptor,
+                                      DataType dataType,
+                                      const TensorShape& weightShape,
+                                      const TensorShape& outputShape);
+
+/// Returns the size of the output tile transformed filters were computed for (0 if the shape is not the shape of
+/// transformed filters).
+unsigned int GetWinogradOutputTile(const TensorShape& transformedWeightShape);
+
+/// Shape of the filters of a convolution transformed for the given output tile.
+TensorShape GetWinogradWeightShape(unsigned int outputTile, unsigned int outputChannels, unsigned int inputChannels);
+
+/// Transforms 3x3 filters for the given output tile size.
+/// @param [in] weight Filters of a convolution, [O, I, 3, 3] for NCHW or [O, 3, 3, I] for NHWC.
+/// @param [out] transformed Room for GetWinogradWeightShape(outputTile, O, I).GetNumElements() floats.
+void TransformWinogradWeights(const ConstTensor& weight,
+                              DataLayout dataLayout,
+                              unsigned int outputTile,
+                              float* transformed);
+
+/// Number of tiles TransformWinogradInput() and TransformWinogradOutput() work on at once. The tiles are
+/// interleaved, element i of tile l being at [i * WinogradTileLanes + l], so the transforms vectorize across them.
+constexpr unsigned int WinogradTileLanes = 8;
+
+/// Transforms WinogradTileLanes interleaved (m + 2) x (m + 2) tiles of input, each stored row-major: writes
+/// V = B^T d B, element i of tile l being stored at transformed[i * transformedStride + l].
+void TransformWinogradInput(unsigned int outputTile,
+                            const float* tiles,
+                            float* transformed,
+                            std::size_t transformedStride);
+
+/// Transforms the (m + 2) x (m + 2) products of WinogradTileLanes tiles, element i of tile l being read from
+/// products[i * productsStride + l], into interleaved m x m tiles of output Y = A^T M A, each stored row-major.
+void TransformWinogradOutput(unsigned int outputTile,
+                             const float* products,
+                             std::size_t productsStride,
+                             float* tiles);
+
+/// Computes the transformed filters of every convolution of the graph where Winograd applies (see
+/// ChooseWinogradOutputTile()) and stores them in the layer (Convolution2dLayer::m_WinogradWeight), so that they
+/// are serialized with the network and not computed again when it is loaded. The TensorInfos of the graph must be
+/// set. Convolutions which already have transformed filters are left as they are.
+/// @param threadPool - If not nullptr, the filters of the convolutions are transformed in parallel on it.
+/// @return The number of convolutions given transformed filters.
+unsigned int PrepareWinogradConvolutions(Graph& graph, armnnUtils::ThreadPool* threadPool = nullptr);
+
+} // namespace armnn
@@ -4,10 +4,6 @@
 //
 #include "ActivationLayer.hpp"
 
-
-
-
-
 namespace armnn
 {
 
@@ -16,5 +12,4 @@ ActivationLayer::ActivationLayer(const ActivationDescriptor& param, const char*
 {
 }
 
-
 } // namespace armnn
@@ -11,10 +11,6 @@ namespace armnn
 /// This layer represents an activation operation with the specified activation function.
 class ActivationLayer : public LayerWithParameters<ActivationDescriptor>
 {
-public:
-  
-
-
 protected:
     /// Constructor to create an ActivationLayer.
     /// @param [in] param ActivationDescriptor to configure the activation operation.
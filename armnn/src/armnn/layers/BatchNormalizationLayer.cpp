@@ -0,0 +1,48 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "BatchNormalizationLayer.hpp"
+
+#include <DataLayoutIndexed.hpp>
+
+#include <boost/format.hpp>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+BatchNormalizationLayer::BatchNormalizationLayer(const BatchNormalizationDescriptor& param, const char* name)
+    : LayerWithParameters(1, 1, LayerType::BatchNormalization, param, name)
+{
+}
+
+void BatchNormalizationLayer::InferTensorInfos()
+{
+    const std::vector<TensorShape> inputShapes = GetInputShapes();
+    const TensorShape& inputShape = inputShapes[0];
+
+    // The channels are the second dimension of NCHW tensors and of 2D ones, the last of NHWC tensors.
+    const unsigned int channelsIndex = inputShape.GetNumDimensions() == 4 ?
+        DataLayoutIndexed(m_Param.m_DataLayout).GetChannelsIndex() : 1;
+    if (inputShape.GetNumDimensions() < 2 || channelsIndex >= inputShape.GetNumDimensions())
+    {
+        throw LayerValidationException("BatchNormalizationLayer: the input must have a channel dimension.");
+    }
+
+    const unsigned int numChannels = inputShape[channelsIndex];
+    for (const ConstTensor* tensor : { &m_Mean, &m_Variance, &m_Beta, &m_Gamma })
+    {
+        if (tensor->GetNumElements() != numChannels)
+        {
+            throw LayerValidationException(boost::str(boost::format(
+                "BatchNormalizationLayer: the mean, variance, beta and gamma must have %1% elements, one per channel.")
+                % numChannels));
+        }
+    }
+
+    SetInferredShapes(InferOutputShapes(inputShapes));
+}
+
+} // namespace armnn
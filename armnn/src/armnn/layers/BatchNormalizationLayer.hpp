@@ -0,0 +1,39 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "LayerWithParameters.hpp"
+
+namespace armnn
+{
+
+/// This layer represents a batch normalization operation: each channel c of the input is normalized as
+/// gamma[c] * (x - mean[c]) / sqrt(variance[c] + eps) + beta[c].
+class BatchNormalizationLayer : public LayerWithParameters<BatchNormalizationDescriptor>
+{
+public:
+    /// The mean of each channel.
+    ConstTensor m_Mean;
+    /// The variance of each channel.
+    ConstTensor m_Variance;
+    /// The offset added to each channel once normalized.
+    ConstTensor m_Beta;
+    /// The scale applied to each channel once normalized.
+    ConstTensor m_Gamma;
+
+    /// Checks that the constant tensors have one value per channel of the input, whose shape the output takes.
+    void InferTensorInfos() override;
+
+protected:
+    /// Constructor to create a BatchNormalizationLayer.
+    /// @param [in] param BatchNormalizationDescriptor to configure the batch normalization operation.
+    /// @param [in] name Optional name for the layer.
+    BatchNormalizationLayer(const BatchNormalizationDescriptor& param, const char* name);
+
+    /// Default destructor
+    ~BatchNormalizationLayer() = default;
+};
+
+} // namespace
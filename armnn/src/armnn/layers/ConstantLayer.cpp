@@ -0,0 +1,20 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "ConstantLayer.hpp"
+
+namespace armnn
+{
+
+ConstantLayer::ConstantLayer(const char* name)
+    : Layer(0, 1, LayerType::Constant, name)
+{
+}
+
+void ConstantLayer::InferTensorInfos()
+{
+    GetOutputSlot(0).SetTensorInfo(m_LayerOutput.GetInfo());
+}
+
+} // namespace armnn
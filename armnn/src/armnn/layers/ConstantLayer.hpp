@@ -0,0 +1,32 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <Layer.hpp>
+
+namespace armnn
+{
+
+/// A layer without inputs whose output is a constant tensor (e.g. a tensor computed ahead of time by
+/// FoldConstants()).
+class ConstantLayer : public Layer
+{
+public:
+    /// The tensor the layer outputs.
+    ConstTensor m_LayerOutput;
+
+    /// Sets the TensorInfo of the output to that of the constant tensor.
+    void InferTensorInfos() override;
+
+protected:
+    /// Constructor to create a ConstantLayer.
+    /// @param [in] name Optional name for the layer.
+    ConstantLayer(const char* name);
+
+    /// Default destructor
+    ~ConstantLayer() = default;
+};
+
+} // namespace
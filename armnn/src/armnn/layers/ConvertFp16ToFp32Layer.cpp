@@ -0,0 +1,24 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "ConvertFp16ToFp32Layer.hpp"
+
+namespace armnn
+{
+
+ConvertFp16ToFp32Layer::ConvertFp16ToFp32Layer(const char* name)
+    : Layer(1, 1, LayerType::ConvertFp16ToFp32, name)
+{
+}
+
+void ConvertFp16ToFp32Layer::InferTensorInfos()
+{
+    Layer::InferTensorInfos();
+
+    TensorInfo info = GetOutputSlot(0).GetTensorInfo();
+    info.SetDataType(DataType::Float32);
+    GetOutputSlot(0).SetTensorInfo(info);
+}
+
+} // namespace armnn
@@ -0,0 +1,29 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <Layer.hpp>
+
+namespace armnn
+{
+
+/// This layer converts a Float16 tensor to Float32. ConvertToFp16() inserts it where Float16 regions of a graph
+/// meet the rest.
+class ConvertFp16ToFp32Layer : public Layer
+{
+public:
+    /// Sets the TensorInfo of the output to the input one with the Float32 data type.
+    void InferTensorInfos() override;
+
+protected:
+    /// Constructor to create a ConvertFp16ToFp32Layer.
+    /// @param [in] name Optional name for the layer.
+    ConvertFp16ToFp32Layer(const char* name);
+
+    /// Default destructor
+    ~ConvertFp16ToFp32Layer() = default;
+};
+
+} // namespace
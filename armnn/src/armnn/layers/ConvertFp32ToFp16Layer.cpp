@@ -0,0 +1,24 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "ConvertFp32ToFp16Layer.hpp"
+
+namespace armnn
+{
+
+ConvertFp32ToFp16Layer::ConvertFp32ToFp16Layer(const char* name)
+    : Layer(1, 1, LayerType::ConvertFp32ToFp16, name)
+{
+}
+
+void ConvertFp32ToFp16Layer::InferTensorInfos()
+{
+    Layer::InferTensorInfos();
+
+    TensorInfo info = GetOutputSlot(0).GetTensorInfo();
+    info.SetDataType(DataType::Float16);
+    GetOutputSlot(0).SetTensorInfo(info);
+}
+
+} // namespace armnn
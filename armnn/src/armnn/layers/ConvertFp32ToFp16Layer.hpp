@@ -0,0 +1,29 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <Layer.hpp>
+
+namespace armnn
+{
+
+/// This layer converts a Float32 tensor to Float16. ConvertToFp16() inserts it where Float16 regions of a graph
+/// meet the rest.
+class ConvertFp32ToFp16Layer : public Layer
+{
+public:
+    /// Sets the TensorInfo of the output to the input one with the Float16 data type.
+    void InferTensorInfos() override;
+
+protected:
+    /// Constructor to create a ConvertFp32ToFp16Layer.
+    /// @param [in] name Optional name for the layer.
+    ConvertFp32ToFp16Layer(const char* name);
+
+    /// Default destructor
+    ~ConvertFp32ToFp16Layer() = default;
+};
+
+} // namespace
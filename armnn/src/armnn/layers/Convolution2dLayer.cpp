@@ -4,6 +4,9 @@
 //
 #include "Convolution2dLayer.hpp"
 
+#include <DataLayoutIndexed.hpp>
+
+#include <boost/assert.hpp>
 
 using namespace armnnUtils;
 
@@ -15,5 +18,61 @@ Convolution2dLayer::Convolution2dLayer(const Convolution2dDescriptor& param, con
 {
 }
 
+std::vector<TensorShape> Convolution2dLayer::InferOutputShapes(const std::vector<TensorShape>& inputShapes) const
+{
+    BOOST_ASSERT(inputShapes.size() == 2);
+    const TensorShape& inputShape = inputShapes[0];
+    const TensorShape& filterShape = inputShapes[1];
+
+    // If we support multiple batch dimensions in the future, then this assert will need to change.
+    if (inputShape.GetNumDimensions() != 4 || filterShape.GetNumDimensions() != 4)
+    {
+        throw LayerValidationException("Convolutions will always have 4D input and weights.");
+    }
+    if (m_Param.m_StrideX == 0 || m_Param.m_StrideY == 0)
+    {
+        throw LayerValidationException("Convolution2dLayer: stride must be non-zero.");
+    }
+
+    DataLayoutIndexed dataLayoutIndex(m_Param.m_DataLayout);
+
+    unsigned int inWidth = inputShape[dataLayoutIndex.GetWidthIndex()];
+    unsigned int inHeight = inputShape[dataLayoutIndex.GetHeightIndex()];
+    unsigned int inBatchSize = inputShape[0];
+
+    unsigned int filterWidth = filterShape[dataLayoutIndex.GetWidthIndex()];
+    unsigned int filterHeight = filterShape[dataLayoutIndex.GetHeightIndex()];
+
+    if (filterShape[dataLayoutIndex.GetChannelsIndex()] != inputShape[dataLayoutIndex.GetChannelsIndex()])
+    {
+        throw LayerValidationException("Convolution2dLayer: the weights don't match the input channels.");
+    }
+
+    unsigned int paddedWidth = inWidth + m_Param.m_PadLeft + m_Param.m_PadRight;
+    unsigned int paddedHeight = inHeight + m_Param.m_PadTop + m_Param.m_PadBottom;
+    if (filterWidth > paddedWidth || filterHeight > paddedHeight)
+    {
+        throw LayerValidationException("Convolution2dLayer: the weights are larger than the padded input.");
+    }
+
+    unsigned int outWidth = 1 + ((paddedWidth - filterWidth) / m_Param.m_StrideX);
+    unsigned int outHeight = 1 + ((paddedHeight - filterHeight) / m_Param.m_StrideY);
+    unsigned int outChannels = filterShape[0];
+    unsigned int outBatchSize = inBatchSize;
+
+    TensorShape tensorShape = m_Param.m_DataLayout == DataLayout::NHWC ?
+        TensorShape( { outBatchSize, outHeight, outWidth, outChannels } ) :
+        TensorShape( { outBatchSize, outChannels, outHeight, outWidth });
+
+    return std::vector<TensorShape>({ tensorShape });
+}
+
+void Convolution2dLayer::InferTensorInfos()
+{
+    std::vector<TensorShape> inputShapes = GetInputShapes();
+    inputShapes.push_back(m_Weight.GetShape());
+
+    SetInferredShapes(InferOutputShapes(inputShapes));
+}
 
 } // namespace armnn
@@ -19,8 +19,27 @@ public:
     ConstTensor m_Weight;
     /// A unique pointer to store Bias values.
     ConstTensor m_Bias;
+    /// The weights transformed for Winograd convolution (see PrepareWinogradConvolutions()), empty if they were
+    /// not computed.
+    ConstTensor m_WinogradWeight;
+    /// The weights packed for the kernel computing the layer (see PackWeights()), empty if they were not packed.
+    ConstTensor m_PackedWeight;
+    /// The layout of m_PackedWeight.
+    PackedWeightLayout m_PackedWeightLayout = PackedWeightLayout::None;
+    /// The ReLu or BoundedReLu activation applied to the output (see FuseActivations()), when
+    /// m_HasFusedActivation is set.
+    ActivationDescriptor m_FusedActivation;
+    bool m_HasFusedActivation = false;
+
+    /// By default returns inputShapes if the number of inputs are equal to number of outputs,
+    /// otherwise infers the output shapes from given input shapes and layer properties.
+    /// @param [in] inputShapes The input shapes layer has: the input tensor followed by the weights.
+    /// @return A vector to the inferred output shape.
+    std::vector<TensorShape> InferOutputShapes(const std::vector<TensorShape>& inputShapes) const override;
+
+    /// Passes the shape of the weights on to InferOutputShapes().
+    void InferTensorInfos() override;
 
- 
 protected:
     /// Constructor to create a Convolution2dLayer.
     /// @param [in] param Convolution2dDescriptor to configure the convolution2d operation.
@@ -29,8 +48,6 @@ protected:
 
     /// Default destructor
     ~Convolution2dLayer() = default;
-
-   
 };
 
 } // namespace
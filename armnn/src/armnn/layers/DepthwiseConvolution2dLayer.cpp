@@ -4,6 +4,9 @@
 //
 #include "DepthwiseConvolution2dLayer.hpp"
 
+#include <DataLayoutIndexed.hpp>
+
+#include <boost/assert.hpp>
 
 using namespace armnnUtils;
 
@@ -16,5 +19,66 @@ DepthwiseConvolution2dLayer::DepthwiseConvolution2dLayer(const DepthwiseConvolut
 {
 }
 
+std::vector<TensorShape>
+DepthwiseConvolution2dLayer::InferOutputShapes(const std::vector<TensorShape>& inputShapes) const
+{
+    BOOST_ASSERT(inputShapes.size() == 2);
+    const TensorShape& inputShape = inputShapes[0];
+    const TensorShape& filterShape = inputShapes[1];
+
+    if (inputShape.GetNumDimensions() != 4 || filterShape.GetNumDimensions() != 4)
+    {
+        throw LayerValidationException("Convolutions will always have 4D input and weights.");
+    }
+    if (m_Param.m_StrideX == 0 || m_Param.m_StrideY == 0)
+    {
+        throw LayerValidationException("DepthwiseConvolution2dLayer: stride must be non-zero.");
+    }
+
+    DataLayoutIndexed dataLayoutIndex(m_Param.m_DataLayout);
+
+    unsigned int inputBatchSize = inputShape[0];
+    unsigned int inputHeight = inputShape[dataLayoutIndex.GetHeightIndex()];
+    unsigned int inputWidth = inputShape[dataLayoutIndex.GetWidthIndex()];
+    unsigned int inputChannels = inputShape[dataLayoutIndex.GetChannelsIndex()];
+
+    // Expected filter shape: [ M, I, H, W ] - This shape does NOT depend on the data layout
+    // Namely: [ depth multiplier, input channels, filter height, filter width ]
+    // Output channels = input channels * depthMultiplier
+    unsigned int depthMultiplier = filterShape[0];
+    unsigned int filterHeight = filterShape[2];
+    unsigned int filterWidth = filterShape[3];
+
+    if (filterShape[1] != inputChannels)
+    {
+        throw LayerValidationException("DepthwiseConvolution2dLayer: the weights don't match the input channels.");
+    }
+
+    unsigned int paddedHeight = inputHeight + m_Param.m_PadTop + m_Param.m_PadBottom;
+    unsigned int paddedWidth = inputWidth + m_Param.m_PadLeft + m_Param.m_PadRight;
+    if (filterWidth > paddedWidth || filterHeight > paddedHeight)
+    {
+        throw LayerValidationException("DepthwiseConvolution2dLayer: the weights are larger than the padded input.");
+    }
+
+    unsigned int outputHeight = 1 + ((paddedHeight - filterHeight) / m_Param.m_StrideY);
+    unsigned int outputWidth = 1 + ((paddedWidth - filterWidth) / m_Param.m_StrideX);
+    unsigned int outputChannels = inputChannels * depthMultiplier;
+    unsigned int outputBatchSize = inputBatchSize;
+
+    TensorShape outputShape = m_Param.m_DataLayout == DataLayout::NHWC ?
+        TensorShape{ outputBatchSize, outputHeight, outputWidth, outputChannels } :
+        TensorShape{ outputBatchSize, outputChannels, outputHeight, outputWidth };
+
+    return std::vector<TensorShape>{ outputShape };
+}
+
+void DepthwiseConvolution2dLayer::InferTensorInfos()
+{
+    std::vector<TensorShape> inputShapes = GetInputShapes();
+    inputShapes.push_back(m_Weight.GetShape());
+
+    SetInferredShapes(InferOutputShapes(inputShapes));
+}
 
 } // namespace armnn
@@ -19,7 +19,19 @@ public:
     ConstTensor m_Weight;
     /// A unique pointer to store Bias values.
     ConstTensor m_Bias;
+    /// The ReLu or BoundedReLu activation applied to the output (see FuseActivations()), when
+    /// m_HasFusedActivation is set.
+    ActivationDescriptor m_FusedActivation;
+    bool m_HasFusedActivation = false;
 
+    /// By default returns inputShapes if the number of inputs are equal to number of outputs,
+    /// otherwise infers the output shapes from given input shapes and layer properties.
+    /// @param [in] inputShapes The input shapes layer has: the input tensor followed by the weights.
+    /// @return A vector to the inferred output shape.
+    std::vector<TensorShape> InferOutputShapes(const std::vector<TensorShape>& inputShapes) const override;
+
+    /// Passes the shape of the weights on to InferOutputShapes().
+    void InferTensorInfos() override;
 
 protected:
     /// Constructor to create a DepthwiseConvolution2dLayer.
@@ -29,7 +41,6 @@ protected:
 
     /// Default destructor
     ~DepthwiseConvolution2dLayer() = default;
-
 };
 
 } // namespace
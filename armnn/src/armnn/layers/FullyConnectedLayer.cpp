@@ -4,6 +4,7 @@
 //
 #include "FullyConnectedLayer.hpp"
 
+#include <boost/assert.hpp>
 
 namespace armnn
 {
@@ -13,5 +14,30 @@ FullyConnectedLayer::FullyConnectedLayer(const FullyConnectedDescriptor& param,
 {
 }
 
+std::vector<TensorShape> FullyConnectedLayer::InferOutputShapes(const std::vector<TensorShape>& inputShapes) const
+{
+    BOOST_ASSERT(inputShapes.size() == 2);
+    const TensorShape& inputShape = inputShapes[0];
+    const TensorShape& weightShape = inputShapes[1];
+
+    if (inputShape.GetNumDimensions() == 0 || weightShape.GetNumDimensions() != 2)
+    {
+        throw LayerValidationException("FullyConnectedLayer: the weights must be 2D.");
+    }
+
+    // Output for FC is [1, w[1]].
+    unsigned int batches = inputShape[0];
+    unsigned int dimIdx = m_Param.m_TransposeWeightMatrix ? 0 : 1;
+
+    return std::vector<TensorShape>({ TensorShape({batches, weightShape[dimIdx]})});
+}
+
+void FullyConnectedLayer::InferTensorInfos()
+{
+    std::vector<TensorShape> inputShapes = GetInputShapes();
+    inputShapes.push_back(m_Weight.GetShape());
+
+    SetInferredShapes(InferOutputShapes(inputShapes));
+}
 
 } // namespace armnn
@@ -4,11 +4,6 @@
 //
 #include "InputLayer.hpp"
 
-#include "LayerCloneBase.hpp"
-
-#include <backendsCommon/WorkloadData.hpp>
-#include <backendsCommon/WorkloadFactory.hpp>
-
 namespace armnn
 {
 
@@ -17,4 +12,4 @@ InputLayer::InputLayer(LayerBindingId id, const char* name)
 {
 }
 
-} // namespace
+} // namespace armnn
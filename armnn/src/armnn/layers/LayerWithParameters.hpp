@@ -6,6 +6,8 @@
 
 #include <Layer.hpp>
 
+#include <armnn/Descriptors.hpp>
+
 namespace armnn
 {
 
@@ -17,6 +19,10 @@ public:
 
     const Parameters& GetParameters() const { return m_Param; }
 
+    /// Replaces the parameters, for the optimizations which rewrite a layer in place. They must stay consistent
+    /// with the constant tensors of the layer.
+    void SetParameters(const Parameters& param) { m_Param = param; }
+
     /// Helper to serialize the layer parameters to string
     /// (currently used in DotSerializer and company).
     // void SerializeLayerParameters(ParameterStringifyFunction & fn) const
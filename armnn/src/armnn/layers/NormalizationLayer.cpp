@@ -4,12 +4,6 @@
 //
 #include "NormalizationLayer.hpp"
 
-#include "LayerCloneBase.hpp"
-
-#include <armnn/TypesUtils.hpp>
-#include <backendsCommon/WorkloadData.hpp>
-#include <backendsCommon/WorkloadFactory.hpp>
-
 namespace armnn
 {
 
@@ -18,5 +12,4 @@ NormalizationLayer::NormalizationLayer(const NormalizationDescriptor& param, con
 {
 }
 
-
 } // namespace armnn
@@ -12,8 +12,6 @@ namespace armnn
 /// This layer represents a normalization operation.
 class NormalizationLayer : public LayerWithParameters<NormalizationDescriptor>
 {
-public:
-
 protected:
     /// Constructor to create a NormalizationLayer.
     /// @param [in] param NormalizationDescriptor to configure the normalization operation.
@@ -4,7 +4,6 @@
 //
 #include "OutputLayer.hpp"
 
-
 namespace armnn
 {
 
@@ -13,5 +12,4 @@ OutputLayer::OutputLayer(LayerBindingId id, const char* name)
 {
 }
 
-
 } // namespace armnn
@@ -12,8 +12,6 @@ namespace armnn
 /// A layer user-provided data can be bound to (e.g. inputs, outputs).
 class OutputLayer : public BindableLayer
 {
-public:
-
 protected:
     /// Constructor to create an OutputLayer.
     /// @param id The layer binding id number.
@@ -0,0 +1,46 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "PermuteLayer.hpp"
+
+#include <Permute.hpp>
+
+#include <boost/assert.hpp>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+PermuteLayer::PermuteLayer(const PermuteDescriptor& param, const char* name)
+    : LayerWithParameters(1, 1, LayerType::Permute, param, name)
+{
+}
+
+std::vector<TensorShape> PermuteLayer::InferOutputShapes(const std::vector<TensorShape>& inputShapes) const
+{
+    BOOST_ASSERT(inputShapes.size() == 1);
+    const TensorShape& inputShape = inputShapes[0];
+    const PermutationVector& mappings = m_Param.m_DimMappings;
+
+    const unsigned int numDimensions = inputShape.GetNumDimensions();
+    if (mappings.GetSize() != numDimensions)
+    {
+        throw LayerValidationException("PermuteLayer: the permutation must have one entry per input dimension.");
+    }
+
+    bool isMapped[MaxNumOfTensorDimensions] = {};
+    for (unsigned int i = 0; i < numDimensions; ++i)
+    {
+        if (mappings[i] >= numDimensions || isMapped[mappings[i]])
+        {
+            throw LayerValidationException("PermuteLayer: the dimension mappings are not a permutation.");
+        }
+        isMapped[mappings[i]] = true;
+    }
+
+    return std::vector<TensorShape>({ Permuted(inputShape, mappings) });
+}
+
+} // namespace armnn
@@ -0,0 +1,41 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "LayerWithParameters.hpp"
+
+namespace armnn
+{
+
+/// This layer represents a permutation of the dimensions of a tensor: dimension i of the input becomes dimension
+/// m_DimMappings[i] of the output.
+class PermuteLayer : public LayerWithParameters<PermuteDescriptor>
+{
+public:
+    /// Infers the output shape by permuting the dimensions of the input shape.
+    /// @param [in] inputShapes The input shapes layer has.
+    /// @return A vector to the inferred output shape.
+    std::vector<TensorShape> InferOutputShapes(const std::vector<TensorShape>& inputShapes) const override;
+
+    /// The permutation applied to the dimensions.
+    const PermutationVector& GetPermutation() const { return m_Param.m_DimMappings; }
+
+    /// Whether this permutation followed by the other one leaves tensors unchanged.
+    bool IsInverse(const PermuteLayer& other) const
+    {
+        return GetPermutation().IsInverse(other.GetPermutation());
+    }
+
+protected:
+    /// Constructor to create a PermuteLayer.
+    /// @param [in] param PermuteDescriptor to configure the permute operation.
+    /// @param [in] name Optional name for the layer.
+    PermuteLayer(const PermuteDescriptor& param, const char* name);
+
+    /// Default destructor
+    ~PermuteLayer() = default;
+};
+
+} // namespace
@@ -4,6 +4,9 @@
 //
 #include "Pooling2dLayer.hpp"
 
+#include <DataLayoutIndexed.hpp>
+
+#include <boost/assert.hpp>
 
 using namespace armnnUtils;
 
@@ -15,5 +18,79 @@ Pooling2dLayer::Pooling2dLayer(const Pooling2dDescriptor& param, const char* nam
 {
 }
 
+std::vector<TensorShape> Pooling2dLayer::InferOutputShapes(const std::vector<TensorShape>& inputShapes) const
+{
+    BOOST_ASSERT(inputShapes.size() == 1);
+    const TensorShape& inputShape = inputShapes[0];
+
+    // If we support multiple batch dimensions in the future, then this assert will need to change.
+    if (inputShape.GetNumDimensions() != 4)
+    {
+        throw LayerValidationException("Pooling2dLayer will always have 4D input.");
+    }
+
+    DataLayoutIndexed dimensionIndices(m_Param.m_DataLayout);
+
+    unsigned int inWidth = inputShape[dimensionIndices.GetWidthIndex()];
+    unsigned int inHeight = inputShape[dimensionIndices.GetHeightIndex()];
+    unsigned int inChannels = inputShape[dimensionIndices.GetChannelsIndex()];
+    unsigned int inBatchSize = inputShape[0];
+
+    bool isGlobalPooling = (m_Param.m_StrideX == 0 && m_Param.m_StrideY == 0);
+    unsigned int outWidth = 1;
+    unsigned int outHeight = 1;
+    if (!isGlobalPooling)
+    {
+        if (m_Param.m_StrideX == 0 || m_Param.m_StrideY == 0)
+        {
+            throw LayerValidationException("Stride can only be zero when performing global pooling");
+        }
+
+        auto CalcSize = [](unsigned int inSize, unsigned int lowPad, unsigned int highPad, unsigned int poolSize,
+                           unsigned int stride, OutputShapeRounding outputShapeRounding)
+            {
+                if (poolSize > inSize + lowPad + highPad)
+                {
+                    throw LayerValidationException("Pooling2dLayer: the pool is larger than the padded input.");
+                }
+
+                unsigned int readSize = inSize + lowPad + highPad - poolSize;
+                unsigned int size = 0;
+                switch (outputShapeRounding)
+                {
+                    case OutputShapeRounding::Ceiling:
+                        size = (readSize + stride - 1) / stride + 1;
+                        break;
+                    case OutputShapeRounding::Floor:
+                        size = readSize / stride + 1;
+                        break;
+                    default:
+                        throw LayerValidationException("Unsupported Output Shape Rounding");
+                }
+
+                // Make sure that border operations will start from inside the input and not the padded area.
+                // This is what both Caffe and CL do...
+                if ((size - 1) * stride >= inSize + lowPad)
+                {
+                    --size;
+                }
+
+                return size;
+            };
+
+        outWidth = CalcSize(inWidth, m_Param.m_PadLeft, m_Param.m_PadRight, m_Param.m_PoolWidth, m_Param.m_StrideX,
+                            m_Param.m_OutputShapeRounding);
+        outHeight = CalcSize(inHeight, m_Param.m_PadTop, m_Param.m_PadBottom, m_Param.m_PoolHeight,
+                             m_Param.m_StrideY, m_Param.m_OutputShapeRounding);
+    }
+    unsigned int outChannels = inChannels;
+    unsigned int outBatchSize = inBatchSize;
+
+    TensorShape tensorShape = m_Param.m_DataLayout == DataLayout::NHWC ?
+        TensorShape( { outBatchSize, outHeight, outWidth, outChannels } ) :
+        TensorShape( { outBatchSize, outChannels, outHeight, outWidth });
+
+    return std::vector<TensorShape>({ tensorShape });
+}
 
 } // namespace armnn
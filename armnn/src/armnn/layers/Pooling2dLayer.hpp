@@ -13,7 +13,11 @@ namespace armnn
 class Pooling2dLayer : public LayerWithParameters<Pooling2dDescriptor>
 {
 public:
-
+    /// By default returns inputShapes if the number of inputs are equal to number of outputs,
+    /// otherwise infers the output shapes from given input shapes and layer properties.
+    /// @param [in] inputShapes The input shapes layer has.
+    /// @return A vector to the inferred output shape.
+    std::vector<TensorShape> InferOutputShapes(const std::vector<TensorShape>& inputShapes) const override;
 
 protected:
     /// Constructor to create a Pooling2dLayer.
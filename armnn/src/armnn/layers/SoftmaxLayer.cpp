@@ -4,12 +4,6 @@
 //
 #include "SoftmaxLayer.hpp"
 
-#include "LayerCloneBase.hpp"
-
-#include <armnn/TypesUtils.hpp>
-#include <backendsCommon/WorkloadData.hpp>
-#include <backendsCommon/WorkloadFactory.hpp>
-
 namespace armnn
 {
 
@@ -18,6 +12,4 @@ SoftmaxLayer::SoftmaxLayer(const SoftmaxDescriptor &param, const char* name)
 {
 }
 
-
-
 } // namespace armnn
@@ -12,8 +12,6 @@ namespace armnn
 /// This layer represents a softmax operation.
 class SoftmaxLayer : public LayerWithParameters<SoftmaxDescriptor>
 {
-public:
-  
 protected:
     /// Constructor to create a SoftmaxLayer.
     /// @param [in] param SoftmaxDescriptor to configure the softmax operation.
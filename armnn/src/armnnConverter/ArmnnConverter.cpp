@@ -0,0 +1,425 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "CompilationCache.hpp"
+#include "NetworkOptimizer.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnnDeserializer/IDeserializer.hpp>
+#include <armnnSerializer/ISerializer.hpp>
+
+#include <Graph.hpp>
+#include <Hash.hpp>
+#include <MemoryPlanner.hpp>
+#include <Network.hpp>
+#include <NetworkFingerprint.hpp>
+#include <ThreadPool.hpp>
+
+#include <boost/cast.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace
+{
+
+namespace fs = boost::filesystem;
+namespace po = boost::program_options;
+
+/// Extension of the serialized networks the converter reads and writes.
+const char* const NetworkFileExtension = ".armnn";
+
+/// Version of the optimizations and of the file format they write, part of the keys of the compilation cache.
+/// Bump it whenever the networks the converter writes change, so that networks optimized differently are not taken
+/// from the cache.
+const uint64_t ConverterVersion = 1;
+
+struct ConverterOptions
+{
+    std::vector<std::string> m_InputPaths;
+    std::string              m_OutputDirectory;
+    unsigned int             m_NumJobs = 0;
+    bool                     m_ConvertToFp16 = false;
+    bool                     m_PackWeights = true;
+    std::string              m_CacheDirectory;
+    unsigned int             m_CacheSizeMiB = 0;
+    std::string              m_TempDirectory;
+};
+
+/// What converting one network took.
+struct ConversionReport
+{
+    fs::path    m_InputPath;
+    fs::path    m_OutputPath;
+    bool        m_Succeeded = false;
+    bool        m_CacheHit = false;
+    std::string m_Error;
+
+    double m_LoadSeconds = 0.0;
+    double m_OptimizeSeconds = 0.0;
+    double m_SaveSeconds = 0.0;
+
+    std::size_t m_NumLayers = 0;
+    std::size_t m_InputBytes = 0;
+    std::size_t m_OutputBytes = 0;
+    /// Memory reserved for the layers of the optimized graph.
+    std::size_t m_GraphBytes = 0;
+    /// Constant data (weights and their transformed copies) held by the optimized graph: resident on the heap, and
+    /// backed by files (the storage file of --temp-dir), which can be paged out. Weights used in place from the
+    /// input file are not counted.
+    std::size_t m_ConstantHeapBytes = 0;
+    std::size_t m_ConstantFileBytes = 0;
+    /// Size of the activation arena of the optimized network.
+    std::size_t m_ActivationBytes = 0;
+    /// Resident memory of the process once the network is saved, while it is still loaded, and its growth since the
+    /// conversion started. This covers all the allocations of the conversion, not only the graph and its constants,
+    /// but networks converted concurrently (--jobs) share the process: the growth is only that of one network with
+    /// a single job.
+    std::size_t m_ResidentBytes = 0;
+    int64_t     m_ResidentGrowthBytes = 0;
+};
+
+bool ParseCommandLineArgs(int argc, const char* argv[], ConverterOptions& options)
+{
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help,h", "Display usage information")
+        ("input,i", po::value<std::vector<std::string>>(&options.m_InputPaths)->composing(),
+         "Serialized networks to convert, or directories whose *.armnn files are all converted")
+        ("output-dir,o", po::value<std::string>(&options.m_OutputDirectory)->required(),
+         "Directory the optimized networks are written to, under the name of their input")
+        ("jobs,j", po::value<unsigned int>(&options.m_NumJobs)->default_value(0),
+         "Number of threads converting networks (0 for one per hardware thread)")
+        ("fp16", po::bool_switch(&options.m_ConvertToFp16),
+         "Store the weights and activations of the layers supporting it as Float16")
+        ("no-pack", po::bool_switch(),
+         "Do not store weights transformed for the kernels (packed for the GEMM, or for Winograd)")
+        ("cache-dir", po::value<std::string>(&options.m_CacheDirectory),
+         "Directory of previously optimized networks: a network already converted with the same options is copied "
+         "from there instead of being optimized again. It can be shared by several converters at a time")
+        ("cache-size", po::value<unsigned int>(&options.m_CacheSizeMiB)->default_value(4096),
+         "Size in MiB beyond which the least recently used networks are removed from the cache")
+        ("temp-dir", po::value<std::string>(&options.m_TempDirectory),
+         "Directory in which to keep the weights computed while optimizing (folded constants, packed or Winograd "
+         "weights) rather than in memory, for networks too large to convert otherwise");
+
+    po::positional_options_description positional;
+    positional.add("input", -1);
+
+    po::variables_map vm;
+    try
+    {
+        po::store(po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);
+        if (vm.count("help") || vm.count("input") == 0)
+        {
+            std::cout << "Converts serialized networks into optimized ones, several at a time." << std::endl
+                      << "Usage: ArmnnConverter [options] input..." << std::endl
+                      << desc << std::endl;
+            return false;
+        }
+        po::notify(vm);
+    }
+    catch (const po::error& e)
+    {
+        std::cerr << e.what() << std::endl << desc << std::endl;
+        return false;
+    }
+
+    options.m_PackWeights = !vm["no-pack"].as<bool>();
+    if (options.m_NumJobs == 0)
+    {
+        options.m_NumJobs = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    return true;
+}
+
+/// The networks to convert: the files given, and the files with the network extension in the directories given.
+std::vector<fs::path> FindInputFiles(const std::vector<std::string>& inputPaths)
+{
+    std::vector<fs::path> files;
+    for (const std::string& inputPath : inputPaths)
+    {
+        if (!fs::is_directory(inputPath))
+        {
+            files.emplace_back(inputPath);
+            continue;
+        }
+
+        std::vector<fs::path> directoryFiles;
+        for (const fs::directory_entry& entry : fs::directory_iterator(inputPath))
+        {
+            if (fs::is_regular_file(entry.path()) && entry.path().extension() == NetworkFileExtension)
+            {
+                directoryFiles.push_back(entry.path());
+            }
+        }
+        std::sort(directoryFiles.begin(), directoryFiles.end());
+        files.insert(files.end(), directoryFiles.begin(), directoryFiles.end());
+    }
+    return files;
+}
+
+/// Resident set size of the process, from /proc/self/statm (0 if it cannot be read).
+std::size_t GetResidentBytes()
+{
+    std::ifstream statm("/proc/self/statm");
+    std::size_t totalPages = 0;
+    std::size_t residentPages = 0;
+    if (!(statm >> totalPages >> residentPages))
+    {
+        return 0;
+    }
+    return residentPages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+/// Peak resident set size of the process so far.
+std::size_t GetPeakResidentBytes()
+{
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024; // In KiB on Linux.
+}
+
+double SecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/// The key of a network in the compilation cache: the network and everything else its conversion depends on.
+uint64_t GetCacheKey(uint64_t fingerprint, const ConverterOptions& options)
+{
+    uint64_t key = armnnUtils::HashCombine(fingerprint, ConverterVersion);
+    key = armnnUtils::HashCombine(key, options.m_ConvertToFp16 ? 1u : 0u);
+    key = armnnUtils::HashCombine(key, options.m_PackWeights ? 1u : 0u);
+    return key;
+}
+
+/// Loads, optimizes and saves one network, or copies it from the cache if one is given and has it. The weight
+/// transforms of the network are spread over the pool too.
+void ConvertNetwork(const ConverterOptions& options,
+                    const armnnConverter::CompilationCache* cache,
+                    armnnUtils::ThreadPool& threadPool,
+                    ConversionReport& report)
+{
+    using namespace armnn;
+
+    const std::size_t residentAtStart = GetResidentBytes();
+    auto start = std::chrono::steady_clock::now();
+    report.m_InputBytes = fs::file_size(report.m_InputPath);
+    armnnDeserializer::IDeserializerPtr deserializer = armnnDeserializer::IDeserializer::Create();
+    INetworkPtr network = deserializer->CreateNetworkFromBinaryFile(report.m_InputPath.string().c_str());
+    Graph& graph = boost::polymorphic_downcast<Network*>(network.get())->GetGraph();
+    const uint64_t cacheKey = (cache != nullptr) ? GetCacheKey(ComputeFingerprint(graph), options) : 0;
+    report.m_LoadSeconds = SecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    if (cache != nullptr && cache->Fetch(cacheKey, report.m_OutputPath))
+    {
+        report.m_CacheHit    = true;
+        report.m_OutputBytes = fs::file_size(report.m_OutputPath);
+        report.m_SaveSeconds = SecondsSince(start);
+        return;
+    }
+
+    start = std::chrono::steady_clock::now();
+    if (!options.m_TempDirectory.empty())
+    {
+        network->SetConstantStorageDirectory(options.m_TempDirectory);
+    }
+    network->InferTensorInfos();
+    armnnConverter::OptimizerOptions optimizerOptions;
+    optimizerOptions.m_ConvertToFp16 = options.m_ConvertToFp16;
+    optimizerOptions.m_PackWeights   = options.m_PackWeights;
+    const MemoryPlan memoryPlan = armnnConverter::OptimizeNetwork(graph, optimizerOptions, &threadPool);
+    report.m_OptimizeSeconds = SecondsSince(start);
+
+    const ConstantPool& constantPool = graph.GetConstantPool();
+    report.m_NumLayers         = graph.GetNumLayers();
+    report.m_GraphBytes        = graph.GetAllocator().GetBytesReserved();
+    report.m_ConstantHeapBytes = constantPool.GetBytesOnHeap();
+    report.m_ConstantFileBytes = constantPool.GetBytesInStorageFile() + constantPool.GetBytesMapped();
+    report.m_ActivationBytes   = memoryPlan.m_ArenaSize;
+
+    // Written next to its destination then renamed, so that no reader sees a partial file, and so that converting
+    // a network in place doesn't overwrite the mapped file it is read from.
+    start = std::chrono::steady_clock::now();
+    armnnSerializer::ISerializerPtr serializer = armnnSerializer::ISerializer::Create();
+    serializer->Serialize(*network);
+    const fs::path temporaryPath = report.m_OutputPath.string() + ".tmp";
+    {
+        std::ofstream file(temporaryPath.string(), std::ios::binary);
+        if (!serializer->SaveSerializedToStream(file) || !file.flush())
+        {
+            throw armnn::Exception(boost::str(boost::format("Failed to write %1%") % temporaryPath.string()));
+        }
+    }
+    fs::rename(temporaryPath, report.m_OutputPath);
+    report.m_OutputBytes = fs::file_size(report.m_OutputPath);
+    if (cache != nullptr)
+    {
+        // The network is converted anyway: failing to cache it only costs the next conversion.
+        cache->Store(cacheKey, report.m_OutputPath);
+    }
+    report.m_SaveSeconds = SecondsSince(start);
+
+    report.m_ResidentBytes       = GetResidentBytes();
+    report.m_ResidentGrowthBytes = int64_t(report.m_ResidentBytes) - int64_t(residentAtStart);
+}
+
+std::string FormatBytes(std::size_t bytes)
+{
+    return boost::str(boost::format("%.1f KiB") % (double(bytes) / 1024.0));
+}
+
+std::string FormatByteDelta(int64_t bytes)
+{
+    return boost::str(boost::format("%+.1f KiB") % (double(bytes) / 1024.0));
+}
+
+void PrintReports(const std::vector<ConversionReport>& reports, double wallSeconds, unsigned int numJobs)
+{
+    double totalSeconds = 0.0;
+    unsigned int numFailed = 0;
+    unsigned int numCacheHits = 0;
+    for (const ConversionReport& report : reports)
+    {
+        if (!report.m_Succeeded)
+        {
+            std::cout << report.m_InputPath.string() << ": FAILED: " << report.m_Error << std::endl;
+            ++numFailed;
+            continue;
+        }
+
+        const double seconds = report.m_LoadSeconds + report.m_OptimizeSeconds + report.m_SaveSeconds;
+        totalSeconds += seconds;
+        if (report.m_CacheHit)
+        {
+            std::cout << boost::format("%1%: cached, %2$.3f s (load %3$.3f, copy %4$.3f), file %5% -> %6%")
+                         % report.m_InputPath.string() % seconds % report.m_LoadSeconds % report.m_SaveSeconds
+                         % FormatBytes(report.m_InputBytes) % FormatBytes(report.m_OutputBytes)
+                      << std::endl;
+            ++numCacheHits;
+            continue;
+        }
+        std::cout << boost::format("%1%: %2% layers, %3$.3f s (load %4$.3f, optimize %5$.3f, save %6$.3f), "
+                                   "file %7% -> %8%, graph %9%, constants %10% + %11% file-backed, activations %12%, "
+                                   "RSS %13% (%14%)")
+                     % report.m_InputPath.string() % report.m_NumLayers % seconds % report.m_LoadSeconds
+                     % report.m_OptimizeSeconds % report.m_SaveSeconds % FormatBytes(report.m_InputBytes)
+                     % FormatBytes(report.m_OutputBytes) % FormatBytes(report.m_GraphBytes)
+                     % FormatBytes(report.m_ConstantHeapBytes) % FormatBytes(report.m_ConstantFileBytes)
+                     % FormatBytes(report.m_ActivationBytes) % FormatBytes(report.m_ResidentBytes)
+                     % FormatByteDelta(report.m_ResidentGrowthBytes)
+                  << std::endl;
+    }
+
+    std::cout << boost::format("Converted %1% of %2% networks (%3% from the cache) in %4$.3f s on %5% threads "
+                               "(%6$.3f s of conversion, %7$.2fx), peak RSS %8%")
+                 % (reports.size() - numFailed) % reports.size() % numCacheHits % wallSeconds % numJobs
+                 % totalSeconds % (wallSeconds > 0.0 ? totalSeconds / wallSeconds : 0.0)
+                 % FormatBytes(GetPeakResidentBytes())
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    ConverterOptions options;
+    if (!ParseCommandLineArgs(argc, argv, options))
+    {
+        return EXIT_FAILURE;
+    }
+
+    std::vector<ConversionReport> reports;
+    std::unique_ptr<armnnConverter::CompilationCache> cache;
+    try
+    {
+        fs::create_directories(options.m_OutputDirectory);
+        if (!options.m_CacheDirectory.empty())
+        {
+            cache.reset(new armnnConverter::CompilationCache(options.m_CacheDirectory,
+                                                             uintmax_t(options.m_CacheSizeMiB) * 1024 * 1024));
+        }
+        // The outputs all go to one directory, by file name: inputs of the same name from different directories
+        // would overwrite each other's output, and write the same temporary file concurrently.
+        std::unordered_map<std::string, fs::path> inputPathsByOutput;
+        for (const fs::path& inputPath : FindInputFiles(options.m_InputPaths))
+        {
+            ConversionReport report;
+            report.m_InputPath  = inputPath;
+            report.m_OutputPath = fs::path(options.m_OutputDirectory) / inputPath.filename();
+            auto inserted = inputPathsByOutput.emplace(report.m_OutputPath.string(), inputPath);
+            if (!inserted.second)
+            {
+                std::cerr << boost::format("%1% and %2% would both be converted to %3%")
+                             % inserted.first->second.string() % inputPath.string() % report.m_OutputPath.string()
+                          << std::endl;
+                return EXIT_FAILURE;
+            }
+            reports.push_back(report);
+        }
+    }
+    catch (const fs::filesystem_error& e)
+    {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // The largest networks are queued first, so that they are not left for the end. The threads stealing work
+    // take the oldest tasks, the calling thread the newest.
+    std::vector<std::size_t> order(reports.size());
+    std::vector<uintmax_t> sizes(reports.size());
+    for (std::size_t i = 0; i < reports.size(); ++i)
+    {
+        order[i] = i;
+        boost::system::error_code error;
+        sizes[i] = fs::file_size(reports[i].m_InputPath, error);
+    }
+    std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b)
+    {
+        return sizes[a] > sizes[b];
+    });
+
+    const auto start = std::chrono::steady_clock::now();
+    armnnUtils::ThreadPool threadPool(options.m_NumJobs - 1);
+    threadPool.ParallelFor(reports.size(), [&](std::size_t i)
+    {
+        ConversionReport& report = reports[order[i]];
+        try
+        {
+            ConvertNetwork(options, cache.get(), threadPool, report);
+            report.m_Succeeded = true;
+        }
+        catch (const std::exception& e)
+        {
+            report.m_Error = e.what();
+        }
+    });
+
+    PrintReports(reports, SecondsSince(start), options.m_NumJobs);
+    const bool allSucceeded = std::all_of(reports.begin(), reports.end(), [](const ConversionReport& report)
+    {
+        return report.m_Succeeded;
+    });
+    return allSucceeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,153 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "CompilationCache.hpp"
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <ctime>
+#include <string>
+#include <vector>
+
+namespace armnnConverter
+{
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+const char* const EntryExtension = ".armnn";
+const char* const TemporaryExtension = ".tmp";
+
+/// Temporary files older than this are left over by a process which died writing them.
+const std::time_t StaleTemporarySeconds = 60 * 60;
+
+/// A name no other thread or process is using, in the given directory.
+fs::path GetTemporaryPath(const fs::path& directory)
+{
+    return directory / fs::unique_path(std::string("%%%%-%%%%-%%%%-%%%%") + TemporaryExtension);
+}
+
+/// Copies the file to a temporary file of the destination directory, then renames it to the destination.
+bool CopyAtomically(const fs::path& source, const fs::path& destination)
+{
+    boost::system::error_code error;
+    const fs::path temporaryPath = GetTemporaryPath(destination.parent_path());
+    fs::copy_file(source, temporaryPath, error);
+    if (!error)
+    {
+        fs::rename(temporaryPath, destination, error);
+    }
+    if (error)
+    {
+        boost::system::error_code ignored;
+        fs::remove(temporaryPath, ignored);
+        return false;
+    }
+    return true;
+}
+
+struct Entry
+{
+    fs::path    m_Path;
+    uintmax_t   m_Size;
+    std::time_t m_LastUse;
+};
+
+} // namespace
+
+CompilationCache::CompilationCache(const fs::path& directory, uintmax_t maxBytes)
+: m_Directory(directory)
+, m_MaxBytes(maxBytes)
+{
+    fs::create_directories(m_Directory);
+}
+
+bool CompilationCache::Fetch(uint64_t key, const fs::path& destination) const
+{
+    const fs::path entryPath = GetEntryPath(key);
+    if (!CopyAtomically(entryPath, destination))
+    {
+        return false;
+    }
+
+    // Racing with an eviction is harmless: the entry is either gone, or kept a little longer.
+    boost::system::error_code ignored;
+    fs::last_write_time(entryPath, std::time(nullptr), ignored);
+    return true;
+}
+
+bool CompilationCache::Store(uint64_t key, const fs::path& file) const
+{
+    // Other converters storing the same key concurrently write the same network: whichever rename comes last wins.
+    if (!CopyAtomically(file, GetEntryPath(key)))
+    {
+        return false;
+    }
+    Evict();
+    return true;
+}
+
+fs::path CompilationCache::GetEntryPath(uint64_t key) const
+{
+    return m_Directory / (boost::str(boost::format("%016x") % key) + EntryExtension);
+}
+
+void CompilationCache::Evict() const
+{
+    const std::time_t now = std::time(nullptr);
+
+    std::vector<Entry> entries;
+    uintmax_t totalBytes = 0;
+    boost::system::error_code error;
+    for (fs::directory_iterator it(m_Directory, error), end; !error && it != end; it.increment(error))
+    {
+        const fs::path& path = it->path();
+        boost::system::error_code entryError;
+        const std::time_t lastUse = fs::last_write_time(path, entryError);
+        const uintmax_t size = fs::file_size(path, entryError);
+        if (entryError)
+        {
+            // Removed by another process since it was listed.
+            continue;
+        }
+
+        if (path.extension() == TemporaryExtension)
+        {
+            if (now - lastUse > StaleTemporarySeconds)
+            {
+                fs::remove(path, entryError);
+            }
+        }
+        else if (path.extension() == EntryExtension)
+        {
+            entries.push_back({ path, size, lastUse });
+            totalBytes += size;
+        }
+    }
+
+    if (totalBytes <= m_MaxBytes)
+    {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b)
+    {
+        return a.m_LastUse < b.m_LastUse;
+    });
+    for (const Entry& entry : entries)
+    {
+        if (totalBytes <= m_MaxBytes)
+        {
+            break;
+        }
+        boost::system::error_code ignored;
+        fs::remove(entry.m_Path, ignored);
+        totalBytes -= entry.m_Size;
+    }
+}
+
+} // namespace armnnConverter
@@ -0,0 +1,48 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <boost/filesystem.hpp>
+
+#include <cstdint>
+
+namespace armnnConverter
+{
+
+/// A directory of optimized networks keyed by a hash of the input network and of the conversion settings, so that
+/// converting a network again is a copy of the file optimized the first time.
+///
+/// The cache is shared by the threads of a converter and by any number of converter processes, without locks:
+/// - entries are written under a unique temporary name then renamed, so readers see either no entry or a whole one;
+/// - entries are copied out, so an entry removed while it is read stays readable by its reader;
+/// - the eviction tolerates entries vanishing under it, removed by another process.
+///
+/// Entries are evicted least recently used first, once the entries total more than the size limit. The modification
+/// time of an entry is its time of last use: it is updated on every hit.
+class CompilationCache
+{
+public:
+    /// Creates the directory if it doesn't exist.
+    CompilationCache(const boost::filesystem::path& directory, uintmax_t maxBytes);
+
+    /// Copies the entry for the key to the destination, replacing the destination atomically.
+    /// @return false if there is no entry for the key, or it could not be copied.
+    bool Fetch(uint64_t key, const boost::filesystem::path& destination) const;
+
+    /// Adds a copy of the file as the entry for the key, then evicts the least recently used entries beyond the
+    /// size limit. Failing to store (e.g. when the disk is full) leaves the cache unchanged.
+    /// @return false if the entry could not be stored.
+    bool Store(uint64_t key, const boost::filesystem::path& file) const;
+
+private:
+    boost::filesystem::path GetEntryPath(uint64_t key) const;
+
+    void Evict() const;
+
+    boost::filesystem::path m_Directory;
+    uintmax_t               m_MaxBytes;
+};
+
+} // namespace armnnConverter
@@ -0,0 +1,43 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "NetworkOptimizer.hpp"
+
+#include <CommonSubexpressionElimination.hpp>
+#include <Fp16Conversion.hpp>
+#include <Graph.hpp>
+#include <LayerFusion.hpp>
+#include <LayoutOptimization.hpp>
+#include <RefConstantFolding.hpp>
+#include <WeightPacking.hpp>
+#include <Winograd.hpp>
+
+namespace armnnConverter
+{
+
+armnn::MemoryPlan OptimizeNetwork(armnn::Graph& graph,
+                                  const OptimizerOptions& options,
+                                  armnnUtils::ThreadPool* threadPool)
+{
+    using namespace armnn;
+
+    // Also removes the layers which don't contribute to any output, whether or not any layer is folded.
+    FoldConstants(graph);
+    // Before the fusions, which only apply to layers with a single consumer.
+    EliminateCommonSubexpressions(graph);
+    FuseLayers(graph);
+    OptimizeLayout(graph);
+    if (options.m_ConvertToFp16)
+    {
+        ConvertToFp16(graph);
+    }
+    if (options.m_PackWeights)
+    {
+        PrepareWinogradConvolutions(graph, threadPool);
+        PackWeights(graph, threadPool);
+    }
+    return PlanActivationMemory(graph);
+}
+
+} // namespace armnnConverter
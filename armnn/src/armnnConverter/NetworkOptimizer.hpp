@@ -0,0 +1,39 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <MemoryPlanner.hpp>
+
+namespace armnn
+{
+class Graph;
+}
+
+namespace armnnUtils
+{
+class ThreadPool;
+}
+
+namespace armnnConverter
+{
+
+struct OptimizerOptions
+{
+    /// Stores the weights and activations of the layers supporting it as Float16 (see ConvertToFp16()).
+    bool m_ConvertToFp16 = false;
+    /// Stores the weights transformed for the kernels: packed for the GEMM, or for Winograd.
+    bool m_PackWeights = true;
+};
+
+/// Runs the optimizations of the converter on the graph, in order: constant folding (which also removes the layers
+/// not contributing to any output), common subexpression elimination, layer fusion, layout optimization, then the
+/// optional Float16 conversion and weight transforms, and finally plans the activation memory.
+/// The TensorInfos of the graph must be set. The weight transforms are spread over the pool if one is given.
+/// @return The activation memory plan of the optimized graph.
+armnn::MemoryPlan OptimizeNetwork(armnn::Graph& graph,
+                                  const OptimizerOptions& options,
+                                  armnnUtils::ThreadPool* threadPool = nullptr);
+
+} // namespace armnnConverter
@@ -0,0 +1,233 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "../NetworkOptimizer.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+#include <armnnDeserializer/IDeserializer.hpp>
+#include <armnnSerializer/ISerializer.hpp>
+
+#include <Graph.hpp>
+#include <LayersFwd.hpp>
+#include <Network.hpp>
+#include <NetworkFingerprint.hpp>
+
+#include <boost/cast.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+const unsigned int NumChannels = 5;
+const unsigned int NumFilters = 13;
+const unsigned int NumFcInputs = 37;
+const unsigned int NumFcOutputs = 51;
+
+/// Weights with distinct values, kept alive for the networks referencing them.
+struct Weights
+{
+    Weights()
+    : m_ConvWeights(NumFilters * 3 * 3 * NumChannels)
+    , m_ConvBiases(NumFilters)
+    , m_FcWeights(NumFcInputs * NumFcOutputs)
+    , m_FcBiases(NumFcOutputs)
+    {
+        for (std::size_t i = 0; i < m_ConvWeights.size(); ++i)
+        {
+            m_ConvWeights[i] = std::cos(float(i) * 0.11f);
+        }
+        for (std::size_t i = 0; i < m_FcWeights.size(); ++i)
+        {
+            m_FcWeights[i] = std::cos(float(i) * 0.37f);
+        }
+        for (std::size_t i = 0; i < m_ConvBiases.size(); ++i)
+        {
+            m_ConvBiases[i] = float(i) * 0.1f;
+        }
+        for (std::size_t i = 0; i < m_FcBiases.size(); ++i)
+        {
+            m_FcBiases[i] = float(i) * 0.01f;
+        }
+    }
+
+    std::vector<float> m_ConvWeights;
+    std::vector<float> m_ConvBiases;
+    std::vector<float> m_FcWeights;
+    std::vector<float> m_FcBiases;
+};
+
+/// Two independent branches: a convolution followed by a ReLu (which fuses into it), and a fully connected layer.
+/// The branches are added in either order.
+INetworkPtr CreateNetwork(const Weights& weights, bool convolutionFirst)
+{
+    INetworkPtr network = INetwork::Create();
+
+    auto addConvolutionBranch = [&]()
+    {
+        IConnectableLayer* const input = network->AddInputLayer(0, "input");
+        input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 7, 9, NumChannels }, DataType::Float32));
+
+        Convolution2dDescriptor descriptor;
+        descriptor.m_BiasEnabled = true;
+        descriptor.m_DataLayout = DataLayout::NHWC;
+        descriptor.m_StrideX = 2;
+        descriptor.m_StrideY = 1;
+        IConnectableLayer* const convolution = network->AddConvolution2dLayer(
+            descriptor,
+            ConstTensor(TensorInfo({ NumFilters, 3, 3, NumChannels }, DataType::Float32), weights.m_ConvWeights.data()),
+            ConstTensor(TensorInfo({ NumFilters }, DataType::Float32), weights.m_ConvBiases.data()),
+            "convolution");
+
+        ActivationDescriptor relu;
+        relu.m_Function = ActivationFunction::ReLu;
+        IConnectableLayer* const activation = network->AddActivationLayer(relu, "relu");
+
+        input->GetOutputSlot(0).Connect(convolution->GetInputSlot(0));
+        convolution->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+        activation->GetOutputSlot(0).Connect(network->AddOutputLayer(0, "output")->GetInputSlot(0));
+    };
+
+    auto addFullyConnectedBranch = [&]()
+    {
+        IConnectableLayer* const input = network->AddInputLayer(1, "input2");
+        input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, NumFcInputs }, DataType::Float32));
+
+        FullyConnectedDescriptor descriptor;
+        descriptor.m_BiasEnabled = true;
+        IConnectableLayer* const fullyConnected = network->AddFullyConnectedLayer(
+            descriptor,
+            ConstTensor(TensorInfo({ NumFcInputs, NumFcOutputs }, DataType::Float32), weights.m_FcWeights.data()),
+            ConstTensor(TensorInfo({ NumFcOutputs }, DataType::Float32), weights.m_FcBiases.data()),
+            "fc");
+
+        input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+        fullyConnected->GetOutputSlot(0).Connect(network->AddOutputLayer(1, "output2")->GetInputSlot(0));
+    };
+
+    if (convolutionFirst)
+    {
+        addConvolutionBranch();
+        addFullyConnectedBranch();
+    }
+    else
+    {
+        addFullyConnectedBranch();
+        addConvolutionBranch();
+    }
+    network->InferTensorInfos();
+    return network;
+}
+
+Graph& GetGraph(INetwork& network)
+{
+    return boost::polymorphic_downcast<Network*>(&network)->GetGraph();
+}
+
+/// A network saved then loaded again. The serialized data is kept by the test, as the network references it.
+class SavedAndLoaded
+{
+public:
+    explicit SavedAndLoaded(const INetwork& network)
+    : m_Deserializer(armnnDeserializer::IDeserializer::Create())
+    , m_Network(nullptr, nullptr)
+    {
+        armnnSerializer::ISerializerPtr serializer = armnnSerializer::ISerializer::Create();
+        serializer->Serialize(network);
+        std::stringstream stream;
+        BOOST_REQUIRE(serializer->SaveSerializedToStream(stream));
+        const std::string data = stream.str();
+
+        // The deserializer needs the data 64-byte aligned.
+        m_Storage.resize(data.size() + 64);
+        void* aligned = m_Storage.data();
+        std::size_t space = m_Storage.size();
+        BOOST_REQUIRE(std::align(64, data.size(), aligned, space) != nullptr);
+        std::memcpy(aligned, data.data(), data.size());
+        m_Network = m_Deserializer->CreateNetworkFromBinary(aligned, data.size());
+    }
+
+    INetwork& GetNetwork() { return *m_Network; }
+
+private:
+    std::vector<char>                   m_Storage;
+    armnnDeserializer::IDeserializerPtr m_Deserializer;
+    INetworkPtr                         m_Network;
+};
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(NetworkFingerprint)
+
+BOOST_AUTO_TEST_CASE(SameOnceSavedAndLoaded)
+{
+    const Weights weights;
+    for (bool packWeights : { false, true })
+    {
+        BOOST_TEST_CONTEXT("packWeights " << packWeights)
+        {
+            INetworkPtr network = CreateNetwork(weights, true);
+            Graph& graph = GetGraph(*network);
+            armnnConverter::OptimizerOptions options;
+            options.m_PackWeights = packWeights;
+            armnnConverter::OptimizeNetwork(graph, options);
+
+            // The ReLu is fused into the convolution, and the weights are packed if asked to.
+            BOOST_TEST(graph.FindLayer("relu") == nullptr);
+            const auto& convolution = *boost::polymorphic_downcast<Convolution2dLayer*>(graph.FindLayer("convolution"));
+            const auto& fullyConnected = *boost::polymorphic_downcast<FullyConnectedLayer*>(graph.FindLayer("fc"));
+            BOOST_TEST(convolution.m_HasFusedActivation);
+            BOOST_TEST((convolution.m_PackedWeight.GetMemoryArea() != nullptr) == packWeights);
+            BOOST_TEST((fullyConnected.m_PackedWeight.GetMemoryArea() != nullptr) == packWeights);
+
+            SavedAndLoaded loaded(*network);
+            BOOST_TEST(ComputeFingerprint(GetGraph(loaded.GetNetwork())) == ComputeFingerprint(graph));
+
+            // And again, from a network which was loaded itself.
+            SavedAndLoaded reloaded(loaded.GetNetwork());
+            BOOST_TEST(ComputeFingerprint(GetGraph(reloaded.GetNetwork())) == ComputeFingerprint(graph));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(IndependentOfTheOrderOfTheLayers)
+{
+    const Weights weights;
+    INetworkPtr network = CreateNetwork(weights, true);
+    INetworkPtr reordered = CreateNetwork(weights, false);
+    BOOST_TEST((*GetGraph(*network).TopologicalSort().begin())->GetNameStr() !=
+               (*GetGraph(*reordered).TopologicalSort().begin())->GetNameStr());
+    BOOST_TEST(ComputeFingerprint(GetGraph(*network)) == ComputeFingerprint(GetGraph(*reordered)));
+}
+
+BOOST_AUTO_TEST_CASE(DependsOnTheWeights)
+{
+    const Weights weights;
+    Weights otherWeights;
+    otherWeights.m_FcWeights[7] += 1.0f;
+    for (bool packWeights : { false, true })
+    {
+        BOOST_TEST_CONTEXT("packWeights " << packWeights)
+        {
+            armnnConverter::OptimizerOptions options;
+            options.m_PackWeights = packWeights;
+            INetworkPtr network = CreateNetwork(weights, true);
+            armnnConverter::OptimizeNetwork(GetGraph(*network), options);
+            INetworkPtr other = CreateNetwork(otherWeights, true);
+            armnnConverter::OptimizeNetwork(GetGraph(*other), options);
+            BOOST_TEST(ComputeFingerprint(GetGraph(*network)) != ComputeFingerprint(GetGraph(*other)));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,54 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "../NetworkOptimizer.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+
+#include <Graph.hpp>
+#include <Network.hpp>
+
+#include <boost/cast.hpp>
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(NetworkOptimizer)
+
+BOOST_AUTO_TEST_CASE(RemovesDeadBranchesWithoutConstants)
+{
+    using namespace armnn;
+
+    // input -> relu -> output, with a chain of two sigmoids reading the input which reaches no output. There is
+    // nothing to fold.
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* const input = network->AddInputLayer(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 8 }, DataType::Float32));
+
+    ActivationDescriptor relu;
+    relu.m_Function = ActivationFunction::ReLu;
+    IConnectableLayer* const live = network->AddActivationLayer(relu, "relu");
+    input->GetOutputSlot(0).Connect(live->GetInputSlot(0));
+    live->GetOutputSlot(0).Connect(network->AddOutputLayer(0, "output")->GetInputSlot(0));
+
+    ActivationDescriptor sigmoid;
+    sigmoid.m_Function = ActivationFunction::Sigmoid;
+    IConnectableLayer* const dead = network->AddActivationLayer(sigmoid, "sigmoid");
+    input->GetOutputSlot(0).Connect(dead->GetInputSlot(0));
+    IConnectableLayer* const deadConsumer = network->AddActivationLayer(sigmoid, "sigmoid2");
+    dead->GetOutputSlot(0).Connect(deadConsumer->GetInputSlot(0));
+
+    network->InferTensorInfos();
+    Graph& graph = boost::polymorphic_downcast<Network*>(network.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 5);
+
+    armnnConverter::OptimizeNetwork(graph, armnnConverter::OptimizerOptions());
+
+    BOOST_TEST(graph.GetNumLayers() == 3);
+    BOOST_TEST(graph.FindLayer("sigmoid") == nullptr);
+    BOOST_TEST(graph.FindLayer("sigmoid2") == nullptr);
+    BOOST_TEST(graph.FindLayer("relu") != nullptr);
+    BOOST_TEST(graph.FindLayer("input")->GetOutputSlot(0).GetNumConnections() == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
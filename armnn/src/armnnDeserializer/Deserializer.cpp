@@ -0,0 +1,625 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "Deserializer.hpp"
+
+#include <armnnSerializer/SerializerFormat.hpp>
+#include <armnnSerializer/SerializerUtils.hpp>
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Exceptions.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <Graph.hpp>
+#include <InternalTypes.hpp>
+#include <LayerFusion.hpp>
+#include <LayersFwd.hpp>
+#include <Network.hpp>
+#include <WeightPacking.hpp>
+#include <Winograd.hpp>
+
+#include <DataLayoutIndexed.hpp>
+
+#include <boost/cast.hpp>
+#include <boost/format.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace armnn;
+using namespace armnnSerializer;
+
+namespace armnnDeserializer
+{
+
+namespace
+{
+
+/// A typed view of a section of the serialized data.
+template <typename T>
+struct Section
+{
+    const T*    m_Data = nullptr;
+    std::size_t m_Size = 0;
+
+    const T& operator[](std::size_t index) const { return m_Data[index]; }
+};
+
+/// Checks that [first, first + count) fits in a section of the given size.
+void CheckRange(uint64_t first, uint64_t count, std::size_t size, const char* what)
+{
+    if (first > size || count > size - first)
+    {
+        throw ParseException(boost::str(boost::format("Invalid network file: %1% out of range") % what));
+    }
+}
+
+class NetworkReader
+{
+public:
+    NetworkReader(const uint8_t* data, std::size_t size)
+    : m_Data(data)
+    , m_Size(size)
+    {
+        if (size < sizeof(FileHeader))
+        {
+            throw ParseException("Invalid network file: too small");
+        }
+
+        const FileHeader& header = *reinterpret_cast<const FileHeader*>(data);
+        if (std::memcmp(header.m_Magic, FileMagic, sizeof(FileMagic)) != 0)
+        {
+            throw ParseException("Invalid network file: bad magic number");
+        }
+        if (header.m_Version != FormatVersion)
+        {
+            throw ParseException(boost::str(boost::format("Unsupported network file version %1% (expected %2%)")
+                                            % header.m_Version % FormatVersion));
+        }
+
+        CheckRange(sizeof(FileHeader), uint64_t(header.m_NumSections) * sizeof(SectionEntry), size, "directory");
+        m_Directory.m_Data = reinterpret_cast<const SectionEntry*>(data + sizeof(FileHeader));
+        m_Directory.m_Size = header.m_NumSections;
+
+        m_Strings      = GetSection<char>(SectionId::Strings, 1);
+        m_Layers       = GetSection<LayerRecord>(SectionId::Layers, SectionAlignment);
+        m_InputSlots   = GetSection<InputSlotRecord>(SectionId::InputSlots, SectionAlignment);
+        m_OutputSlots  = GetSection<OutputSlotRecord>(SectionId::OutputSlots, SectionAlignment);
+        m_Descriptors  = GetSection<uint32_t>(SectionId::Descriptors, SectionAlignment);
+        m_Constants    = GetSection<ConstantRecord>(SectionId::Constants, SectionAlignment);
+        m_ConstantData = GetSection<uint8_t>(SectionId::ConstantData, ConstantAlignment);
+
+        m_MemoryPlan        = GetSection<MemoryPlanRecord>(SectionId::MemoryPlan, SectionAlignment);
+        m_OutputSlotOffsets = GetSection<uint64_t>(SectionId::OutputSlotOffsets, SectionAlignment);
+        m_TransformedConstants = GetSection<TransformedConstantRecord>(SectionId::TransformedConstants,
+                                                                       SectionAlignment);
+        if (m_MemoryPlan.m_Size > 1 ||
+            (m_MemoryPlan.m_Size == 1 && m_OutputSlotOffsets.m_Size != m_OutputSlots.m_Size))
+        {
+            throw ParseException("Invalid network file: bad memory plan");
+        }
+    }
+
+    INetworkPtr CreateNetwork()
+    {
+        INetworkPtr network = INetwork::Create();
+
+        // The constant tensors are used where they are, without being copied or even read.
+        boost::polymorphic_downcast<Network*>(network.get())->GetGraph().GetConstantPool().AddExternalRegion(
+            m_ConstantData.m_Data, m_ConstantData.m_Size);
+
+        std::vector<IConnectableLayer*> layers;
+        layers.reserve(m_Layers.m_Size);
+
+        for (std::size_t layerIndex = 0; layerIndex < m_Layers.m_Size; ++layerIndex)
+        {
+            const LayerRecord& record = m_Layers[layerIndex];
+
+            CheckRange(record.m_FirstInputSlot, record.m_NumInputSlots, m_InputSlots.m_Size, "input slots");
+            CheckRange(record.m_FirstOutputSlot, record.m_NumOutputSlots, m_OutputSlots.m_Size, "output slots");
+            CheckRange(record.m_DescriptorOffset, record.m_DescriptorSize, m_Descriptors.m_Size, "descriptor");
+            CheckRange(record.m_FirstConstant, record.m_NumConstants, m_Constants.m_Size, "constants");
+
+            IConnectableLayer* const layer = AddLayer(*network, record);
+            if (layer->GetNumInputSlots() != record.m_NumInputSlots ||
+                layer->GetNumOutputSlots() != record.m_NumOutputSlots)
+            {
+                throw ParseException("Invalid network file: slot count doesn't match the layer type");
+            }
+
+            for (uint32_t i = 0; i < record.m_NumOutputSlots; ++i)
+            {
+                const OutputSlotRecord& slotRecord = m_OutputSlots[record.m_FirstOutputSlot + i];
+                if (slotRecord.m_IsTensorInfoSet != 0)
+                {
+                    layer->GetOutputSlot(i).SetTensorInfo(ToTensorInfo(slotRecord.m_TensorInfo));
+                }
+                if (m_MemoryPlan.m_Size != 0)
+                {
+                    SetMemoryOffset(*layer, i, m_OutputSlotOffsets[record.m_FirstOutputSlot + i]);
+                }
+            }
+
+            for (uint32_t i = 0; i < record.m_NumInputSlots; ++i)
+            {
+                const InputSlotRecord& slotRecord = m_InputSlots[record.m_FirstInputSlot + i];
+                if (slotRecord.m_SourceLayer == InvalidIndex)
+                {
+                    continue;
+                }
+                if (slotRecord.m_SourceLayer >= layerIndex ||
+                    slotRecord.m_SourceSlot >= layers[slotRecord.m_SourceLayer]->GetNumOutputSlots())
+                {
+                    throw ParseException("Invalid network file: bad connection");
+                }
+                layers[slotRecord.m_SourceLayer]->GetOutputSlot(slotRecord.m_SourceSlot).Connect(
+                    layer->GetInputSlot(i));
+            }
+
+            layers.push_back(layer);
+        }
+
+        for (std::size_t i = 0; i < m_TransformedConstants.m_Size; ++i)
+        {
+            AddTransformedConstant(*network, layers, m_TransformedConstants[i]);
+        }
+        for (IConnectableLayer* layer : layers)
+        {
+            CheckWeightData(*boost::polymorphic_downcast<Layer*>(layer));
+        }
+
+        if (m_MemoryPlan.m_Size != 0)
+        {
+            SetMemoryPlan(*network);
+        }
+
+        return network;
+    }
+
+private:
+    template <typename T>
+    Section<T> GetSection(SectionId id, uint64_t alignment) const
+    {
+        for (std::size_t i = 0; i < m_Directory.m_Size; ++i)
+        {
+            const SectionEntry& entry = m_Directory[i];
+            if (entry.m_Id != static_cast<uint32_t>(id))
+            {
+                continue;
+            }
+
+            CheckRange(entry.m_Offset, entry.m_Size, m_Size, "section");
+            if (entry.m_Offset % alignment != 0 || entry.m_Size % sizeof(T) != 0)
+            {
+                throw ParseException("Invalid network file: misaligned section");
+            }
+
+            Section<T> section;
+            section.m_Data = reinterpret_cast<const T*>(m_Data + entry.m_Offset);
+            section.m_Size = static_cast<std::size_t>(entry.m_Size / sizeof(T));
+            return section;
+        }
+
+        // A missing section is the same as an empty one.
+        return Section<T>();
+    }
+
+    void SetMemoryOffset(IConnectableLayer& layer, uint32_t slotIndex, uint64_t offset) const
+    {
+        const MemoryPlanRecord& plan = m_MemoryPlan[0];
+        OutputSlot& outputSlot = *boost::polymorphic_downcast<OutputSlot*>(&layer.GetOutputSlot(slotIndex));
+        if (offset == InvalidOffset)
+        {
+            outputSlot.SetMemoryOffset(InvalidMemoryOffset);
+            return;
+        }
+
+        const uint64_t numBytes = outputSlot.IsTensorInfoSet() ? outputSlot.GetTensorInfo().GetNumBytes() : 0;
+        if (offset > plan.m_ArenaSize || numBytes > plan.m_ArenaSize - offset)
+        {
+            throw ParseException("Invalid network file: tensor outside of the activation arena");
+        }
+        outputSlot.SetMemoryOffset(boost::numeric_cast<std::size_t>(offset));
+    }
+
+    void SetMemoryPlan(INetwork& network) const
+    {
+        const MemoryPlanRecord& record = m_MemoryPlan[0];
+        if (record.m_Alignment == 0 || (record.m_Alignment & (record.m_Alignment - 1)) != 0)
+        {
+            throw ParseException("Invalid network file: bad memory plan");
+        }
+
+        MemoryPlan plan;
+        plan.m_ArenaSize       = boost::numeric_cast<std::size_t>(record.m_ArenaSize);
+        plan.m_Alignment       = boost::numeric_cast<std::size_t>(record.m_Alignment);
+        plan.m_TotalTensorSize = boost::numeric_cast<std::size_t>(record.m_TotalTensorSize);
+        boost::polymorphic_downcast<Network*>(&network)->GetGraph().SetMemoryPlan(plan);
+    }
+
+    const char* GetName(const LayerRecord& record) const
+    {
+        CheckRange(record.m_NameOffset, uint64_t(record.m_NameLength) + 1, m_Strings.m_Size, "name");
+        if (m_Strings[record.m_NameOffset + record.m_NameLength] != '\0')
+        {
+            throw ParseException("Invalid network file: unterminated name");
+        }
+        return &m_Strings[record.m_NameOffset];
+    }
+
+    template <typename Descriptor>
+    Descriptor GetDescriptor(const LayerRecord& record) const
+    {
+        return ReadDescriptor<Descriptor>(m_Descriptors.m_Data + record.m_DescriptorOffset, record.m_DescriptorSize);
+    }
+
+    /// Reads the descriptor of a Convolution2d, DepthwiseConvolution2d or FullyConnected layer, and the activation
+    /// fused into it when one follows.
+    template <typename Descriptor>
+    Descriptor GetDescriptor(const LayerRecord& record,
+                             bool& hasFusedActivation,
+                             ActivationDescriptor& fusedActivation) const
+    {
+        DescriptorReader reader(m_Descriptors.m_Data + record.m_DescriptorOffset, record.m_DescriptorSize);
+        Descriptor descriptor;
+        VisitDescriptor(reader, descriptor);
+
+        hasFusedActivation = !reader.IsFullyRead();
+        if (hasFusedActivation)
+        {
+            VisitDescriptor(reader, fusedActivation);
+            if (!IsFusableActivation(fusedActivation))
+            {
+                throw ParseException("Invalid network file: bad fused activation");
+            }
+        }
+        reader.CheckFullyRead();
+        return descriptor;
+    }
+
+    IConnectableLayer* SetFusedActivation(IConnectableLayer* layer,
+                                          bool hasFusedActivation,
+                                          const ActivationDescriptor& fusedActivation) const
+    {
+        if (hasFusedActivation)
+        {
+            armnn::SetFusedActivation(*boost::polymorphic_downcast<Layer*>(layer), fusedActivation);
+        }
+        return layer;
+    }
+
+    /// Returns the constant tensor of the layer, pointing into the serialized data.
+    ConstTensor GetConstant(const LayerRecord& record, uint32_t index) const
+    {
+        if (index >= record.m_NumConstants)
+        {
+            throw ParseException("Invalid network file: missing constant tensor");
+        }
+
+        return GetConstant(m_Constants[record.m_FirstConstant + index]);
+    }
+
+    /// Returns the constant tensor, pointing into the serialized data.
+    ConstTensor GetConstant(const ConstantRecord& constant) const
+    {
+        const TensorInfo tensorInfo = ToTensorInfo(constant.m_TensorInfo);
+
+        CheckRange(constant.m_DataOffset, constant.m_NumBytes, m_ConstantData.m_Size, "constant data");
+        if (constant.m_NumBytes != tensorInfo.GetNumBytes() || constant.m_DataOffset % ConstantAlignment != 0)
+        {
+            throw ParseException("Invalid network file: bad constant tensor");
+        }
+
+        return ConstTensor(tensorInfo, m_ConstantData.m_Data + constant.m_DataOffset);
+    }
+
+    /// Returns the weights of a Convolution2d or FullyConnected layer, which have no data when they are stored
+    /// packed only (see CheckWeightData()).
+    ConstTensor GetWeight(const LayerRecord& record) const
+    {
+        const ConstantRecord& constant = m_Constants[record.m_FirstConstant];
+        if (constant.m_DataOffset == InvalidOffset && constant.m_NumBytes == 0)
+        {
+            return ConstTensor(ToTensorInfo(constant.m_TensorInfo), nullptr);
+        }
+        return GetConstant(record, 0);
+    }
+
+    /// Checks that the weights stored packed only were given packed weights, with the same values.
+    static void CheckWeightData(const Layer& layer)
+    {
+        const ConstTensor* weight = nullptr;
+        const ConstTensor* packedWeight = nullptr;
+        if (layer.GetType() == LayerType::Convolution2d)
+        {
+            const auto& convLayer = *boost::polymorphic_downcast<const Convolution2dLayer*>(&layer);
+            weight = &convLayer.m_Weight;
+            packedWeight = &convLayer.m_PackedWeight;
+        }
+        else if (layer.GetType() == LayerType::FullyConnected)
+        {
+            const auto& fcLayer = *boost::polymorphic_downcast<const FullyConnectedLayer*>(&layer);
+            weight = &fcLayer.m_Weight;
+            packedWeight = &fcLayer.m_PackedWeight;
+        }
+        if (weight != nullptr && weight->GetMemoryArea() == nullptr &&
+            (packedWeight->GetMemoryArea() == nullptr || weight->GetInfo().GetDataType() != DataType::Float32))
+        {
+            throw ParseException("Invalid network file: weights stored packed without their packed weights");
+        }
+    }
+
+    void CheckNumConstants(const LayerRecord& record, bool biasEnabled) const
+    {
+        CheckNumConstants(record, biasEnabled ? 2u : 1u);
+    }
+
+    void CheckNumConstants(const LayerRecord& record, uint32_t numConstants) const
+    {
+        if (record.m_NumConstants != numConstants)
+        {
+            throw ParseException("Invalid network file: wrong number of constant tensors");
+        }
+    }
+
+    void AddTransformedConstant(INetwork& network,
+                                const std::vector<IConnectableLayer*>& layers,
+                                const TransformedConstantRecord& record) const
+    {
+        if (record.m_Layer >= layers.size())
+        {
+            throw ParseException("Invalid network file: transformed constant of a missing layer");
+        }
+        Layer& layer = *boost::polymorphic_downcast<Layer*>(layers[record.m_Layer]);
+        ConstantPool& constantPool = boost::polymorphic_downcast<Network*>(&network)->GetGraph().GetConstantPool();
+
+        switch (static_cast<ConstantUsage>(record.m_Usage))
+        {
+            case ConstantUsage::WinogradWeight:
+            {
+                if (layer.GetType() != LayerType::Convolution2d)
+                {
+                    throw ParseException("Invalid network file: Winograd weights of a layer other than a convolution");
+                }
+                auto& convLayer = *boost::polymorphic_downcast<Convolution2dLayer*>(&layer);
+                const ConstTensor transformed = GetConstant(record.m_Constant);
+
+                const armnnUtils::DataLayoutIndexed dataLayout(convLayer.GetParameters().m_DataLayout);
+                const TensorShape& weightShape = convLayer.m_Weight.GetShape();
+                const TensorShape& shape = transformed.GetShape();
+                if (transformed.GetInfo().GetDataType() != DataType::Float32 ||
+                    GetWinogradOutputTile(shape) == 0 ||
+                    shape[2] != weightShape[0] ||
+                    shape[3] != weightShape[dataLayout.GetChannelsIndex()])
+                {
+                    throw ParseException("Invalid network file: bad Winograd weights");
+                }
+                convLayer.m_WinogradWeight = constantPool.Add(transformed);
+                break;
+            }
+            case ConstantUsage::GemmA6x256Weight:
+            case ConstantUsage::GemmB16x256Weight:
+            {
+                ConstTensor* packedWeight = nullptr;
+                PackedWeightLayout* packedWeightLayout = nullptr;
+                if (layer.GetType() == LayerType::Convolution2d)
+                {
+                    auto& convLayer = *boost::polymorphic_downcast<Convolution2dLayer*>(&layer);
+                    packedWeight = &convLayer.m_PackedWeight;
+                    packedWeightLayout = &convLayer.m_PackedWeightLayout;
+                }
+                else if (layer.GetType() == LayerType::FullyConnected)
+                {
+                    auto& fcLayer = *boost::polymorphic_downcast<FullyConnectedLayer*>(&layer);
+                    packedWeight = &fcLayer.m_PackedWeight;
+                    packedWeightLayout = &fcLayer.m_PackedWeightLayout;
+                }
+                else
+                {
+                    throw ParseException("Invalid network file: packed weights of a layer other than a convolution or "
+                                         "a fully connected layer");
+                }
+
+                const PackedWeightLayout layout =
+                    static_cast<ConstantUsage>(record.m_Usage) == ConstantUsage::GemmA6x256Weight ?
+                        PackedWeightLayout::GemmA6x256 : PackedWeightLayout::GemmB16x256;
+                const ConstTensor packed = GetConstant(record.m_Constant);
+                if (packed.GetInfo().GetDataType() != DataType::Float32 ||
+                    packed.GetShape() != GetPackedWeightShape(layer, layout))
+                {
+                    throw ParseException("Invalid network file: bad packed weights");
+                }
+                *packedWeight = constantPool.Add(packed);
+                *packedWeightLayout = layout;
+                break;
+            }
+            default:
+                // Written by a later version for a kernel this one doesn't have: the layer works without it.
+                break;
+        }
+    }
+
+    IConnectableLayer* AddLayer(INetwork& network, const LayerRecord& record) const
+    {
+        const char* const name = GetName(record);
+
+        switch (static_cast<LayerType>(record.m_Type))
+        {
+            case LayerType::Input:
+                return network.AddInputLayer(record.m_BindingId, name);
+            case LayerType::Output:
+                return network.AddOutputLayer(record.m_BindingId, name);
+            case LayerType::Activation:
+                return network.AddActivationLayer(GetDescriptor<ActivationDescriptor>(record), name);
+            case LayerType::BatchNormalization:
+            {
+                CheckNumConstants(record, 4u);
+                return network.AddBatchNormalizationLayer(GetDescriptor<BatchNormalizationDescriptor>(record),
+                                                          GetConstant(record, 0),
+                                                          GetConstant(record, 1),
+                                                          GetConstant(record, 2),
+                                                          GetConstant(record, 3),
+                                                          name);
+            }
+            case LayerType::Constant:
+            {
+                CheckNumConstants(record, 1u);
+                return network.AddConstantLayer(GetConstant(record, 0), name);
+            }
+            // Not part of the INetwork interface (ConvertToFp16() inserts them): added to the graph directly.
+            case LayerType::ConvertFp16ToFp32:
+                return boost::polymorphic_downcast<Network*>(&network)->GetGraph()
+                    .AddLayer<ConvertFp16ToFp32Layer>(name);
+            case LayerType::ConvertFp32ToFp16:
+                return boost::polymorphic_downcast<Network*>(&network)->GetGraph()
+                    .AddLayer<ConvertFp32ToFp16Layer>(name);
+            case LayerType::Convolution2d:
+            {
+                bool hasFusedActivation;
+                ActivationDescriptor fusedActivation;
+                const auto descriptor = GetDescriptor<Convolution2dDescriptor>(record, hasFusedActivation,
+                                                                               fusedActivation);
+                CheckNumConstants(record, descriptor.m_BiasEnabled);
+                return SetFusedActivation(descriptor.m_BiasEnabled ?
+                    network.AddConvolution2dLayer(descriptor, GetWeight(record), GetConstant(record, 1), name) :
+                    network.AddConvolution2dLayer(descriptor, GetWeight(record), name),
+                    hasFusedActivation, fusedActivation);
+            }
+            case LayerType::DepthwiseConvolution2d:
+            {
+                bool hasFusedActivation;
+                ActivationDescriptor fusedActivation;
+                const auto descriptor = GetDescriptor<DepthwiseConvolution2dDescriptor>(record, hasFusedActivation,
+                                                                                        fusedActivation);
+                CheckNumConstants(record, descriptor.m_BiasEnabled);
+                return SetFusedActivation(descriptor.m_BiasEnabled ?
+                    network.AddDepthwiseConvolution2dLayer(descriptor,
+                                                           GetConstant(record, 0),
+                                                           GetConstant(record, 1),
+                                                           name) :
+                    network.AddDepthwiseConvolution2dLayer(descriptor, GetConstant(record, 0), name),
+                    hasFusedActivation, fusedActivation);
+            }
+            case LayerType::FullyConnected:
+            {
+                bool hasFusedActivation;
+                ActivationDescriptor fusedActivation;
+                const auto descriptor = GetDescriptor<FullyConnectedDescriptor>(record, hasFusedActivation,
+                                                                                fusedActivation);
+                CheckNumConstants(record, descriptor.m_BiasEnabled);
+                return SetFusedActivation(descriptor.m_BiasEnabled ?
+                    network.AddFullyConnectedLayer(descriptor, GetWeight(record), GetConstant(record, 1), name) :
+                    network.AddFullyConnectedLayer(descriptor, GetWeight(record), name),
+                    hasFusedActivation, fusedActivation);
+            }
+            case LayerType::Normalization:
+                return network.AddNormalizationLayer(GetDescriptor<NormalizationDescriptor>(record), name);
+            case LayerType::Permute:
+                return network.AddPermuteLayer(GetDescriptor<PermuteDescriptor>(record), name);
+            case LayerType::Pooling2d:
+                return network.AddPooling2dLayer(GetDescriptor<Pooling2dDescriptor>(record), name);
+            case LayerType::Softmax:
+                return network.AddSoftmaxLayer(GetDescriptor<SoftmaxDescriptor>(record), name);
+            default:
+                throw ParseException(boost::str(boost::format("Invalid network file: unsupported layer type %1%")
+                                                % record.m_Type));
+        }
+    }
+
+    const uint8_t* m_Data;
+    std::size_t    m_Size;
+
+    Section<SectionEntry>     m_Directory;
+    Section<char>             m_Strings;
+    Section<LayerRecord>      m_Layers;
+    Section<InputSlotRecord>  m_InputSlots;
+    Section<OutputSlotRecord> m_OutputSlots;
+    Section<uint32_t>         m_Descriptors;
+    Section<ConstantRecord>   m_Constants;
+    Section<uint8_t>          m_ConstantData;
+    Section<MemoryPlanRecord> m_MemoryPlan;
+    Section<uint64_t>         m_OutputSlotOffsets;
+    Section<TransformedConstantRecord> m_TransformedConstants;
+};
+
+} // namespace
+
+IDeserializer* IDeserializer::CreateRaw()
+{
+    return new Deserializer();
+}
+
+IDeserializerPtr IDeserializer::Create()
+{
+    return IDeserializerPtr(CreateRaw(), &IDeserializer::Destroy);
+}
+
+void IDeserializer::Destroy(IDeserializer* deserializer)
+{
+    delete deserializer;
+}
+
+Deserializer::~Deserializer()
+{
+    for (const MappedFile& file : m_MappedFiles)
+    {
+        munmap(file.m_Data, file.m_Size);
+    }
+}
+
+INetworkPtr Deserializer::CreateNetworkFromBinaryFile(const char* graphFile)
+{
+    const int fd = open(graphFile, O_RDONLY);
+    if (fd < 0)
+    {
+        throw FileNotFoundException(boost::str(boost::format("Cannot open network file %1%") % graphFile));
+    }
+
+    struct stat status;
+    if (fstat(fd, &status) != 0 || status.st_size <= 0)
+    {
+        close(fd);
+        throw ParseException(boost::str(boost::format("Cannot read network file %1%") % graphFile));
+    }
+
+    const std::size_t size = static_cast<std::size_t>(status.st_size);
+    void* const data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        throw ParseException(boost::str(boost::format("Cannot map network file %1%") % graphFile));
+    }
+
+    try
+    {
+        INetworkPtr network = CreateNetworkFromBinary(data, size);
+        m_MappedFiles.push_back({ data, size });
+        return network;
+    }
+    catch (...)
+    {
+        munmap(data, size);
+        throw;
+    }
+}
+
+INetworkPtr Deserializer::CreateNetworkFromBinary(const void* binaryContent, std::size_t size)
+{
+    if (reinterpret_cast<std::uintptr_t>(binaryContent) % ConstantAlignment != 0)
+    {
+        throw InvalidArgumentException("Serialized network data must be 64-byte aligned");
+    }
+
+    NetworkReader reader(static_cast<const uint8_t*>(binaryContent), size);
+    return reader.CreateNetwork();
+}
+
+} // namespace armnnDeserializer
@@ -0,0 +1,38 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnnDeserializer/IDeserializer.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace armnnDeserializer
+{
+
+class Deserializer : public IDeserializer
+{
+public:
+    Deserializer() = default;
+    ~Deserializer();
+
+    /// Maps the file into memory and creates the network from it.
+    armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile) override;
+
+    /// Creates the network from serialized data in memory.
+    armnn::INetworkPtr CreateNetworkFromBinary(const void* binaryContent, std::size_t size) override;
+
+private:
+    struct MappedFile
+    {
+        void*       m_Data;
+        std::size_t m_Size;
+    };
+
+    /// Files mapped by CreateNetworkFromBinaryFile, the networks created from them point into the mappings.
+    std::vector<MappedFile> m_MappedFiles;
+};
+
+} // namespace armnnDeserializer
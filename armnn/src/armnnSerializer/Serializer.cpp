@@ -0,0 +1,440 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "Serializer.hpp"
+
+#include "SerializerUtils.hpp"
+
+#include <Graph.hpp>
+#include <LayerFusion.hpp>
+#include <LayersFwd.hpp>
+#include <Network.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/cast.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/utility/string_ref.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+using namespace armnn;
+
+namespace armnnSerializer
+{
+
+namespace
+{
+
+uint64_t AlignUp(uint64_t value, uint64_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+void WritePadding(std::ostream& stream, uint64_t& position, uint64_t alignment)
+{
+    static const char zeros[ConstantAlignment] = {};
+
+    const uint64_t aligned = AlignUp(position, alignment);
+    stream.write(zeros, boost::numeric_cast<std::streamsize>(aligned - position));
+    position = aligned;
+}
+
+template <typename T>
+void WriteSection(std::ostream& stream, uint64_t& position, const std::vector<T>& section)
+{
+    WritePadding(stream, position, SectionAlignment);
+
+    const uint64_t size = section.size() * sizeof(T);
+    stream.write(reinterpret_cast<const char*>(section.data()), boost::numeric_cast<std::streamsize>(size));
+    position += size;
+}
+
+ConstantUsage GetPackedWeightUsage(PackedWeightLayout layout)
+{
+    return layout == PackedWeightLayout::GemmA6x256 ? ConstantUsage::GemmA6x256Weight :
+                                                      ConstantUsage::GemmB16x256Weight;
+}
+
+} // namespace
+
+ISerializer* ISerializer::CreateRaw()
+{
+    return new Serializer();
+}
+
+ISerializerPtr ISerializer::Create()
+{
+    return ISerializerPtr(CreateRaw(), &ISerializer::Destroy);
+}
+
+void ISerializer::Destroy(ISerializer* serializer)
+{
+    delete serializer;
+}
+
+void Serializer::Clear()
+{
+    m_Strings.clear();
+    m_Layers.clear();
+    m_InputSlots.clear();
+    m_OutputSlots.clear();
+    m_Descriptors.clear();
+    m_Constants.clear();
+    m_TransformedConstants.clear();
+    m_MemoryPlan.clear();
+    m_OutputSlotOffsets.clear();
+    m_ConstantData.clear();
+    m_ConstantDataIndices.clear();
+    m_ConstantDataSize = 0;
+}
+
+void Serializer::Serialize(const INetwork& inNetwork)
+{
+    Clear();
+
+    const Graph& graph = boost::polymorphic_downcast<const Network*>(&inNetwork)->GetGraph();
+
+    // Layers are written in topological order, so every connection refers to a layer that comes first.
+    std::unordered_map<const Layer*, uint32_t> layerIndices;
+    layerIndices.reserve(graph.GetNumLayers());
+
+    const MemoryPlan& memoryPlan = graph.GetMemoryPlan();
+    if (memoryPlan.IsValid())
+    {
+        m_MemoryPlan.push_back({ memoryPlan.m_ArenaSize, memoryPlan.m_Alignment, memoryPlan.m_TotalTensorSize });
+    }
+
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        LayerRecord record = {};
+        record.m_Type = static_cast<uint32_t>(layer->GetType());
+        record.m_Guid = layer->GetGuid();
+
+        const boost::string_ref name = graph.GetStringPool().Get(layer->GetNameId());
+        record.m_NameOffset = boost::numeric_cast<uint32_t>(m_Strings.size());
+        record.m_NameLength = boost::numeric_cast<uint32_t>(name.size());
+        m_Strings.insert(m_Strings.end(), name.begin(), name.end());
+        m_Strings.push_back('\0');
+
+        record.m_FirstInputSlot = boost::numeric_cast<uint32_t>(m_InputSlots.size());
+        record.m_NumInputSlots  = layer->GetNumInputSlots();
+        for (auto&& inputSlot : layer->GetInputSlots())
+        {
+            InputSlotRecord slotRecord = { InvalidIndex, InvalidIndex };
+
+            const OutputSlot* const source = inputSlot.GetConnectedOutputSlot();
+            if (source != nullptr)
+            {
+                slotRecord.m_SourceLayer = layerIndices.at(&source->GetOwningLayer());
+                slotRecord.m_SourceSlot  = source->CalculateIndexOnOwner();
+            }
+            m_InputSlots.push_back(slotRecord);
+        }
+
+        record.m_FirstOutputSlot = boost::numeric_cast<uint32_t>(m_OutputSlots.size());
+        record.m_NumOutputSlots  = layer->GetNumOutputSlots();
+        for (auto&& outputSlot : layer->GetOutputSlots())
+        {
+            OutputSlotRecord slotRecord = {};
+            slotRecord.m_TensorInfo      = ToTensorInfoRecord(outputSlot.GetTensorInfo());
+            slotRecord.m_IsTensorInfoSet = outputSlot.IsTensorInfoSet() ? 1u : 0u;
+            m_OutputSlots.push_back(slotRecord);
+
+            if (memoryPlan.IsValid())
+            {
+                const std::size_t offset = outputSlot.GetMemoryOffset();
+                m_OutputSlotOffsets.push_back(offset == InvalidMemoryOffset ? InvalidOffset : offset);
+            }
+        }
+
+        record.m_DescriptorOffset = boost::numeric_cast<uint32_t>(m_Descriptors.size());
+        record.m_FirstConstant    = boost::numeric_cast<uint32_t>(m_Constants.size());
+        SerializeLayerParameters(*layer, record);
+
+        layerIndices.emplace(layer, boost::numeric_cast<uint32_t>(m_Layers.size()));
+        m_Layers.push_back(record);
+    }
+}
+
+void Serializer::SerializeLayerParameters(const Layer& layer, LayerRecord& record)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Input:
+        case LayerType::Output:
+        {
+            record.m_BindingId = boost::polymorphic_downcast<const BindableLayer*>(&layer)->GetBindingId();
+            break;
+        }
+        case LayerType::Activation:
+        {
+            SerializeDescriptor(boost::polymorphic_downcast<const ActivationLayer*>(&layer)->GetParameters(), record);
+            break;
+        }
+        case LayerType::Constant:
+        {
+            SerializeConstant(boost::polymorphic_downcast<const ConstantLayer*>(&layer)->m_LayerOutput, record);
+            break;
+        }
+        case LayerType::ConvertFp16ToFp32:
+        case LayerType::ConvertFp32ToFp16:
+            // No parameters: the data types are those of the TensorInfos.
+            break;
+        case LayerType::BatchNormalization:
+        {
+            const auto batchNormLayer = boost::polymorphic_downcast<const BatchNormalizationLayer*>(&layer);
+            SerializeDescriptor(batchNormLayer->GetParameters(), record);
+            SerializeConstant(batchNormLayer->m_Mean, record);
+            SerializeConstant(batchNormLayer->m_Variance, record);
+            SerializeConstant(batchNormLayer->m_Beta, record);
+            SerializeConstant(batchNormLayer->m_Gamma, record);
+            break;
+        }
+        case LayerType::Convolution2d:
+        {
+            const auto convLayer = boost::polymorphic_downcast<const Convolution2dLayer*>(&layer);
+            SerializeDescriptor(convLayer->GetParameters(), record);
+            SerializeFusedActivation(layer, record);
+            SerializeWeight(convLayer->m_Weight, convLayer->m_PackedWeight, record);
+            if (convLayer->GetParameters().m_BiasEnabled)
+            {
+                SerializeConstant(convLayer->m_Bias, record);
+            }
+            SerializeTransformedConstant(convLayer->m_WinogradWeight, ConstantUsage::WinogradWeight);
+            SerializeTransformedConstant(convLayer->m_PackedWeight,
+                                         GetPackedWeightUsage(convLayer->m_PackedWeightLayout));
+            break;
+        }
+        case LayerType::DepthwiseConvolution2d:
+        {
+            const auto convLayer = boost::polymorphic_downcast<const DepthwiseConvolution2dLayer*>(&layer);
+            SerializeDescriptor(convLayer->GetParameters(), record);
+            SerializeFusedActivation(layer, record);
+            SerializeConstant(convLayer->m_Weight, record);
+            if (convLayer->GetParameters().m_BiasEnabled)
+            {
+                SerializeConstant(convLayer->m_Bias, record);
+            }
+            break;
+        }
+        case LayerType::FullyConnected:
+        {
+            const auto fcLayer = boost::polymorphic_downcast<const FullyConnectedLayer*>(&layer);
+            SerializeDescriptor(fcLayer->GetParameters(), record);
+            SerializeFusedActivation(layer, record);
+            SerializeWeight(fcLayer->m_Weight, fcLayer->m_PackedWeight, record);
+            if (fcLayer->GetParameters().m_BiasEnabled)
+            {
+                SerializeConstant(fcLayer->m_Bias, record);
+            }
+            SerializeTransformedConstant(fcLayer->m_PackedWeight, GetPackedWeightUsage(fcLayer->m_PackedWeightLayout));
+            break;
+        }
+        case LayerType::Normalization:
+        {
+            SerializeDescriptor(boost::polymorphic_downcast<const NormalizationLayer*>(&layer)->GetParameters(),
+                                record);
+            break;
+        }
+        case LayerType::Permute:
+        {
+            SerializeDescriptor(boost::polymorphic_downcast<const PermuteLayer*>(&layer)->GetParameters(), record);
+            break;
+        }
+        case LayerType::Pooling2d:
+        {
+            SerializeDescriptor(boost::polymorphic_downcast<const Pooling2dLayer*>(&layer)->GetParameters(), record);
+            break;
+        }
+        case LayerType::Softmax:
+        {
+            SerializeDescriptor(boost::polymorphic_downcast<const SoftmaxLayer*>(&layer)->GetParameters(), record);
+            break;
+        }
+        default:
+        {
+            throw UnimplementedException(std::string("Serialization of ") + GetLayerTypeAsCString(layer.GetType()) +
+                                         " layers is not supported");
+        }
+    }
+}
+
+template <typename Descriptor>
+void Serializer::SerializeDescriptor(const Descriptor& descriptor, LayerRecord& record)
+{
+    DescriptorWriter writer(m_Descriptors);
+    WriteDescriptor(writer, descriptor);
+
+    record.m_DescriptorSize = boost::numeric_cast<uint32_t>(m_Descriptors.size()) - record.m_DescriptorOffset;
+}
+
+void Serializer::SerializeFusedActivation(const Layer& layer, LayerRecord& record)
+{
+    // Appended to the descriptor of the layer rather than put in a section of its own: a reader unaware of it
+    // rejects the file instead of running the layer without its activation.
+    const ActivationDescriptor* const activation = GetFusedActivation(layer);
+    if (activation != nullptr)
+    {
+        SerializeDescriptor(*activation, record);
+    }
+}
+
+void Serializer::SerializeConstant(const ConstTensor& tensor, LayerRecord& record)
+{
+    if (tensor.GetMemoryArea() == nullptr)
+    {
+        throw InvalidArgumentException("Cannot serialize a layer with a missing constant tensor");
+    }
+
+    m_Constants.push_back(AddConstantData(tensor));
+    ++record.m_NumConstants;
+}
+
+void Serializer::SerializeWeight(const ConstTensor& weight, const ConstTensor& packedWeight, LayerRecord& record)
+{
+    if (packedWeight.GetMemoryArea() == nullptr)
+    {
+        SerializeConstant(weight, record);
+        return;
+    }
+
+    ConstantRecord constant = {};
+    constant.m_TensorInfo = ToTensorInfoRecord(weight.GetInfo());
+    constant.m_DataOffset = InvalidOffset;
+    m_Constants.push_back(constant);
+    ++record.m_NumConstants;
+}
+
+void Serializer::SerializeTransformedConstant(const ConstTensor& tensor, ConstantUsage usage)
+{
+    if (tensor.GetMemoryArea() == nullptr)
+    {
+        return;
+    }
+
+    TransformedConstantRecord transformed = {};
+    transformed.m_Layer    = boost::numeric_cast<uint32_t>(m_Layers.size());
+    transformed.m_Usage    = static_cast<uint32_t>(usage);
+    transformed.m_Constant = AddConstantData(tensor);
+    m_TransformedConstants.push_back(transformed);
+}
+
+ConstantRecord Serializer::AddConstantData(const ConstTensor& tensor)
+{
+    ConstantRecord constant = {};
+    constant.m_TensorInfo = ToTensorInfoRecord(tensor.GetInfo());
+    constant.m_NumBytes   = tensor.GetNumBytes();
+
+    auto dataIndex = m_ConstantDataIndices.find(tensor.GetMemoryArea());
+    if (dataIndex != m_ConstantDataIndices.end() && m_ConstantData[dataIndex->second].m_NumBytes >= constant.m_NumBytes)
+    {
+        constant.m_DataOffset = m_ConstantData[dataIndex->second].m_Offset;
+    }
+    else
+    {
+        constant.m_DataOffset = m_ConstantDataSize;
+        m_ConstantDataSize = AlignUp(m_ConstantDataSize + constant.m_NumBytes, ConstantAlignment);
+
+        m_ConstantDataIndices[tensor.GetMemoryArea()] = m_ConstantData.size();
+        m_ConstantData.push_back({ tensor.GetMemoryArea(), constant.m_NumBytes, constant.m_DataOffset });
+    }
+    return constant;
+}
+
+bool Serializer::SaveSerializedToStream(std::ostream& stream)
+{
+    std::vector<SectionId> sectionIds =
+    {
+        SectionId::Strings,
+        SectionId::Layers,
+        SectionId::InputSlots,
+        SectionId::OutputSlots,
+        SectionId::Descriptors,
+        SectionId::Constants,
+    };
+    std::vector<uint64_t> sectionSizes =
+    {
+        m_Strings.size(),
+        m_Layers.size() * sizeof(LayerRecord),
+        m_InputSlots.size() * sizeof(InputSlotRecord),
+        m_OutputSlots.size() * sizeof(OutputSlotRecord),
+        m_Descriptors.size() * sizeof(uint32_t),
+        m_Constants.size() * sizeof(ConstantRecord),
+    };
+    if (!m_MemoryPlan.empty())
+    {
+        sectionIds.push_back(SectionId::MemoryPlan);
+        sectionSizes.push_back(m_MemoryPlan.size() * sizeof(MemoryPlanRecord));
+        sectionIds.push_back(SectionId::OutputSlotOffsets);
+        sectionSizes.push_back(m_OutputSlotOffsets.size() * sizeof(uint64_t));
+    }
+    if (!m_TransformedConstants.empty())
+    {
+        sectionIds.push_back(SectionId::TransformedConstants);
+        sectionSizes.push_back(m_TransformedConstants.size() * sizeof(TransformedConstantRecord));
+    }
+    sectionIds.push_back(SectionId::ConstantData);
+    sectionSizes.push_back(m_ConstantDataSize);
+
+    const uint32_t numSections = boost::numeric_cast<uint32_t>(sectionIds.size());
+
+    FileHeader header = {};
+    std::memcpy(header.m_Magic, FileMagic, sizeof(header.m_Magic));
+    header.m_Version     = FormatVersion;
+    header.m_NumSections = numSections;
+
+    // Sections follow the directory in the order above, the constant data being the only one aligned for mapping.
+    std::vector<SectionEntry> directory(numSections);
+    uint64_t offset = sizeof(FileHeader) + numSections * sizeof(SectionEntry);
+    for (uint32_t i = 0; i < numSections; ++i)
+    {
+        const uint64_t alignment = (sectionIds[i] == SectionId::ConstantData) ? ConstantAlignment : SectionAlignment;
+        offset = AlignUp(offset, alignment);
+
+        directory[i].m_Id     = static_cast<uint32_t>(sectionIds[i]);
+        directory[i].m_Offset = offset;
+        directory[i].m_Size   = sectionSizes[i];
+        offset += sectionSizes[i];
+    }
+
+    uint64_t position = 0;
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    position += sizeof(header);
+    WriteSection(stream, position, directory);
+
+    WriteSection(stream, position, m_Strings);
+    WriteSection(stream, position, m_Layers);
+    WriteSection(stream, position, m_InputSlots);
+    WriteSection(stream, position, m_OutputSlots);
+    WriteSection(stream, position, m_Descriptors);
+    WriteSection(stream, position, m_Constants);
+    if (!m_MemoryPlan.empty())
+    {
+        WriteSection(stream, position, m_MemoryPlan);
+        WriteSection(stream, position, m_OutputSlotOffsets);
+    }
+    if (!m_TransformedConstants.empty())
+    {
+        WriteSection(stream, position, m_TransformedConstants);
+    }
+
+    WritePadding(stream, position, ConstantAlignment);
+    const uint64_t constantDataStart = position;
+    for (const ConstantData& data : m_ConstantData)
+    {
+        WritePadding(stream, position, ConstantAlignment);
+        BOOST_ASSERT(position - constantDataStart == data.m_Offset);
+
+        stream.write(static_cast<const char*>(data.m_Data), boost::numeric_cast<std::streamsize>(data.m_NumBytes));
+        position += data.m_NumBytes;
+    }
+    WritePadding(stream, position, ConstantAlignment);
+
+    return stream.good();
+}
+
+} // namespace armnnSerializer
@@ -0,0 +1,88 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "SerializerFormat.hpp"
+
+#include <armnnSerializer/ISerializer.hpp>
+
+#include <Layer.hpp>
+
+#include <armnn/Tensor.hpp>
+
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace armnnSerializer
+{
+
+class Serializer : public ISerializer
+{
+public:
+    Serializer() = default;
+    ~Serializer() = default;
+
+    /// Serializes the network to ISerializer.
+    /// @param [in] inNetwork The network to be serialized.
+    void Serialize(const armnn::INetwork& inNetwork) override;
+
+    /// Serializes the SerializedContent to the stream.
+    /// @param [stream] the stream that the information is written to
+    bool SaveSerializedToStream(std::ostream& stream) override;
+
+private:
+    /// Fills in the layer type specific parts of the record: descriptor, constants and binding id.
+    void SerializeLayerParameters(const armnn::Layer& layer, LayerRecord& record);
+
+    template <typename Descriptor>
+    void SerializeDescriptor(const Descriptor& descriptor, LayerRecord& record);
+
+    /// Appends the activation fused into the layer, if any, to its descriptor.
+    void SerializeFusedActivation(const armnn::Layer& layer, LayerRecord& record);
+
+    /// Records a constant tensor of the layer being serialized. The data is only read when saving.
+    void SerializeConstant(const armnn::ConstTensor& tensor, LayerRecord& record);
+
+    /// Records the weights of a Convolution2d or FullyConnected layer: their TensorInfo only when the layer has
+    /// packed weights, which hold the same values and are recorded instead (see SerializeTransformedConstant()).
+    void SerializeWeight(const armnn::ConstTensor& weight, const armnn::ConstTensor& packedWeight,
+                         LayerRecord& record);
+
+    /// Records a transformed constant tensor of the layer being serialized, if it has one (non-empty tensor).
+    void SerializeTransformedConstant(const armnn::ConstTensor& tensor, ConstantUsage usage);
+
+    /// Describes a constant tensor, placing its data in the ConstantData section.
+    ConstantRecord AddConstantData(const armnn::ConstTensor& tensor);
+
+    void Clear();
+
+    std::vector<char>             m_Strings;
+    std::vector<LayerRecord>      m_Layers;
+    std::vector<InputSlotRecord>  m_InputSlots;
+    std::vector<OutputSlotRecord> m_OutputSlots;
+    std::vector<uint32_t>         m_Descriptors;
+    std::vector<ConstantRecord>   m_Constants;
+    std::vector<TransformedConstantRecord> m_TransformedConstants;
+
+    /// Only written for networks whose memory was planned (then holding a single record).
+    std::vector<MemoryPlanRecord> m_MemoryPlan;
+    std::vector<uint64_t>         m_OutputSlotOffsets;
+
+    /// Distinct buffers to write in the ConstantData section. Tensors sharing their memory (which the network's
+    /// constant pool does for identical data) share their data in the file too.
+    struct ConstantData
+    {
+        const void* m_Data;
+        uint64_t    m_NumBytes;
+        uint64_t    m_Offset;
+    };
+    std::vector<ConstantData>                   m_ConstantData;
+    std::unordered_map<const void*, std::size_t> m_ConstantDataIndices;
+    uint64_t                                    m_ConstantDataSize = 0;
+};
+
+} // namespace armnnSerializer
@@ -0,0 +1,185 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+/// On-disk layout of the offline network format.
+///
+/// The file starts with a FileHeader followed by a directory of SectionEntry, one per section. Every section is a
+/// flat array of the fixed-size records below (or of raw bytes), so a reader can use the data in place once the
+/// file is mapped into memory. All integers are little-endian. The constant tensor data comes last and every tensor
+/// in it starts on a ConstantAlignment boundary, so it can be handed to kernels straight from the mapped pages.
+///
+/// Readers look sections up by id and ignore the ids they don't know about: new information goes into new
+/// sections. Any change to the records below requires a new FormatVersion.
+namespace armnnSerializer
+{
+
+constexpr char FileMagic[8] = { 'A', 'R', 'M', 'N', 'N', 'O', 'F', 'F' };
+
+constexpr uint32_t FormatVersion = 2;
+
+/// Alignment, in bytes, of every constant tensor within the file.
+constexpr uint64_t ConstantAlignment = 64;
+
+/// Alignment, in bytes, of the start of every section.
+constexpr uint64_t SectionAlignment = 8;
+
+/// Marks an index which doesn't refer to anything (e.g. the source of an unconnected input slot).
+constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+/// Marks an output slot whose tensor is not in the activation arena.
+constexpr uint64_t InvalidOffset = 0xFFFFFFFFFFFFFFFFull;
+
+enum class SectionId : uint32_t
+{
+    /// Null-terminated layer names (char).
+    Strings      = 1,
+    /// LayerRecord, in topological order.
+    Layers       = 2,
+    /// InputSlotRecord, for all the layers.
+    InputSlots   = 3,
+    /// OutputSlotRecord, for all the layers.
+    OutputSlots  = 4,
+    /// Descriptor fields, encoded as 32-bit words (uint32_t). The descriptor of a Convolution2d,
+    /// DepthwiseConvolution2d or FullyConnected layer is followed by that of the activation fused into it, if any.
+    Descriptors  = 5,
+    /// ConstantRecord, for all the layers.
+    Constants    = 6,
+    /// Raw data of the constant tensors (uint8_t).
+    ConstantData = 7,
+    /// MemoryPlanRecord: the activation arena of the network, a single record (only if its memory was planned).
+    MemoryPlan   = 8,
+    /// Offset of the tensor of each output slot in the activation arena (uint64_t, InvalidOffset if the tensor
+    /// lives in a user buffer), parallel to the OutputSlots section.
+    OutputSlotOffsets = 9,
+    /// TransformedConstantRecord: constant tensors precomputed from the parameters of a layer for a particular
+    /// kernel (e.g. filters transformed for Winograd convolution). They are optional, the parameters themselves
+    /// being in the Constants section, so readers can skip the usages they don't know. Packed weights are the
+    /// exception: they replace the weights of their layer, which are then stored without data.
+    TransformedConstants = 10,
+};
+
+/// What a transformed constant tensor is for.
+enum class ConstantUsage : uint32_t
+{
+    /// Convolution2dLayer::m_WinogradWeight.
+    WinogradWeight = 1,
+    /// m_PackedWeight of a Convolution2d or FullyConnected layer, packed in the layout the usage is named after
+    /// (see PackedWeightLayout): the usage is the layout tag.
+    GemmA6x256Weight = 2,
+    GemmB16x256Weight = 3,
+};
+
+struct FileHeader
+{
+    char     m_Magic[8];
+    uint32_t m_Version;
+    uint32_t m_NumSections;
+};
+
+struct SectionEntry
+{
+    uint32_t m_Id;
+    uint32_t m_Reserved;
+    /// Offset of the section from the start of the file, in bytes.
+    uint64_t m_Offset;
+    /// Size of the section in bytes.
+    uint64_t m_Size;
+};
+
+struct TensorInfoRecord
+{
+    uint32_t m_DataType;
+    uint32_t m_NumDimensions;
+    uint32_t m_Dimensions[armnn::MaxNumOfTensorDimensions];
+    float    m_QuantizationScale;
+    int32_t  m_QuantizationOffset;
+};
+
+struct LayerRecord
+{
+    /// armnn::LayerType.
+    uint32_t m_Type;
+    uint32_t m_Guid;
+    /// Offset of the name in the Strings section, and its length (not counting the terminator).
+    uint32_t m_NameOffset;
+    uint32_t m_NameLength;
+    /// Range of the layer's slots in the InputSlots and OutputSlots sections.
+    uint32_t m_FirstInputSlot;
+    uint32_t m_NumInputSlots;
+    uint32_t m_FirstOutputSlot;
+    uint32_t m_NumOutputSlots;
+    /// Range of the layer's descriptor in the Descriptors section, in words.
+    uint32_t m_DescriptorOffset;
+    uint32_t m_DescriptorSize;
+    /// Range of the layer's constant tensors in the Constants section.
+    uint32_t m_FirstConstant;
+    uint32_t m_NumConstants;
+    /// Binding id of input and output layers.
+    int32_t  m_BindingId;
+    uint32_t m_Reserved;
+};
+
+struct InputSlotRecord
+{
+    /// Index of the connected layer in the Layers section (or InvalidIndex), which always comes before the
+    /// layer owning the slot.
+    uint32_t m_SourceLayer;
+    /// Index of the connected output slot on that layer.
+    uint32_t m_SourceSlot;
+};
+
+struct OutputSlotRecord
+{
+    TensorInfoRecord m_TensorInfo;
+    uint32_t         m_IsTensorInfoSet;
+    uint32_t         m_Reserved;
+};
+
+struct ConstantRecord
+{
+    TensorInfoRecord m_TensorInfo;
+    uint32_t         m_Reserved[2];
+    /// Offset of the data from the start of the ConstantData section (a multiple of ConstantAlignment), or
+    /// InvalidOffset for weights stored packed only (m_NumBytes is then 0).
+    uint64_t         m_DataOffset;
+    uint64_t         m_NumBytes;
+};
+
+struct TransformedConstantRecord
+{
+    /// Index of the layer in the Layers section.
+    uint32_t       m_Layer;
+    /// ConstantUsage.
+    uint32_t       m_Usage;
+    ConstantRecord m_Constant;
+};
+
+struct MemoryPlanRecord
+{
+    /// Size of the activation arena, in bytes.
+    uint64_t m_ArenaSize;
+    /// Alignment of the tensors within the arena, in bytes.
+    uint64_t m_Alignment;
+    /// Sum of the sizes of the tensors in the arena, i.e. the memory they would need without any reuse.
+    uint64_t m_TotalTensorSize;
+};
+
+static_assert(sizeof(FileHeader) == 16, "FileHeader layout changed");
+static_assert(sizeof(SectionEntry) == 24, "SectionEntry layout changed");
+static_assert(sizeof(TensorInfoRecord) == 32, "TensorInfoRecord layout changed");
+static_assert(sizeof(LayerRecord) == 56, "LayerRecord layout changed");
+static_assert(sizeof(InputSlotRecord) == 8, "InputSlotRecord layout changed");
+static_assert(sizeof(OutputSlotRecord) == 40, "OutputSlotRecord layout changed");
+static_assert(sizeof(ConstantRecord) == 56, "ConstantRecord layout changed");
+static_assert(sizeof(TransformedConstantRecord) == 64, "TransformedConstantRecord layout changed");
+static_assert(sizeof(MemoryPlanRecord) == 24, "MemoryPlanRecord layout changed");
+
+} // namespace armnnSerializer
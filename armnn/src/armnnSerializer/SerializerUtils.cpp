@@ -0,0 +1,218 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "SerializerUtils.hpp"
+
+#include <algorithm>
+
+namespace armnnSerializer
+{
+
+using namespace armnn;
+
+TensorInfoRecord ToTensorInfoRecord(const TensorInfo& tensorInfo)
+{
+    TensorInfoRecord record = {};
+    record.m_DataType           = static_cast<uint32_t>(tensorInfo.GetDataType());
+    record.m_NumDimensions      = tensorInfo.GetNumDimensions();
+    record.m_QuantizationScale  = tensorInfo.GetQuantizationScale();
+    record.m_QuantizationOffset = tensorInfo.GetQuantizationOffset();
+    for (unsigned int i = 0; i < tensorInfo.GetNumDimensions(); ++i)
+    {
+        record.m_Dimensions[i] = tensorInfo.GetShape()[i];
+    }
+    return record;
+}
+
+TensorInfo ToTensorInfo(const TensorInfoRecord& record)
+{
+    if (record.m_NumDimensions > MaxNumOfTensorDimensions)
+    {
+        throw ParseException("Invalid tensor info: too many dimensions");
+    }
+    if (record.m_DataType > static_cast<uint32_t>(DataType::Boolean))
+    {
+        throw ParseException("Invalid tensor info: unknown data type");
+    }
+
+    if (record.m_NumDimensions == 0)
+    {
+        TensorInfo tensorInfo;
+        tensorInfo.SetDataType(static_cast<DataType>(record.m_DataType));
+        tensorInfo.SetQuantizationScale(record.m_QuantizationScale);
+        tensorInfo.SetQuantizationOffset(record.m_QuantizationOffset);
+        return tensorInfo;
+    }
+
+    return TensorInfo(record.m_NumDimensions,
+                      record.m_Dimensions,
+                      static_cast<DataType>(record.m_DataType),
+                      record.m_QuantizationScale,
+                      record.m_QuantizationOffset);
+}
+
+void DescriptorWriter::operator()(const std::string& value)
+{
+    (*this)(static_cast<uint32_t>(value.size()));
+
+    // Packs four characters per word.
+    for (std::size_t i = 0; i < value.size(); i += sizeof(uint32_t))
+    {
+        uint32_t word = 0;
+        std::memcpy(&word, value.data() + i, std::min(sizeof(uint32_t), value.size() - i));
+        m_Words.push_back(word);
+    }
+}
+
+void DescriptorWriter::operator()(const TensorShape& value)
+{
+    (*this)(value.GetNumDimensions());
+    for (unsigned int i = 0; i < value.GetNumDimensions(); ++i)
+    {
+        (*this)(value[i]);
+    }
+}
+
+void DescriptorWriter::operator()(const PermutationVector& value)
+{
+    (*this)(value.GetSize());
+    for (PermutationVector::SizeType i = 0; i < value.GetSize(); ++i)
+    {
+        (*this)(value[i]);
+    }
+}
+
+void DescriptorWriter::operator()(const OriginsDescriptor& value)
+{
+    (*this)(value.GetNumViews());
+    (*this)(value.GetNumDimensions());
+    (*this)(value.GetConcatAxis());
+    for (uint32_t view = 0; view < value.GetNumViews(); ++view)
+    {
+        const uint32_t* const origin = value.GetViewOrigin(view);
+        m_Words.insert(m_Words.end(), origin, origin + value.GetNumDimensions());
+    }
+}
+
+void DescriptorWriter::operator()(const ViewsDescriptor& value)
+{
+    (*this)(value.GetNumViews());
+    (*this)(value.GetNumDimensions());
+    for (uint32_t view = 0; view < value.GetNumViews(); ++view)
+    {
+        const uint32_t* const origin = value.GetViewOrigin(view);
+        m_Words.insert(m_Words.end(), origin, origin + value.GetNumDimensions());
+        const uint32_t* const sizes = value.GetViewSizes(view);
+        m_Words.insert(m_Words.end(), sizes, sizes + value.GetNumDimensions());
+    }
+}
+
+uint32_t DescriptorReader::Next()
+{
+    if (m_Position >= m_NumWords)
+    {
+        throw ParseException("Invalid descriptor: unexpected end of the descriptor data");
+    }
+    return m_Words[m_Position++];
+}
+
+void DescriptorReader::CheckFullyRead() const
+{
+    if (m_Position != m_NumWords)
+    {
+        throw ParseException("Invalid descriptor: size doesn't match the layer type");
+    }
+}
+
+void DescriptorReader::operator()(std::string& value)
+{
+    const uint32_t size = Next();
+    const std::size_t numWords = (static_cast<std::size_t>(size) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    if (numWords > m_NumWords - m_Position)
+    {
+        throw ParseException("Invalid descriptor: string larger than the descriptor");
+    }
+    value.assign(reinterpret_cast<const char*>(m_Words + m_Position), size);
+    m_Position += numWords;
+}
+
+void DescriptorReader::operator()(TensorShape& value)
+{
+    const uint32_t numDimensions = Next();
+    if (numDimensions > MaxNumOfTensorDimensions)
+    {
+        throw ParseException("Invalid descriptor: too many dimensions");
+    }
+
+    unsigned int dimensions[MaxNumOfTensorDimensions] = {};
+    for (uint32_t i = 0; i < numDimensions; ++i)
+    {
+        dimensions[i] = Next();
+    }
+    value = (numDimensions == 0) ? TensorShape() : TensorShape(numDimensions, dimensions);
+}
+
+void DescriptorReader::operator()(PermutationVector& value)
+{
+    const uint32_t size = Next();
+    if (size > MaxNumOfTensorDimensions)
+    {
+        throw ParseException("Invalid descriptor: too many dimensions");
+    }
+
+    PermutationVector::ValueType mappings[MaxNumOfTensorDimensions] = {};
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        mappings[i] = Next();
+    }
+    value = PermutationVector(mappings, size);
+}
+
+void DescriptorReader::operator()(OriginsDescriptor& value)
+{
+    const uint32_t numViews      = Next();
+    const uint32_t numDimensions = Next();
+    const uint32_t concatAxis    = Next();
+    if (static_cast<uint64_t>(numViews) * numDimensions > m_NumWords - m_Position)
+    {
+        throw ParseException("Invalid descriptor: views larger than the descriptor");
+    }
+
+    OriginsDescriptor descriptor(numViews, numDimensions);
+    descriptor.SetConcatAxis(concatAxis);
+    for (uint32_t view = 0; view < numViews; ++view)
+    {
+        for (uint32_t dimension = 0; dimension < numDimensions; ++dimension)
+        {
+            descriptor.SetViewOriginCoord(view, dimension, Next());
+        }
+    }
+    value = descriptor;
+}
+
+void DescriptorReader::operator()(ViewsDescriptor& value)
+{
+    const uint32_t numViews      = Next();
+    const uint32_t numDimensions = Next();
+    if (static_cast<uint64_t>(numViews) * numDimensions * 2 > m_NumWords - m_Position)
+    {
+        throw ParseException("Invalid descriptor: views larger than the descriptor");
+    }
+
+    ViewsDescriptor descriptor(numViews, numDimensions);
+    for (uint32_t view = 0; view < numViews; ++view)
+    {
+        for (uint32_t dimension = 0; dimension < numDimensions; ++dimension)
+        {
+            descriptor.SetViewOriginCoord(view, dimension, Next());
+        }
+        for (uint32_t dimension = 0; dimension < numDimensions; ++dimension)
+        {
+            descriptor.SetViewSize(view, dimension, Next());
+        }
+    }
+    value = descriptor;
+}
+
+} // namespace armnnSerializer
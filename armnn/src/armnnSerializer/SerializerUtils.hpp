@@ -0,0 +1,166 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "SerializerFormat.hpp"
+
+#include <DescriptorFields.hpp>
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Exceptions.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace armnnSerializer
+{
+
+TensorInfoRecord ToTensorInfoRecord(const armnn::TensorInfo& tensorInfo);
+armnn::TensorInfo ToTensorInfo(const TensorInfoRecord& record);
+
+/// Appends the fields of descriptors to the Descriptors section, one 32-bit word per scalar.
+class DescriptorWriter
+{
+public:
+    explicit DescriptorWriter(std::vector<uint32_t>& words)
+    : m_Words(words)
+    {
+    }
+
+    void operator()(uint32_t value) { m_Words.push_back(value); }
+    void operator()(int32_t value) { m_Words.push_back(static_cast<uint32_t>(value)); }
+    void operator()(bool value) { m_Words.push_back(value ? 1u : 0u); }
+
+    void operator()(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        m_Words.push_back(bits);
+    }
+
+    template <typename Enum>
+    typename std::enable_if<std::is_enum<Enum>::value>::type operator()(Enum value)
+    {
+        m_Words.push_back(static_cast<uint32_t>(value));
+    }
+
+    template <typename T>
+    void operator()(const std::vector<T>& values)
+    {
+        (*this)(static_cast<uint32_t>(values.size()));
+        for (const T& value : values)
+        {
+            (*this)(value);
+        }
+    }
+
+    template <typename T, typename U>
+    void operator()(const std::pair<T, U>& value)
+    {
+        (*this)(value.first);
+        (*this)(value.second);
+    }
+
+    void operator()(const std::string& value);
+    void operator()(const armnn::TensorShape& value);
+    void operator()(const armnn::PermutationVector& value);
+    void operator()(const armnn::OriginsDescriptor& value);
+    void operator()(const armnn::ViewsDescriptor& value);
+
+private:
+    std::vector<uint32_t>& m_Words;
+};
+
+/// Reads back the fields written by DescriptorWriter, checking the size of the encoded descriptor.
+class DescriptorReader
+{
+public:
+    DescriptorReader(const uint32_t* words, std::size_t numWords)
+    : m_Words(words)
+    , m_NumWords(numWords)
+    , m_Position(0)
+    {
+    }
+
+    void operator()(uint32_t& value) { value = Next(); }
+    void operator()(int32_t& value) { value = static_cast<int32_t>(Next()); }
+    void operator()(bool& value) { value = Next() != 0; }
+
+    void operator()(float& value)
+    {
+        const uint32_t bits = Next();
+        std::memcpy(&value, &bits, sizeof(value));
+    }
+
+    template <typename Enum>
+    typename std::enable_if<std::is_enum<Enum>::value>::type operator()(Enum& value)
+    {
+        value = static_cast<Enum>(Next());
+    }
+
+    template <typename T>
+    void operator()(std::vector<T>& values)
+    {
+        const uint32_t size = Next();
+        if (size > m_NumWords - m_Position)
+        {
+            throw armnn::ParseException("Invalid descriptor: vector larger than the descriptor");
+        }
+        values.resize(size);
+        for (T& value : values)
+        {
+            (*this)(value);
+        }
+    }
+
+    template <typename T, typename U>
+    void operator()(std::pair<T, U>& value)
+    {
+        (*this)(value.first);
+        (*this)(value.second);
+    }
+
+    void operator()(std::string& value);
+    void operator()(armnn::TensorShape& value);
+    void operator()(armnn::PermutationVector& value);
+    void operator()(armnn::OriginsDescriptor& value);
+    void operator()(armnn::ViewsDescriptor& value);
+
+    /// Whether all the words of the descriptor have been read.
+    bool IsFullyRead() const { return m_Position == m_NumWords; }
+
+    /// Throws if the descriptor has words left, i.e. it was not written for the type it is read as.
+    void CheckFullyRead() const;
+
+private:
+    uint32_t Next();
+
+    const uint32_t* m_Words;
+    std::size_t     m_NumWords;
+    std::size_t     m_Position;
+};
+
+template <typename Descriptor>
+void WriteDescriptor(DescriptorWriter& writer, const Descriptor& descriptor)
+{
+    VisitDescriptor(writer, const_cast<Descriptor&>(descriptor));
+}
+
+template <typename Descriptor>
+Descriptor ReadDescriptor(const uint32_t* words, std::size_t numWords)
+{
+    DescriptorReader reader(words, numWords);
+    Descriptor descriptor;
+    VisitDescriptor(reader, descriptor);
+    reader.CheckFullyRead();
+    return descriptor;
+}
+
+} // namespace armnnSerializer
@@ -0,0 +1,49 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/Types.hpp>
+
+namespace armnnUtils
+{
+
+/// Provides access to the appropriate indexes for Channels, Height and Width based on DataLayout
+class DataLayoutIndexed
+{
+public:
+    DataLayoutIndexed(armnn::DataLayout dataLayout)
+    : m_DataLayout(dataLayout)
+    {
+        switch (dataLayout)
+        {
+            case armnn::DataLayout::NHWC:
+                m_ChannelsIndex = 3;
+                m_HeightIndex   = 1;
+                m_WidthIndex    = 2;
+                break;
+            case armnn::DataLayout::NCHW:
+                m_ChannelsIndex = 1;
+                m_HeightIndex   = 2;
+                m_WidthIndex    = 3;
+                break;
+            default:
+                throw armnn::InvalidArgumentException("Unknown DataLayout value");
+        }
+    }
+
+    armnn::DataLayout GetDataLayout() const { return m_DataLayout; }
+    unsigned int GetChannelsIndex() const { return m_ChannelsIndex; }
+    unsigned int GetHeightIndex() const { return m_HeightIndex; }
+    unsigned int GetWidthIndex() const { return m_WidthIndex; }
+
+private:
+    armnn::DataLayout m_DataLayout;
+    unsigned int      m_ChannelsIndex;
+    unsigned int      m_HeightIndex;
+    unsigned int      m_WidthIndex;
+};
+
+} // namespace armnnUtils
@@ -0,0 +1,169 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "FloatingPointConverter.hpp"
+
+#include <boost/assert.hpp>
+
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARMNN_FLOATING_POINT_CONVERTER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+uint32_t GetBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float FromBits(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint16_t Float32To16(float value)
+{
+    const uint32_t bits = GetBits(value);
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000u);
+    uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+    if (magnitude >= 0x7F800000u)
+    {
+        // Infinity, or NaN kept quiet with the top of its payload.
+        const uint32_t payload = magnitude > 0x7F800000u ? (0x200u | ((magnitude >> 13) & 0x3FFu)) : 0u;
+        return static_cast<uint16_t>(sign | 0x7C00u | payload);
+    }
+    if (magnitude >= 0x477FF000u)
+    {
+        // Rounds beyond 65504, the largest Float16 value.
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    if (magnitude < 0x38800000u)
+    {
+        // Subnormal (or zero) as a Float16: adding 0.5 aligns the value so that the FPU rounds it to a multiple of
+        // 2^-24, the Float16 subnormal step, which ends up in the low bits.
+        const float aligned = FromBits(magnitude) + 0.5f;
+        return static_cast<uint16_t>(sign | (GetBits(aligned) - 0x3F000000u));
+    }
+
+    // Normal: rebias the exponent and round the mantissa to 10 bits, ties to even.
+    const uint32_t isMantissaOdd = (magnitude >> 13) & 1u;
+    magnitude += (uint32_t(15 - 127) << 23) + 0xFFFu + isMantissaOdd;
+    return static_cast<uint16_t>(sign | (magnitude >> 13));
+}
+
+float Float16To32(uint16_t value)
+{
+    const uint32_t sign = uint32_t(value & 0x8000u) << 16;
+    const uint32_t exponent = value & 0x7C00u;
+    const uint32_t mantissa = value & 0x03FFu;
+
+    if (exponent == 0x7C00u)
+    {
+        // Infinity, or NaN made quiet.
+        return FromBits(sign | 0x7F800000u | (mantissa << 13) | (mantissa != 0 ? 0x400000u : 0u));
+    }
+    if (exponent == 0)
+    {
+        // Zero or subnormal: mantissa * 2^-24, exact in Float32.
+        const float magnitude = static_cast<float>(mantissa) * FromBits(0x33800000u);
+        return FromBits(sign | GetBits(magnitude));
+    }
+    return FromBits(sign | (((exponent >> 10) + (127 - 15)) << 23) | (mantissa << 13));
+}
+
+#if defined(ARMNN_FLOATING_POINT_CONVERTER_X86)
+
+__attribute__((target("avx,f16c")))
+std::size_t ConvertFloat32To16F16c(const float* src, std::size_t numElements, uint16_t* dst)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= numElements; i += 8)
+    {
+        const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), half);
+    }
+    return i;
+}
+
+__attribute__((target("avx,f16c")))
+std::size_t ConvertFloat16To32F16c(const uint16_t* src, std::size_t numElements, float* dst)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= numElements; i += 8)
+    {
+        const __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+    }
+    return i;
+}
+
+bool HasF16c()
+{
+    static const bool hasF16c = []()
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+    }();
+    return hasF16c;
+}
+
+#endif
+
+} // namespace
+
+void FloatingPointConverter::ConvertFloat32To16(const float* srcFloat32Buffer,
+                                                std::size_t numElements,
+                                                void* dstFloat16Buffer)
+{
+    BOOST_ASSERT(srcFloat32Buffer != nullptr || numElements == 0);
+    BOOST_ASSERT(dstFloat16Buffer != nullptr || numElements == 0);
+
+    uint16_t* const dst = static_cast<uint16_t*>(dstFloat16Buffer);
+    std::size_t i = 0;
+#if defined(ARMNN_FLOATING_POINT_CONVERTER_X86)
+    if (HasF16c())
+    {
+        i = ConvertFloat32To16F16c(srcFloat32Buffer, numElements, dst);
+    }
+#endif
+    for (; i < numElements; ++i)
+    {
+        dst[i] = Float32To16(srcFloat32Buffer[i]);
+    }
+}
+
+void FloatingPointConverter::ConvertFloat16To32(const void* srcFloat16Buffer,
+                                                std::size_t numElements,
+                                                float* dstFloat32Buffer)
+{
+    BOOST_ASSERT(srcFloat16Buffer != nullptr || numElements == 0);
+    BOOST_ASSERT(dstFloat32Buffer != nullptr || numElements == 0);
+
+    const uint16_t* const src = static_cast<const uint16_t*>(srcFloat16Buffer);
+    std::size_t i = 0;
+#if defined(ARMNN_FLOATING_POINT_CONVERTER_X86)
+    if (HasF16c())
+    {
+        i = ConvertFloat16To32F16c(src, numElements, dstFloat32Buffer);
+    }
+#endif
+    for (; i < numElements; ++i)
+    {
+        dstFloat32Buffer[i] = Float16To32(src[i]);
+    }
+}
+
+} // namespace armnnUtils
@@ -0,0 +1,24 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace armnnUtils
+{
+
+/// Bulk conversions between Float32 and Float16 (IEEE 754 binary16) buffers, vectorized with F16C on the x86 CPUs
+/// that support it. Both paths round to the nearest even and handle subnormals, infinities and NaNs alike, so the
+/// results don't depend on the machine: values beyond the Float16 range become infinities.
+class FloatingPointConverter
+{
+public:
+    static void ConvertFloat32To16(const float* srcFloat32Buffer, std::size_t numElements, void* dstFloat16Buffer);
+
+    static void ConvertFloat16To32(const void* srcFloat16Buffer, std::size_t numElements, float* dstFloat32Buffer);
+};
+
+} // namespace armnnUtils
@@ -0,0 +1,120 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "Hash.hpp"
+
+#include <cstring>
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+constexpr uint64_t Prime1 = 11400714785074694791ULL;
+constexpr uint64_t Prime2 = 14029467366897019727ULL;
+constexpr uint64_t Prime3 =  1609587929392839161ULL;
+constexpr uint64_t Prime4 =  9650029242287828579ULL;
+constexpr uint64_t Prime5 =  2870177450012600261ULL;
+
+inline uint64_t RotateLeft(uint64_t value, unsigned int bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t Read64(const uint8_t* data)
+{
+    uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint32_t Read32(const uint8_t* data)
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint64_t Round(uint64_t accumulator, uint64_t input)
+{
+    accumulator += input * Prime2;
+    accumulator  = RotateLeft(accumulator, 31);
+    return accumulator * Prime1;
+}
+
+inline uint64_t MergeRound(uint64_t accumulator, uint64_t value)
+{
+    accumulator ^= Round(0, value);
+    return accumulator * Prime1 + Prime4;
+}
+
+} // namespace
+
+uint64_t Hash64(const void* data, std::size_t size, uint64_t seed)
+{
+    const uint8_t* input     = static_cast<const uint8_t*>(data);
+    const uint8_t* const end = input + size;
+
+    uint64_t hash;
+    if (size >= 32)
+    {
+        // Four independent lanes keep the multiplier pipelines busy on large buffers such as weights.
+        uint64_t lane1 = seed + Prime1 + Prime2;
+        uint64_t lane2 = seed + Prime2;
+        uint64_t lane3 = seed;
+        uint64_t lane4 = seed - Prime1;
+
+        const uint8_t* const limit = end - 32;
+        do
+        {
+            lane1 = Round(lane1, Read64(input));
+            lane2 = Round(lane2, Read64(input + 8));
+            lane3 = Round(lane3, Read64(input + 16));
+            lane4 = Round(lane4, Read64(input + 24));
+            input += 32;
+        }
+        while (input <= limit);
+
+        hash = RotateLeft(lane1, 1) + RotateLeft(lane2, 7) + RotateLeft(lane3, 12) + RotateLeft(lane4, 18);
+        hash = MergeRound(hash, lane1);
+        hash = MergeRound(hash, lane2);
+        hash = MergeRound(hash, lane3);
+        hash = MergeRound(hash, lane4);
+    }
+    else
+    {
+        hash = seed + Prime5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    while (input + 8 <= end)
+    {
+        hash ^= Round(0, Read64(input));
+        hash  = RotateLeft(hash, 27) * Prime1 + Prime4;
+        input += 8;
+    }
+    if (input + 4 <= end)
+    {
+        hash ^= static_cast<uint64_t>(Read32(input)) * Prime1;
+        hash  = RotateLeft(hash, 23) * Prime2 + Prime3;
+        input += 4;
+    }
+    while (input < end)
+    {
+        hash ^= static_cast<uint64_t>(*input) * Prime5;
+        hash  = RotateLeft(hash, 11) * Prime1;
+        ++input;
+    }
+
+    hash ^= hash >> 33;
+    hash *= Prime2;
+    hash ^= hash >> 29;
+    hash *= Prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+} // namespace armnnUtils
@@ -0,0 +1,23 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace armnnUtils
+{
+
+/// 64-bit non-cryptographic hash of a block of memory (XXH64).
+/// The result only depends on the bytes, so it is stable across runs and processes on little-endian machines.
+uint64_t Hash64(const void* data, std::size_t size, uint64_t seed = 0);
+
+/// Mixes a value into a hash, for combining the hashes of several fields.
+inline uint64_t HashCombine(uint64_t hash, uint64_t value)
+{
+    return Hash64(&value, sizeof(value), hash);
+}
+
+} // namespace armnnUtils
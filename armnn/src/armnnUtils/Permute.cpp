@@ -0,0 +1,148 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "Permute.hpp"
+
+#include <boost/assert.hpp>
+
+#include <cstdint>
+
+using namespace armnn;
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+struct Element1 { uint8_t  m_Bytes[1]; };
+struct Element2 { uint8_t  m_Bytes[2]; };
+struct Element4 { uint8_t  m_Bytes[4]; };
+
+/// Walks the source tensor in memory order, writing each element at its place in the destination.
+/// dstStrides[i] is the distance in the destination between two consecutive indices of source dimension i.
+template <typename T>
+void PermuteElements(unsigned int numDimensions,
+                     const unsigned int* srcSizes,
+                     const std::size_t* dstStrides,
+                     const T* src,
+                     T* dst)
+{
+    if (numDimensions == 0)
+    {
+        *dst = *src;
+        return;
+    }
+
+    std::size_t numOuter = 1;
+    for (unsigned int d = 0; d + 1 < numDimensions; ++d)
+    {
+        numOuter *= srcSizes[d];
+    }
+    const unsigned int numInner = srcSizes[numDimensions - 1];
+    const std::size_t innerStride = dstStrides[numDimensions - 1];
+
+    unsigned int indices[MaxNumOfTensorDimensions] = {};
+    std::size_t dstOffset = 0;
+    for (std::size_t outer = 0; outer < numOuter; ++outer)
+    {
+        T* const dstRow = dst + dstOffset;
+        for (unsigned int i = 0; i < numInner; ++i)
+        {
+            dstRow[i * innerStride] = *src++;
+        }
+
+        // Moves to the next row of the source, carrying into the outer dimensions.
+        for (unsigned int d = numDimensions - 1; d-- > 0;)
+        {
+            dstOffset += dstStrides[d];
+            if (++indices[d] < srcSizes[d])
+            {
+                break;
+            }
+            dstOffset -= dstStrides[d] * srcSizes[d];
+            indices[d] = 0;
+        }
+    }
+}
+
+} // namespace
+
+TensorShape Permuted(const TensorShape& srcShape, const PermutationVector& mappings)
+{
+    const unsigned int numDimensions = srcShape.GetNumDimensions();
+    BOOST_ASSERT(mappings.GetSize() == numDimensions);
+
+    unsigned int dstSizes[MaxNumOfTensorDimensions] = {};
+    for (unsigned int i = 0; i < numDimensions; ++i)
+    {
+        BOOST_ASSERT(mappings[i] < numDimensions);
+        dstSizes[mappings[i]] = srcShape[i];
+    }
+    return TensorShape(numDimensions, dstSizes);
+}
+
+void Permute(const TensorShape& dstShape,
+             const PermutationVector& mappings,
+             const void* src,
+             void* dst,
+             std::size_t dataTypeSize)
+{
+    const unsigned int numDimensions = dstShape.GetNumDimensions();
+    BOOST_ASSERT(mappings.GetSize() == numDimensions);
+    if (dstShape.GetNumElements() == 0)
+    {
+        return;
+    }
+
+    std::size_t dstDimensionStrides[MaxNumOfTensorDimensions] = {};
+    std::size_t stride = 1;
+    for (unsigned int d = numDimensions; d-- > 0;)
+    {
+        dstDimensionStrides[d] = stride;
+        stride *= dstShape[d];
+    }
+
+    unsigned int srcSizes[MaxNumOfTensorDimensions] = {};
+    std::size_t dstStrides[MaxNumOfTensorDimensions] = {};
+    for (unsigned int i = 0; i < numDimensions; ++i)
+    {
+        srcSizes[i] = dstShape[mappings[i]];
+        dstStrides[i] = dstDimensionStrides[mappings[i]];
+    }
+
+    switch (dataTypeSize)
+    {
+        case 1:
+            PermuteElements(numDimensions, srcSizes, dstStrides,
+                            static_cast<const Element1*>(src), static_cast<Element1*>(dst));
+            break;
+        case 2:
+            PermuteElements(numDimensions, srcSizes, dstStrides,
+                            static_cast<const Element2*>(src), static_cast<Element2*>(dst));
+            break;
+        case 4:
+            PermuteElements(numDimensions, srcSizes, dstStrides,
+                            static_cast<const Element4*>(src), static_cast<Element4*>(dst));
+            break;
+        default:
+        {
+            // Any other element size, one byte at a time: the size becomes an extra innermost dimension.
+            unsigned int byteSizes[MaxNumOfTensorDimensions + 1] = {};
+            std::size_t byteStrides[MaxNumOfTensorDimensions + 1] = {};
+            for (unsigned int i = 0; i < numDimensions; ++i)
+            {
+                byteSizes[i] = srcSizes[i];
+                byteStrides[i] = dstStrides[i] * dataTypeSize;
+            }
+            byteSizes[numDimensions] = static_cast<unsigned int>(dataTypeSize);
+            byteStrides[numDimensions] = 1;
+            PermuteElements(numDimensions + 1, byteSizes, byteStrides,
+                            static_cast<const Element1*>(src), static_cast<Element1*>(dst));
+            break;
+        }
+    }
+}
+
+} // namespace armnnUtils
@@ -0,0 +1,28 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <cstddef>
+
+namespace armnnUtils
+{
+
+/// The shape of a tensor of the given shape once its dimensions are permuted: dimension i becomes dimension
+/// mappings[i]. The mappings must have one entry per dimension.
+armnn::TensorShape Permuted(const armnn::TensorShape& srcShape, const armnn::PermutationVector& mappings);
+
+/// Copies src into dst with its dimensions permuted as described by the mappings (see Permuted()).
+/// @param dstShape - Shape of the permuted tensor.
+/// @param dataTypeSize - Size of the elements in bytes.
+void Permute(const armnn::TensorShape& dstShape,
+             const armnn::PermutationVector& mappings,
+             const void* src,
+             void* dst,
+             std::size_t dataTypeSize);
+
+} // namespace armnnUtils
@@ -0,0 +1,232 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "ThreadPool.hpp"
+
+#include <boost/assert.hpp>
+
+#include <exception>
+#include <iterator>
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+/// The pool the calling thread is a worker of, and the index of its queue.
+thread_local const ThreadPool* t_WorkerPool = nullptr;
+thread_local std::size_t t_WorkerQueueIndex = 0;
+
+} // namespace
+
+/// The state shared by the tasks of a ParallelFor() call.
+struct ThreadPool::Batch
+{
+    Batch(const std::function<void(std::size_t)>& function, std::size_t count)
+    : m_Function(function)
+    , m_NumRemaining(count)
+    {}
+
+    const std::function<void(std::size_t)>& m_Function;
+    std::atomic<std::size_t> m_NumRemaining;
+
+    std::mutex         m_ErrorMutex;
+    std::exception_ptr m_Error;
+};
+
+ThreadPool::ThreadPool(unsigned int numThreads)
+: m_NumQueuedTasks(0)
+, m_Stop(false)
+{
+    // One queue per worker, then the one of the other threads.
+    for (unsigned int i = 0; i <= numThreads; ++i)
+    {
+        m_Queues.emplace_back(std::make_unique<Queue>());
+    }
+
+    m_Workers.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        m_Workers.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+        m_Stop = true;
+    }
+    m_WakeCondition.notify_all();
+
+    for (std::thread& worker : m_Workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::ParallelFor(std::size_t count, const std::function<void(std::size_t)>& task)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    Batch batch(task, count);
+    const std::size_t queueIndex = GetQueueIndex();
+    // Counted before they can be taken, so that the count never goes below the number of tasks actually queued.
+    m_NumQueuedTasks += count;
+    {
+        Queue& queue = *m_Queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.m_Mutex);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            queue.m_Tasks.push_back({ &batch, i });
+        }
+    }
+    NotifyAll();
+
+    // Help with the tasks of the batch until none is left queued, then wait for those the other threads took.
+    Task pending;
+    while (TryTakeBatchTask(queueIndex, batch, pending))
+    {
+        RunTask(pending);
+    }
+    {
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_WakeCondition.wait(lock, [&batch]() { return batch.m_NumRemaining.load() == 0; });
+    }
+
+    if (batch.m_Error)
+    {
+        std::rethrow_exception(batch.m_Error);
+    }
+}
+
+std::size_t ThreadPool::GetQueueIndex() const
+{
+    return t_WorkerPool == this ? t_WorkerQueueIndex : m_Queues.size() - 1;
+}
+
+bool ThreadPool::TryTakeTask(std::size_t queueIndex, Task& task)
+{
+    {
+        Queue& queue = *m_Queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.m_Mutex);
+        if (!queue.m_Tasks.empty())
+        {
+            task = queue.m_Tasks.back();
+            queue.m_Tasks.pop_back();
+            --m_NumQueuedTasks;
+            return true;
+        }
+    }
+
+    for (std::size_t i = 1; i < m_Queues.size(); ++i)
+    {
+        Queue& victim = *m_Queues[(queueIndex + i) % m_Queues.size()];
+        std::lock_guard<std::mutex> lock(victim.m_Mutex);
+        if (!victim.m_Tasks.empty())
+        {
+            task = victim.m_Tasks.front();
+            victim.m_Tasks.pop_front();
+            --m_NumQueuedTasks;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ThreadPool::TryTakeBatchTask(std::size_t queueIndex, const Batch& batch, Task& task)
+{
+    // The tasks of the batch are usually at the back, but the queue of the threads which are not workers is shared.
+    Queue& queue = *m_Queues[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.m_Mutex);
+    for (auto it = queue.m_Tasks.rbegin(); it != queue.m_Tasks.rend(); ++it)
+    {
+        if (it->m_Batch == &batch)
+        {
+            task = *it;
+            queue.m_Tasks.erase(std::next(it).base());
+            --m_NumQueuedTasks;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::RunTask(const Task& task)
+{
+    Batch& batch = *task.m_Batch;
+    try
+    {
+        batch.m_Function(task.m_Index);
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(batch.m_ErrorMutex);
+        if (!batch.m_Error)
+        {
+            batch.m_Error = std::current_exception();
+        }
+    }
+
+    // The batch may be destroyed as soon as its last task is accounted for: it must not be touched afterwards.
+    if (--batch.m_NumRemaining == 0)
+    {
+        NotifyAll();
+    }
+}
+
+void ThreadPool::WorkerLoop(std::size_t queueIndex)
+{
+    t_WorkerPool = this;
+    t_WorkerQueueIndex = queueIndex;
+
+    while (true)
+    {
+        Task task;
+        if (TryTakeTask(queueIndex, task))
+        {
+            RunTask(task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_WakeCondition.wait(lock, [this]()
+        {
+            return m_Stop || m_NumQueuedTasks.load() != 0;
+        });
+        if (m_Stop)
+        {
+            BOOST_ASSERT(m_NumQueuedTasks.load() == 0);
+            return;
+        }
+    }
+}
+
+void ThreadPool::NotifyAll()
+{
+    // Taking the mutex orders the notification after the check of any thread about to wait.
+    {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+    }
+    m_WakeCondition.notify_all();
+}
+
+void ParallelFor(ThreadPool* threadPool, std::size_t count, const std::function<void(std::size_t)>& task)
+{
+    if (threadPool != nullptr)
+    {
+        threadPool->ParallelFor(count, task);
+        return;
+    }
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        task(i);
+    }
+}
+
+} // namespace armnnUtils
@@ -0,0 +1,89 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnnUtils
+{
+
+/// A pool of worker threads balancing their load by work stealing.
+///
+/// Each worker has its own queue of tasks: it pushes the tasks it creates to the back of it and takes its next
+/// task from the back too, so that nested work stays on the thread which created it, while idle workers steal from
+/// the front of the queues of the others, taking the oldest (usually the largest) tasks. Threads which are not
+/// workers share one more queue. Threads waiting for their tasks to complete execute the pending tasks of the same
+/// ParallelFor() call meanwhile, so tasks can themselves call ParallelFor() without any risk of deadlock. They
+/// don't take unrelated tasks, which could keep them busy long after their own call is complete.
+class ThreadPool
+{
+public:
+    /// @param numThreads - Number of worker threads to start, in addition to the threads calling ParallelFor(),
+    /// which take part in the work. 0 makes a pool which runs all tasks on the calling thread.
+    explicit ThreadPool(unsigned int numThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned int GetNumThreads() const { return static_cast<unsigned int>(m_Workers.size()); }
+
+    /// Calls task(i) for every i in [0, count), in any order and on any thread of the pool (the calling one
+    /// included), and returns once all the calls have returned. If any call throws, the first exception caught is
+    /// rethrown then.
+    void ParallelFor(std::size_t count, const std::function<void(std::size_t)>& task);
+
+private:
+    struct Batch;
+
+    struct Task
+    {
+        Batch*      m_Batch;
+        std::size_t m_Index;
+    };
+
+    struct Queue
+    {
+        std::mutex       m_Mutex;
+        std::deque<Task> m_Tasks;
+    };
+
+    /// Index of the queue of the calling thread.
+    std::size_t GetQueueIndex() const;
+
+    /// Takes the most recent task of the given queue or, failing that, steals the oldest task of another one.
+    bool TryTakeTask(std::size_t queueIndex, Task& task);
+
+    /// Takes the most recent task of the batch from the given queue, the one its tasks were pushed to.
+    bool TryTakeBatchTask(std::size_t queueIndex, const Batch& batch, Task& task);
+
+    void RunTask(const Task& task);
+
+    void WorkerLoop(std::size_t queueIndex);
+
+    /// Wakes the threads waiting for tasks or for the completion of their batch.
+    void NotifyAll();
+
+    std::vector<std::unique_ptr<Queue>> m_Queues;
+    std::vector<std::thread>            m_Workers;
+    std::atomic<std::size_t>            m_NumQueuedTasks;
+
+    std::mutex              m_WakeMutex;
+    std::condition_variable m_WakeCondition;
+    bool                    m_Stop;
+};
+
+/// Calls task(i) for every i in [0, count) on the pool, or in order on the calling thread if threadPool is nullptr.
+void ParallelFor(ThreadPool* threadPool, std::size_t count, const std::function<void(std::size_t)>& task);
+
+} // namespace armnnUtils
@@ -0,0 +1,155 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefConstantFolding.hpp"
+
+#include "RefExecutor.hpp"
+
+#include <ConstantPool.hpp>
+#include <DeadLayerElimination.hpp>
+#include <Graph.hpp>
+#include <LayersFwd.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/cast.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Whether the layer could be folded, given the tensors known so far: it computes something, from inputs which
+/// are all known, into outputs whose TensorInfos are set.
+bool HasConstantInputs(const Layer& layer, const std::unordered_map<const OutputSlot*, const void*>& values)
+{
+    if (layer.GetNumInputSlots() == 0 || layer.GetType() == LayerType::Output)
+    {
+        return false;
+    }
+    for (auto&& inputSlot : layer.GetInputSlots())
+    {
+        const OutputSlot* const source = inputSlot.GetConnectedOutputSlot();
+        if (source == nullptr || values.count(source) == 0)
+        {
+            return false;
+        }
+    }
+    for (auto&& outputSlot : layer.GetOutputSlots())
+    {
+        if (!outputSlot.IsTensorInfoSet())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+unsigned int FoldConstants(Graph& graph)
+{
+    // The values of the tensors known ahead of time: the tensors of the Constant layers, used in place, and the
+    // outputs of the folded layers, computed into buffers.
+    std::unordered_map<const OutputSlot*, const void*> values;
+    std::unordered_map<const OutputSlot*, ConstantPool::Buffer> computedValues;
+    std::vector<Layer*> foldedLayers;
+    std::unordered_set<const Layer*> isFolded;
+
+    for (Layer* layer : graph.TopologicalSort())
+    {
+        if (layer->GetType() == LayerType::Constant)
+        {
+            values.emplace(&layer->GetOutputSlot(0),
+                           boost::polymorphic_downcast<const ConstantLayer*>(layer)->m_LayerOutput.GetMemoryArea());
+            continue;
+        }
+        if (!HasConstantInputs(*layer, values))
+        {
+            continue;
+        }
+
+        std::vector<const void*> inputs;
+        for (auto&& inputSlot : layer->GetInputSlots())
+        {
+            inputs.push_back(values.at(inputSlot.GetConnectedOutputSlot()));
+        }
+        std::vector<void*> outputs;
+        std::vector<ConstantPool::Buffer> outputData;
+        for (auto&& outputSlot : layer->GetOutputSlots())
+        {
+            outputData.emplace_back(outputSlot.GetTensorInfo().GetNumBytes());
+            outputs.push_back(outputData.back().data());
+        }
+
+        try
+        {
+            RefExecutor::ExecuteLayer(*layer, inputs, outputs);
+        }
+        catch (const UnimplementedException&)
+        {
+            // Left to the backend running the network, which may support it.
+            continue;
+        }
+
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            const OutputSlot* const outputSlot = &layer->GetOutputSlot(i);
+            values.emplace(outputSlot, outputData[i].data());
+            computedValues.emplace(outputSlot, std::move(outputData[i]));
+        }
+        foldedLayers.push_back(layer);
+        isFolded.insert(layer);
+    }
+
+    ConstantPool& constantPool = graph.GetConstantPool();
+    for (Layer* layer : foldedLayers)
+    {
+        for (auto outputSlot = layer->BeginOutputSlots(); outputSlot != layer->EndOutputSlots(); ++outputSlot)
+        {
+            std::vector<InputSlot*> consumers;
+            for (InputSlot* consumer : outputSlot->GetConnections())
+            {
+                if (isFolded.count(&consumer->GetOwningLayer()) == 0)
+                {
+                    consumers.push_back(consumer);
+                }
+            }
+            if (consumers.empty())
+            {
+                continue;
+            }
+
+            // The data of the tensor is not needed anymore: the layers folded after this one are all computed.
+            const TensorInfo& info = outputSlot->GetTensorInfo();
+            ConstantLayer* const constant = graph.AddLayer<ConstantLayer>(layer->GetName());
+            constant->m_LayerOutput = constantPool.Add(info, std::move(computedValues.at(&*outputSlot)));
+            constant->GetOutputSlot(0).SetTensorInfo(info);
+            constant->AddRelatedLayerName(layer->GetName());
+            for (StringPool::StringId relatedName : layer->GetRelatedLayerNames())
+            {
+                constant->AddRelatedLayerName(graph.GetStringPool().Get(relatedName));
+            }
+
+            for (InputSlot* consumer : consumers)
+            {
+                outputSlot->Disconnect(*consumer);
+                constant->GetOutputSlot(0).Connect(*consumer);
+            }
+        }
+    }
+
+    // Even when nothing was folded: the graph may have dead branches of its own.
+    EliminateDeadLayers(graph);
+    return static_cast<unsigned int>(foldedLayers.size());
+}
+
+} // namespace armnn
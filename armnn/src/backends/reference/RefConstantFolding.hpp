@@ -0,0 +1,22 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+namespace armnn
+{
+
+class Graph;
+
+/// Computes ahead of time, with the kernels of the reference backend (see RefExecutor::ExecuteLayer()), the layers
+/// whose inputs are all constant: Constant layers, or layers folded before them. Each folded tensor read by a layer
+/// which is not folded is replaced by a single Constant layer holding its value, named after the layer producing it
+/// (and recording the names of the layers folded into it). The folded layers, and the other layers left unable to
+/// reach an Output layer, are then removed (see EliminateDeadLayers()).
+/// The TensorInfos of the graph must be set. Layers the reference backend cannot compute are left as they are, and
+/// so are the layers reading them. The memory plan of the graph is invalidated if any layer is removed.
+/// @return The number of layers folded.
+unsigned int FoldConstants(Graph& graph);
+
+} // namespace armnn
@@ -0,0 +1,576 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefExecutor.hpp"
+
+#include "workloads/RefActivationUint8Workload.hpp"
+#include "workloads/RefActivationWorkload.hpp"
+#include "workloads/RefBatchNormalizationWorkload.hpp"
+#include "workloads/RefConvertFp16ToFp32Workload.hpp"
+#include "workloads/RefConvertFp32ToFp16Workload.hpp"
+#include "workloads/RefConvolution2dUint8Workload.hpp"
+#include "workloads/RefConvolution2dWorkload.hpp"
+#include "workloads/RefDepthwiseConvolution2dNhwcWorkload.hpp"
+#include "workloads/RefDepthwiseConvolution2dUint8Workload.hpp"
+#include "workloads/RefDepthwiseConvolution2dWorkload.hpp"
+#include "workloads/RefFullyConnectedUint8Workload.hpp"
+#include "workloads/RefFloat16Workload.hpp"
+#include "workloads/RefFullyConnectedWorkload.hpp"
+#include "workloads/RefNormalizationWorkload.hpp"
+#include "workloads/RefPermuteWorkload.hpp"
+#include "workloads/RefPooling2dUint8Workload.hpp"
+#include "workloads/RefPooling2dWorkload.hpp"
+#include "workloads/RefSoftmaxUint8Workload.hpp"
+#include "workloads/RefSoftmaxWorkload.hpp"
+#include "workloads/RefWinogradConvolution2dWorkload.hpp"
+
+#include <Graph.hpp>
+#include <LayerFusion.hpp>
+#include <LayersFwd.hpp>
+#include <MemoryPlanner.hpp>
+#include <Network.hpp>
+#include <WeightPacking.hpp>
+#include <Winograd.hpp>
+
+#include <FloatingPointConverter.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/cast.hpp>
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Copies the tensor of an output slot to an output of the network which doesn't own it (e.g. a network input
+/// forwarded to an output, or a tensor read by several output layers).
+class RefCopyWorkload : public RefWorkload
+{
+public:
+    RefCopyWorkload(unsigned int sourceId, unsigned int destinationId, unsigned int numBytes)
+    : m_SourceId(sourceId)
+    , m_DestinationId(destinationId)
+    , m_NumBytes(numBytes)
+    {
+    }
+
+    void Execute(const RefExecutionContext& context) const override
+    {
+        std::memcpy(context.m_Buffers[m_DestinationId], context.m_Buffers[m_SourceId], m_NumBytes);
+    }
+
+private:
+    unsigned int m_SourceId;
+    unsigned int m_DestinationId;
+    unsigned int m_NumBytes;
+};
+
+/// Returns size bytes of memory aligned to alignment, owned by storage.
+uint8_t* AllocateAligned(std::size_t size, std::size_t alignment, std::unique_ptr<uint8_t[]>& storage)
+{
+    storage.reset(new uint8_t[size + alignment]);
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(storage.get());
+    return storage.get() + (alignment - address % alignment) % alignment;
+}
+
+/// Checks that the tensors of the layer are either all Float32, all Float16 or all QuantisedAsymm8, or, for
+/// conversion layers, that they have the data types converted between.
+void CheckDataTypes(const Layer& layer, const RefWorkloadInfo& info)
+{
+    if (layer.GetType() == LayerType::ConvertFp16ToFp32 || layer.GetType() == LayerType::ConvertFp32ToFp16)
+    {
+        const bool toFp32 = layer.GetType() == LayerType::ConvertFp16ToFp32;
+        if (info.m_InputTensorInfos[0].GetDataType() != (toFp32 ? DataType::Float16 : DataType::Float32) ||
+            info.m_OutputTensorInfos[0].GetDataType() != (toFp32 ? DataType::Float32 : DataType::Float16))
+        {
+            throw LayerValidationException(
+                boost::str(boost::format("The tensors of %1% layer %2% don't have the data types it converts")
+                           % GetLayerTypeAsCString(layer.GetType())
+                           % layer.GetNameStr()));
+        }
+        return;
+    }
+
+    std::vector<DataType> dataTypes;
+    for (const TensorInfo& tensorInfo : info.m_InputTensorInfos)
+    {
+        dataTypes.push_back(tensorInfo.GetDataType());
+    }
+    for (const TensorInfo& tensorInfo : info.m_OutputTensorInfos)
+    {
+        dataTypes.push_back(tensorInfo.GetDataType());
+    }
+    if (dataTypes.empty())
+    {
+        return;
+    }
+
+    const DataType dataType = dataTypes[0];
+    if (dataType != DataType::Float32 && dataType != DataType::Float16 && dataType != DataType::QuantisedAsymm8)
+    {
+        throw UnimplementedException(
+            boost::str(boost::format("The reference backend only supports Float32, Float16 and QuantisedAsymm8 "
+                                     "tensors (%1% layer %2%)")
+                       % GetLayerTypeAsCString(layer.GetType())
+                       % layer.GetNameStr()));
+    }
+    if (std::any_of(dataTypes.begin(), dataTypes.end(), [dataType](DataType other) { return other != dataType; }))
+    {
+        throw UnimplementedException(
+            boost::str(boost::format("The reference backend doesn't support layers mixing data types (%1% layer %2%)")
+                       % GetLayerTypeAsCString(layer.GetType())
+                       % layer.GetNameStr()));
+    }
+}
+
+/// The range the outputs of the layer are clamped to by the activation fused into it, if any.
+OutputBounds GetOutputBounds(const Layer& layer)
+{
+    OutputBounds bounds;
+    const ActivationDescriptor* const activation = GetFusedActivation(layer);
+    if (activation != nullptr)
+    {
+        GetActivationBounds(*activation, bounds.m_Min, bounds.m_Max);
+    }
+    return bounds;
+}
+
+/// The packed weights of the layer (a Convolution2d or FullyConnected layer), if they were packed in the layout its
+/// kernel reads, nullptr otherwise.
+template <typename LayerType>
+const ConstTensor* GetPackedWeight(const LayerType& layer)
+{
+    const bool isPacked = layer.m_PackedWeight.GetMemoryArea() != nullptr &&
+                          layer.m_PackedWeightLayout != PackedWeightLayout::None &&
+                          layer.m_PackedWeightLayout == ChoosePackedWeightLayout(layer);
+    return isPacked ? &layer.m_PackedWeight : nullptr;
+}
+
+/// Throws if the weights of the layer were loaded packed only (see UnpackWeight()), for the kernels which don't
+/// read the packed weights.
+void CheckWeightData(const Layer& layer, const ConstTensor& weight)
+{
+    if (weight.GetMemoryArea() == nullptr)
+    {
+        throw LayerValidationException(
+            boost::str(boost::format("The weights of %1% are only stored packed, in a layout its kernel doesn't read: "
+                                     "unpack them first (see UnpackWeight())") % layer.GetNameStr()));
+    }
+}
+
+} // namespace
+
+RefExecutor::RefExecutor(INetwork& network)
+{
+    Graph& graph = boost::polymorphic_downcast<Network*>(&network)->GetGraph();
+    if (!graph.GetMemoryPlan().IsValid())
+    {
+        PlanActivationMemory(graph);
+    }
+
+    const MemoryPlan& plan = graph.GetMemoryPlan();
+    m_ActivationMemorySize = plan.m_ArenaSize;
+    uint8_t* const arena = AllocateAligned(plan.m_ArenaSize, plan.m_Alignment, m_ActivationMemory);
+
+    // Every output slot is a tensor, which lives in the arena or in a user buffer bound at execution.
+    std::unordered_map<const OutputSlot*, unsigned int> tensorIds;
+    auto addTensor = [this](void* buffer)
+    {
+        m_Context.m_Buffers.push_back(buffer);
+        return boost::numeric_cast<unsigned int>(m_Context.m_Buffers.size() - 1);
+    };
+
+    std::size_t scratchSize = 0;
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        RefWorkloadInfo info;
+        for (auto&& inputSlot : layer->GetInputSlots())
+        {
+            const OutputSlot* const source = inputSlot.GetConnectedOutputSlot();
+            if (source == nullptr)
+            {
+                throw LayerValidationException(
+                    boost::str(boost::format("Input slot %1% of %2% layer %3% is not connected")
+                               % inputSlot.GetSlotIndex()
+                               % GetLayerTypeAsCString(layer->GetType())
+                               % layer->GetNameStr()));
+            }
+            info.m_InputTensorInfos.push_back(source->GetTensorInfo());
+            info.m_InputIds.push_back(tensorIds.at(source));
+        }
+        for (auto&& outputSlot : layer->GetOutputSlots())
+        {
+            const std::size_t offset = outputSlot.GetMemoryOffset();
+            const unsigned int tensorId = addTensor(offset != InvalidMemoryOffset ? arena + offset : nullptr);
+            tensorIds.emplace(&outputSlot, tensorId);
+            info.m_OutputTensorInfos.push_back(outputSlot.GetTensorInfo());
+            info.m_OutputIds.push_back(tensorId);
+        }
+        CheckDataTypes(*layer, info);
+
+        switch (layer->GetType())
+        {
+            case LayerType::Input:
+            {
+                const auto inputLayer = boost::polymorphic_downcast<const InputLayer*>(layer);
+                m_InputBindings.push_back({ inputLayer->GetBindingId(), info.m_OutputIds[0],
+                                            info.m_OutputTensorInfos[0].GetNumBytes() });
+                break;
+            }
+            case LayerType::Constant:
+            {
+                // Read in place: the workloads never write to their inputs.
+                const auto constantLayer = boost::polymorphic_downcast<const ConstantLayer*>(layer);
+                m_Context.m_Buffers[info.m_OutputIds[0]] =
+                    const_cast<void*>(constantLayer->m_LayerOutput.GetMemoryArea());
+                break;
+            }
+            case LayerType::Output:
+            {
+                // The first output layer reading a tensor which is not a network input (nor a constant) gets it
+                // written straight into its buffer, the others copy it.
+                const auto outputLayer = boost::polymorphic_downcast<const OutputLayer*>(layer);
+                const OutputSlot& source = *outputLayer->GetInputSlot(0).GetConnectedOutputSlot();
+                const unsigned int numBytes = info.m_InputTensorInfos[0].GetNumBytes();
+
+                const bool ownsSource = source.GetMemoryOffset() == InvalidMemoryOffset &&
+                    source.GetOwningLayer().GetType() != LayerType::Input &&
+                    source.GetOwningLayer().GetType() != LayerType::Constant &&
+                    std::find_if(source.GetConnections().begin(), source.GetConnections().end(),
+                                 [](const InputSlot* connection)
+                                 {
+                                     return connection->GetOwningLayer().GetType() == LayerType::Output;
+                                 }) == std::find(source.GetConnections().begin(), source.GetConnections().end(),
+                                                 &outputLayer->GetInputSlot(0));
+                if (ownsSource)
+                {
+                    m_OutputBindings.push_back({ outputLayer->GetBindingId(), info.m_InputIds[0], numBytes });
+                }
+                else
+                {
+                    const unsigned int destinationId = addTensor(nullptr);
+                    m_OutputBindings.push_back({ outputLayer->GetBindingId(), destinationId, numBytes });
+                    m_Workloads.emplace_back(new RefCopyWorkload(info.m_InputIds[0], destinationId, numBytes));
+                }
+                break;
+            }
+            default:
+            {
+                m_Workloads.push_back(MakeWorkload(*layer, info));
+                scratchSize = std::max(scratchSize, m_Workloads.back()->GetScratchSize());
+                break;
+            }
+        }
+
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            m_ObservedTensors.push_back({ &layer->GetOutputSlot(i), info.m_OutputIds[i], m_Workloads.size() });
+        }
+    }
+
+    m_Context.m_Scratch = AllocateAligned(scratchSize, DefaultActivationAlignment, m_ScratchMemory);
+}
+
+RefExecutor::~RefExecutor() = default;
+
+void RefExecutor::ExecuteLayer(const Layer& layer,
+                               const std::vector<const void*>& inputs,
+                               const std::vector<void*>& outputs)
+{
+    if (inputs.size() != layer.GetNumInputSlots() || outputs.size() != layer.GetNumOutputSlots())
+    {
+        throw InvalidArgumentException(
+            boost::str(boost::format("%1% layer %2% needs %3% inputs and %4% outputs")
+                       % GetLayerTypeAsCString(layer.GetType())
+                       % layer.GetNameStr()
+                       % layer.GetNumInputSlots()
+                       % layer.GetNumOutputSlots()));
+    }
+
+    // An executor without workloads, for the Float32 copies of the constants of the layer.
+    RefExecutor executor;
+    RefWorkloadInfo info;
+    for (unsigned int i = 0; i < inputs.size(); ++i)
+    {
+        const OutputSlot* const source = layer.GetInputSlot(i).GetConnectedOutputSlot();
+        if (source == nullptr)
+        {
+            throw LayerValidationException(
+                boost::str(boost::format("Input slot %1% of %2% layer %3% is not connected")
+                           % i
+                           % GetLayerTypeAsCString(layer.GetType())
+                           % layer.GetNameStr()));
+        }
+        info.m_InputTensorInfos.push_back(source->GetTensorInfo());
+        info.m_InputIds.push_back(boost::numeric_cast<unsigned int>(executor.m_Context.m_Buffers.size()));
+        executor.m_Context.m_Buffers.push_back(const_cast<void*>(inputs[i]));
+    }
+    for (unsigned int i = 0; i < outputs.size(); ++i)
+    {
+        info.m_OutputTensorInfos.push_back(layer.GetOutputSlot(i).GetTensorInfo());
+        info.m_OutputIds.push_back(boost::numeric_cast<unsigned int>(executor.m_Context.m_Buffers.size()));
+        executor.m_Context.m_Buffers.push_back(outputs[i]);
+    }
+    CheckDataTypes(layer, info);
+
+    const std::unique_ptr<RefWorkload> workload = executor.MakeWorkload(layer, info);
+    executor.m_Context.m_Scratch = AllocateAligned(workload->GetScratchSize(), DefaultActivationAlignment,
+                                                   executor.m_ScratchMemory);
+    workload->Execute(executor.m_Context);
+}
+
+const ConstTensor& RefExecutor::GetFloat32Constant(const ConstTensor& constant)
+{
+    if (constant.GetInfo().GetDataType() != DataType::Float16)
+    {
+        return constant;
+    }
+
+    m_Float32ConstantData.emplace_back(constant.GetNumElements());
+    std::vector<float>& data = m_Float32ConstantData.back();
+    armnnUtils::FloatingPointConverter::ConvertFloat16To32(constant.GetMemoryArea(), data.size(), data.data());
+
+    TensorInfo info = constant.GetInfo();
+    info.SetDataType(DataType::Float32);
+    m_Float32Constants.emplace_back(info, data.data());
+    return m_Float32Constants.back();
+}
+
+std::unique_ptr<RefWorkload> RefExecutor::MakeWorkload(const Layer& layer, const RefWorkloadInfo& info)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::ConvertFp16ToFp32:
+            return std::make_unique<RefConvertFp16ToFp32Workload>(info);
+        case LayerType::ConvertFp32ToFp16:
+            return std::make_unique<RefConvertFp32ToFp16Workload>(info);
+        default:
+            break;
+    }
+
+    // Float16 layers run their Float32 workload, with Float32 copies of their constants (see GetFloat32Constant()).
+    if (info.m_InputTensorInfos[0].GetDataType() == DataType::Float16)
+    {
+        return std::make_unique<RefFloat16Workload>(
+            info, MakeWorkload(layer, RefFloat16Workload::GetFloat32WorkloadInfo(info)));
+    }
+
+    // The layers are either entirely Float32 or entirely QuantisedAsymm8 (see CheckDataTypes()).
+    const bool isQuantized = info.m_InputTensorInfos[0].GetDataType() == DataType::QuantisedAsymm8;
+    auto throwIfQuantized = [&layer, isQuantized]()
+    {
+        if (isQuantized)
+        {
+            throw UnimplementedException(std::string("The reference backend doesn't support QuantisedAsymm8 ") +
+                                         GetLayerTypeAsCString(layer.GetType()) + " layers");
+        }
+    };
+
+    switch (layer.GetType())
+    {
+        case LayerType::Activation:
+        {
+            const auto& activationLayer = *boost::polymorphic_downcast<const ActivationLayer*>(&layer);
+            if (isQuantized)
+            {
+                return std::make_unique<RefActivationUint8Workload>(activationLayer.GetParameters(), info);
+            }
+            return std::make_unique<RefActivationWorkload>(activationLayer.GetParameters(), info);
+        }
+        case LayerType::BatchNormalization:
+        {
+            throwIfQuantized();
+            const auto& batchNormLayer = *boost::polymorphic_downcast<const BatchNormalizationLayer*>(&layer);
+            return std::make_unique<RefBatchNormalizationWorkload>(batchNormLayer.GetParameters(), info,
+                                                                   GetFloat32Constant(batchNormLayer.m_Mean),
+                                                                   GetFloat32Constant(batchNormLayer.m_Variance),
+                                                                   GetFloat32Constant(batchNormLayer.m_Beta),
+                                                                   GetFloat32Constant(batchNormLayer.m_Gamma));
+        }
+        case LayerType::Convolution2d:
+        {
+            const auto& convLayer = *boost::polymorphic_downcast<const Convolution2dLayer*>(&layer);
+            const ConstTensor& weight = GetFloat32Constant(convLayer.m_Weight);
+            const bool biasEnabled = convLayer.GetParameters().m_BiasEnabled;
+            const ConstTensor* const bias = biasEnabled ? &GetFloat32Constant(convLayer.m_Bias) : nullptr;
+            if (isQuantized)
+            {
+                CheckWeightData(layer, weight);
+                return std::make_unique<RefConvolution2dUint8Workload>(convLayer.GetParameters(), info,
+                                                                       weight, bias, GetOutputBounds(layer));
+            }
+
+            // Winograd when it applies, with the transformed weights of the network if they were computed.
+            unsigned int outputTile = ChooseWinogradOutputTile(convLayer.GetParameters(),
+                                                               info.m_InputTensorInfos[0].GetDataType(),
+                                                               weight.GetShape(),
+                                                               info.m_OutputTensorInfos[0].GetShape());
+            if (outputTile != 0)
+            {
+                const ConstTensor& transformedWeight = convLayer.m_WinogradWeight;
+                const bool hasTransformedWeight = transformedWeight.GetMemoryArea() != nullptr;
+                if (hasTransformedWeight)
+                {
+                    outputTile = GetWinogradOutputTile(transformedWeight.GetShape());
+                }
+                else
+                {
+                    CheckWeightData(layer, weight);
+                }
+                return std::make_unique<RefWinogradConvolution2dWorkload>(
+                    convLayer.GetParameters(), info, outputTile, weight,
+                    hasTransformedWeight ? &transformedWeight : nullptr, bias, GetOutputBounds(layer));
+            }
+            const ConstTensor* const packedWeight = GetPackedWeight(convLayer);
+            if (packedWeight == nullptr)
+            {
+                CheckWeightData(layer, weight);
+            }
+            return std::make_unique<RefConvolution2dWorkload>(convLayer.GetParameters(), info, weight, packedWeight,
+                                                              bias, GetOutputBounds(layer));
+        }
+        case LayerType::DepthwiseConvolution2d:
+        {
+            const auto& convLayer = *boost::polymorphic_downcast<const DepthwiseConvolution2dLayer*>(&layer);
+            const ConstTensor& weight = GetFloat32Constant(convLayer.m_Weight);
+            const bool biasEnabled = convLayer.GetParameters().m_BiasEnabled;
+            const ConstTensor* const bias = biasEnabled ? &GetFloat32Constant(convLayer.m_Bias) : nullptr;
+            if (isQuantized)
+            {
+                return std::make_unique<RefDepthwiseConvolution2dUint8Workload>(convLayer.GetParameters(), info,
+                                                                                weight, bias,
+                                                                                GetOutputBounds(layer));
+            }
+            if (RefDepthwiseConvolution2dNhwcWorkload::IsSupported(convLayer.GetParameters(), weight.GetShape()))
+            {
+                return std::make_unique<RefDepthwiseConvolution2dNhwcWorkload>(convLayer.GetParameters(), info,
+                                                                               weight, bias,
+                                                                               GetOutputBounds(layer));
+            }
+            return std::make_unique<RefDepthwiseConvolution2dWorkload>(convLayer.GetParameters(), info,
+                                                                       weight, bias,
+                                                                       GetOutputBounds(layer));
+        }
+        case LayerType::FullyConnected:
+        {
+            const auto& fcLayer = *boost::polymorphic_downcast<const FullyConnectedLayer*>(&layer);
+            const ConstTensor& weight = GetFloat32Constant(fcLayer.m_Weight);
+            const bool biasEnabled = fcLayer.GetParameters().m_BiasEnabled;
+            const ConstTensor* const bias = biasEnabled ? &GetFloat32Constant(fcLayer.m_Bias) : nullptr;
+            if (isQuantized)
+            {
+                CheckWeightData(layer, weight);
+                return std::make_unique<RefFullyConnectedUint8Workload>(fcLayer.GetParameters(), info,
+                                                                        weight, bias,
+                                                                        GetOutputBounds(layer));
+            }
+            const ConstTensor* const packedWeight = GetPackedWeight(fcLayer);
+            if (packedWeight == nullptr)
+            {
+                CheckWeightData(layer, weight);
+            }
+            return std::make_unique<RefFullyConnectedWorkload>(fcLayer.GetParameters(), info, weight, packedWeight,
+                                                               bias, GetOutputBounds(layer));
+        }
+        case LayerType::Normalization:
+        {
+            throwIfQuantized();
+            const auto& normLayer = *boost::polymorphic_downcast<const NormalizationLayer*>(&layer);
+            return std::make_unique<RefNormalizationWorkload>(normLayer.GetParameters(), info);
+        }
+        case LayerType::Permute:
+        {
+            const auto& permuteLayer = *boost::polymorphic_downcast<const PermuteLayer*>(&layer);
+            return std::make_unique<RefPermuteWorkload>(permuteLayer.GetParameters(), info);
+        }
+        case LayerType::Pooling2d:
+        {
+            const auto& poolLayer = *boost::polymorphic_downcast<const Pooling2dLayer*>(&layer);
+            if (isQuantized)
+            {
+                return std::make_unique<RefPooling2dUint8Workload>(poolLayer.GetParameters(), info);
+            }
+            return std::make_unique<RefPooling2dWorkload>(poolLayer.GetParameters(), info);
+        }
+        case LayerType::Softmax:
+        {
+            const auto& softmaxLayer = *boost::polymorphic_downcast<const SoftmaxLayer*>(&layer);
+            if (isQuantized)
+            {
+                return std::make_unique<RefSoftmaxUint8Workload>(softmaxLayer.GetParameters(), info);
+            }
+            return std::make_unique<RefSoftmaxWorkload>(softmaxLayer.GetParameters(), info);
+        }
+        default:
+        {
+            throw UnimplementedException(std::string("The reference backend doesn't support ") +
+                                         GetLayerTypeAsCString(layer.GetType()) + " layers");
+        }
+    }
+}
+
+void RefExecutor::Execute(const InputTensors& inputs, const OutputTensors& outputs, const TensorObserver& observer)
+{
+    auto bind = [this](const Binding& binding, const auto& tensors, const char* what)
+    {
+        for (auto&& tensor : tensors)
+        {
+            if (tensor.first != binding.m_Id)
+            {
+                continue;
+            }
+            if (tensor.second.GetNumBytes() != binding.m_NumBytes)
+            {
+                throw InvalidArgumentException(
+                    boost::str(boost::format("The %1% tensor bound to id %2% has %3% bytes instead of %4%")
+                               % what % binding.m_Id % tensor.second.GetNumBytes() % binding.m_NumBytes));
+            }
+            m_Context.m_Buffers[binding.m_TensorId] = const_cast<void*>(static_cast<const void*>(
+                tensor.second.GetMemoryArea()));
+            return;
+        }
+        throw InvalidArgumentException(
+            boost::str(boost::format("No %1% tensor bound to id %2%") % what % binding.m_Id));
+    };
+
+    for (const Binding& binding : m_InputBindings)
+    {
+        bind(binding, inputs, "input");
+    }
+    for (const Binding& binding : m_OutputBindings)
+    {
+        bind(binding, outputs, "output");
+    }
+
+    if (!observer)
+    {
+        for (const std::unique_ptr<RefWorkload>& workload : m_Workloads)
+        {
+            workload->Execute(m_Context);
+        }
+        return;
+    }
+
+    auto observed = m_ObservedTensors.begin();
+    for (std::size_t i = 0; i <= m_Workloads.size(); ++i)
+    {
+        if (i > 0)
+        {
+            m_Workloads[i - 1]->Execute(m_Context);
+        }
+        for (; observed != m_ObservedTensors.end() && observed->m_NumWorkloads == i; ++observed)
+        {
+            observer(*observed->m_Slot, m_Context.m_Buffers[observed->m_TensorId]);
+        }
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,117 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "workloads/RefWorkload.hpp"
+
+#include <armnn/INetwork.hpp>
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace armnn
+{
+
+class Graph;
+class Layer;
+class OutputSlot;
+
+/// Runs networks on the CPU, as a reference to check the results of other backends and to measure their cost on
+/// the machine building them. Layers are executed one after the other in the topological order of the graph.
+///
+/// Convolutions and fully connected layers are computed by a cache-blocked GEMM (vectorized with AVX2 and FMA on
+/// the x86 CPUs that support them); the other layers use straightforward loops. 3x3 stride-1 convolutions use
+/// Winograd when it applies (see ChooseWinogradOutputTile()), with the transformed weights stored in the network if
+/// PrepareWinogradConvolutions() was run on it. The other convolutions and the fully connected layers read their
+/// weights as packed by PackWeights(), when it was run on the network, rather than packing them at each execution.
+/// NHWC depthwise convolutions are vectorized across the channels.
+/// Activations fused into a layer (see FuseLayers()) are applied by its kernel as it stores the results.
+/// QuantisedAsymm8 networks (see QuantizeGraph()) run on integer kernels: convolutions and fully connected layers
+/// multiply 8-bit values into 32-bit accumulators (see QuantizedGemm()) and requantize them with the fixed-point
+/// arithmetic of the Arm Compute Library; activations and softmax use lookup tables. Batch normalization and
+/// normalization layers are only supported in Float32. Float16 layers (see ConvertToFp16()) are computed in Float32,
+/// their inputs being widened and their outputs rounded to Float16. Each layer must be entirely Float32, Float16 or
+/// QuantisedAsymm8, apart from the conversion layers.
+/// All the intermediate tensors live in a single block of memory, laid out by PlanActivationMemory(); the outputs
+/// of constant layers are read from their constant tensors.
+class RefExecutor
+{
+public:
+    /// Prepares the execution of the network. Its TensorInfos must be set (see INetwork::InferTensorInfos()) and
+    /// its memory is planned if it was not already. The network must outlive the executor: the workloads use its
+    /// constant tensors in place.
+    explicit RefExecutor(INetwork& network);
+    ~RefExecutor();
+
+    RefExecutor(const RefExecutor&) = delete;
+    RefExecutor& operator=(const RefExecutor&) = delete;
+
+    /// Called with each tensor of the network as soon as it is computed, while its memory still holds it (e.g. to
+    /// collect the ranges of the tensors for quantization, see Calibrator). The data is laid out as described by
+    /// the TensorInfo of the slot.
+    using TensorObserver = std::function<void(const OutputSlot& slot, const void* data)>;
+
+    /// Runs the network on the given inputs, writing into the given outputs. Every input and output layer must
+    /// be bound, to a tensor of its TensorInfo's size. Executions of the same executor must not overlap.
+    /// @param observer - If set, called with every tensor of the network: the inputs, then the outputs of each
+    /// layer in the order they are executed.
+    void Execute(const InputTensors& inputs,
+                 const OutputTensors& outputs,
+                 const TensorObserver& observer = TensorObserver());
+
+    /// Bytes used by the intermediate tensors.
+    std::size_t GetActivationMemorySize() const { return m_ActivationMemorySize; }
+
+    /// Runs a single layer, on tensors laid out as described by the TensorInfos of the slots it is connected to
+    /// (e.g. to compute ahead of time the layers whose inputs are constant, see FoldConstants()). The layer takes
+    /// one buffer per input slot and one per output slot, and is subject to the same restrictions as in a network.
+    static void ExecuteLayer(const Layer& layer,
+                             const std::vector<const void*>& inputs,
+                             const std::vector<void*>& outputs);
+
+private:
+    RefExecutor() = default;
+
+    struct Binding
+    {
+        LayerBindingId m_Id;
+        unsigned int   m_TensorId;
+        unsigned int   m_NumBytes;
+    };
+
+    /// A tensor passed to the observers, once the first m_NumWorkloads workloads have run.
+    struct ObservedTensor
+    {
+        const OutputSlot* m_Slot;
+        unsigned int      m_TensorId;
+        std::size_t       m_NumWorkloads;
+    };
+
+    std::unique_ptr<RefWorkload> MakeWorkload(const Layer& layer, const RefWorkloadInfo& info);
+
+    /// The constant as Float32: itself, or a Float32 copy owned by the executor if it is Float16.
+    const ConstTensor& GetFloat32Constant(const ConstTensor& constant);
+
+    std::vector<std::unique_ptr<RefWorkload>> m_Workloads;
+    std::vector<Binding> m_InputBindings;
+    std::vector<Binding> m_OutputBindings;
+    /// In the order the tensors are computed.
+    std::vector<ObservedTensor> m_ObservedTensors;
+    /// Float32 copies of the Float16 constants, for the workloads of Float16 layers (deques keep their addresses).
+    std::deque<std::vector<float>> m_Float32ConstantData;
+    std::deque<ConstTensor> m_Float32Constants;
+
+    RefExecutionContext m_Context;
+    std::unique_ptr<uint8_t[]> m_ActivationMemory;
+    std::unique_ptr<uint8_t[]> m_ScratchMemory;
+    std::size_t m_ActivationMemorySize = 0;
+};
+
+} // namespace armnn
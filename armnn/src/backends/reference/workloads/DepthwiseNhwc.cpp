@@ -0,0 +1,323 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "DepthwiseNhwc.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARMNN_DEPTHWISE_X86 1
+#include <immintrin.h>
+#endif
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Taps of the kernel which fall inside the input for an output pixel, and where they start.
+struct Window
+{
+    /// Input at the first valid tap, and weights of that tap.
+    const float* m_Input;
+    const float* m_Weights;
+    /// Number of valid taps in each direction.
+    unsigned int m_Height;
+    unsigned int m_Width;
+};
+
+/// Distance, in floats, between two rows of taps in the input (inputRowStride) and in the packed weights
+/// (weightRowStride); two taps of a row are always `channels` apart.
+struct Strides
+{
+    std::size_t m_InputRow;
+    std::size_t m_WeightRow;
+    unsigned int m_Channels;
+};
+
+/// What is done with the sums of each channel: bias added first (if not nullptr), bounds applied last.
+struct Epilogue
+{
+    const float* m_Bias;
+    OutputBounds m_Bounds;
+    bool m_Bounded;
+};
+
+/// Computes all the channels of an output pixel. KH and KW are the number of valid taps when known at compile
+/// time (the pixels away from the padding), 0 when they come from the window.
+template <unsigned int KH, unsigned int KW>
+void PixelGeneric(const Window& window, const Strides& strides, const Epilogue& epilogue, float* output)
+{
+    const float* const bias = epilogue.m_Bias;
+    const unsigned int height = KH != 0 ? KH : window.m_Height;
+    const unsigned int width  = KW != 0 ? KW : window.m_Width;
+    const unsigned int channels = strides.m_Channels;
+
+    for (unsigned int c = 0; c < channels; ++c)
+    {
+        output[c] = bias != nullptr ? bias[c] : 0.0f;
+    }
+    for (unsigned int ky = 0; ky < height; ++ky)
+    {
+        for (unsigned int kx = 0; kx < width; ++kx)
+        {
+            const float* const input   = window.m_Input + ky * strides.m_InputRow + kx * channels;
+            const float* const weights = window.m_Weights + ky * strides.m_WeightRow + kx * channels;
+            for (unsigned int c = 0; c < channels; ++c)
+            {
+                output[c] += input[c] * weights[c];
+            }
+        }
+    }
+    for (unsigned int c = 0; c < channels && epilogue.m_Bounded; ++c)
+    {
+        output[c] = epilogue.m_Bounds.Apply(output[c]);
+    }
+}
+
+#if defined(ARMNN_DEPTHWISE_X86)
+
+__attribute__((target("avx2,fma"), always_inline))
+inline void StoreAvx2(float* output, __m256 sum, const Epilogue& epilogue, __m256 min, __m256 max)
+{
+    if (epilogue.m_Bounded)
+    {
+        sum = _mm256_min_ps(_mm256_max_ps(sum, min), max);
+    }
+    _mm256_storeu_ps(output, sum);
+}
+
+/// Same as PixelGeneric(), 32 channels at a time (four independent chains of fused multiply-adds, kept in
+/// registers), then 8, the last channels going through scalar code.
+template <unsigned int KH, unsigned int KW>
+__attribute__((target("avx2,fma")))
+void PixelAvx2(const Window& window, const Strides& strides, const Epilogue& epilogue, float* output)
+{
+    const unsigned int height   = KH != 0 ? KH : window.m_Height;
+    const unsigned int width    = KW != 0 ? KW : window.m_Width;
+    const unsigned int channels = strides.m_Channels;
+    const float* const bias     = epilogue.m_Bias;
+    const __m256 min = _mm256_set1_ps(epilogue.m_Bounds.m_Min);
+    const __m256 max = _mm256_set1_ps(epilogue.m_Bounds.m_Max);
+    unsigned int c = 0;
+
+    for (; c + 32 <= channels; c += 32)
+    {
+        __m256 sum0 = bias != nullptr ? _mm256_loadu_ps(bias + c)      : _mm256_setzero_ps();
+        __m256 sum1 = bias != nullptr ? _mm256_loadu_ps(bias + c + 8)  : _mm256_setzero_ps();
+        __m256 sum2 = bias != nullptr ? _mm256_loadu_ps(bias + c + 16) : _mm256_setzero_ps();
+        __m256 sum3 = bias != nullptr ? _mm256_loadu_ps(bias + c + 24) : _mm256_setzero_ps();
+        for (unsigned int ky = 0; ky < height; ++ky)
+        {
+            const float* input   = window.m_Input + ky * strides.m_InputRow + c;
+            const float* weights = window.m_Weights + ky * strides.m_WeightRow + c;
+            for (unsigned int kx = 0; kx < width; ++kx)
+            {
+                sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(input),      _mm256_loadu_ps(weights),      sum0);
+                sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(input + 8),  _mm256_loadu_ps(weights + 8),  sum1);
+                sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(input + 16), _mm256_loadu_ps(weights + 16), sum2);
+                sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(input + 24), _mm256_loadu_ps(weights + 24), sum3);
+                input   += channels;
+                weights += channels;
+            }
+        }
+        StoreAvx2(output + c,      sum0, epilogue, min, max);
+        StoreAvx2(output + c + 8,  sum1, epilogue, min, max);
+        StoreAvx2(output + c + 16, sum2, epilogue, min, max);
+        StoreAvx2(output + c + 24, sum3, epilogue, min, max);
+    }
+
+    for (; c + 8 <= channels; c += 8)
+    {
+        __m256 sum = bias != nullptr ? _mm256_loadu_ps(bias + c) : _mm256_setzero_ps();
+        for (unsigned int ky = 0; ky < height; ++ky)
+        {
+            const float* input   = window.m_Input + ky * strides.m_InputRow + c;
+            const float* weights = window.m_Weights + ky * strides.m_WeightRow + c;
+            for (unsigned int kx = 0; kx < width; ++kx)
+            {
+                sum = _mm256_fmadd_ps(_mm256_loadu_ps(input), _mm256_loadu_ps(weights), sum);
+                input   += channels;
+                weights += channels;
+            }
+        }
+        StoreAvx2(output + c, sum, epilogue, min, max);
+    }
+
+    for (; c < channels; ++c)
+    {
+        float sum = bias != nullptr ? bias[c] : 0.0f;
+        for (unsigned int ky = 0; ky < height; ++ky)
+        {
+            for (unsigned int kx = 0; kx < width; ++kx)
+            {
+                const std::size_t offset = kx * channels + c;
+                sum += window.m_Input[ky * strides.m_InputRow + offset] *
+                       window.m_Weights[ky * strides.m_WeightRow + offset];
+            }
+        }
+        output[c] = epilogue.m_Bounded ? epilogue.m_Bounds.Apply(sum) : sum;
+    }
+}
+
+bool HasAvx2()
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+}
+
+#endif
+
+/// Range of the kernel taps [first, last) which fall inside the input for a window starting at inputStart.
+void ClipTaps(int inputStart, unsigned int kernelSize, unsigned int inputSize, unsigned int& first,
+              unsigned int& last)
+{
+    first = static_cast<unsigned int>(std::max(0, -inputStart));
+    last  = static_cast<unsigned int>(std::max(0, std::min(static_cast<int>(kernelSize),
+                                                           static_cast<int>(inputSize) - inputStart)));
+    last  = std::max(first, last);
+}
+
+/// Runs the whole convolution. K and S are the kernel size and stride when specialised, 0 to read them from the
+/// geometry. Pixel is PixelGeneric or PixelAvx2.
+template <unsigned int K, unsigned int S, template <unsigned int, unsigned int> class Pixel>
+void Convolve(const ConvolutionGeometry& g, const float* input, const float* weights, const Epilogue& epilogue,
+              float* output)
+{
+    const unsigned int kernelHeight = K != 0 ? K : g.m_KernelHeight;
+    const unsigned int kernelWidth  = K != 0 ? K : g.m_KernelWidth;
+    const unsigned int strideY      = S != 0 ? S : g.m_StrideY;
+    const unsigned int strideX      = S != 0 ? S : g.m_StrideX;
+    const unsigned int channels     = g.m_Channels;
+
+    const Strides strides = { std::size_t(g.m_InputWidth) * channels, std::size_t(kernelWidth) * channels, channels };
+
+    // Output columns whose windows are entirely inside the input horizontally.
+    const unsigned int firstInner = std::min(g.m_OutputWidth, (g.m_PadLeft + strideX - 1) / strideX);
+    const unsigned int lastInner = (g.m_InputWidth + g.m_PadLeft < kernelWidth) ? firstInner :
+        std::max(firstInner, std::min(g.m_OutputWidth, (g.m_InputWidth + g.m_PadLeft - kernelWidth) / strideX + 1));
+
+    for (unsigned int oy = 0; oy < g.m_OutputHeight; ++oy)
+    {
+        const int iy = static_cast<int>(oy * strideY) - static_cast<int>(g.m_PadTop);
+        unsigned int firstY, lastY;
+        ClipTaps(iy, kernelHeight, g.m_InputHeight, firstY, lastY);
+        const bool fullRows = firstY == 0 && lastY == kernelHeight;
+
+        float* const outputRow = output + std::size_t(oy) * g.m_OutputWidth * channels;
+
+        auto borderPixel = [&](unsigned int ox)
+        {
+            const int ix = static_cast<int>(ox * strideX) - static_cast<int>(g.m_PadLeft);
+            unsigned int firstX, lastX;
+            ClipTaps(ix, kernelWidth, g.m_InputWidth, firstX, lastX);
+
+            Window window;
+            window.m_Input   = input + (std::ptrdiff_t(iy + int(firstY)) * g.m_InputWidth + ix + int(firstX)) *
+                                       std::ptrdiff_t(channels);
+            window.m_Weights = weights + (firstY * kernelWidth + firstX) * channels;
+            window.m_Height  = lastY - firstY;
+            window.m_Width   = lastX - firstX;
+            Pixel<0, 0>::Run(window, strides, epilogue, outputRow + std::size_t(ox) * channels);
+        };
+
+        for (unsigned int ox = 0; ox < firstInner; ++ox)
+        {
+            borderPixel(ox);
+        }
+        for (unsigned int ox = firstInner; ox < lastInner; ++ox)
+        {
+            if (!fullRows)
+            {
+                borderPixel(ox);
+                continue;
+            }
+            const std::size_t ix = ox * strideX - g.m_PadLeft;
+
+            Window window;
+            window.m_Input   = input + (std::size_t(iy) * g.m_InputWidth + ix) * channels;
+            window.m_Weights = weights;
+            window.m_Height  = kernelHeight;
+            window.m_Width   = kernelWidth;
+            Pixel<K, K>::Run(window, strides, epilogue, outputRow + std::size_t(ox) * channels);
+        }
+        for (unsigned int ox = lastInner; ox < g.m_OutputWidth; ++ox)
+        {
+            borderPixel(ox);
+        }
+    }
+}
+
+template <unsigned int KH, unsigned int KW>
+struct GenericPixel
+{
+    static void Run(const Window& window, const Strides& strides, const Epilogue& epilogue, float* output)
+    {
+        PixelGeneric<KH, KW>(window, strides, epilogue, output);
+    }
+};
+
+#if defined(ARMNN_DEPTHWISE_X86)
+template <unsigned int KH, unsigned int KW>
+struct Avx2Pixel
+{
+    static void Run(const Window& window, const Strides& strides, const Epilogue& epilogue, float* output)
+    {
+        PixelAvx2<KH, KW>(window, strides, epilogue, output);
+    }
+};
+#endif
+
+using ConvolveFunction = void (*)(const ConvolutionGeometry&, const float*, const float*, const Epilogue&, float*);
+
+template <template <unsigned int, unsigned int> class Pixel>
+ConvolveFunction SelectConvolve(const ConvolutionGeometry& g)
+{
+    const bool square = g.m_KernelHeight == g.m_KernelWidth && g.m_StrideY == g.m_StrideX;
+    const unsigned int kernel = square ? g.m_KernelHeight : 0;
+    const unsigned int stride = square ? g.m_StrideY : 0;
+
+    if (kernel == 3 && stride == 1) { return &Convolve<3, 1, Pixel>; }
+    if (kernel == 3 && stride == 2) { return &Convolve<3, 2, Pixel>; }
+    if (kernel == 5 && stride == 1) { return &Convolve<5, 1, Pixel>; }
+    if (kernel == 5 && stride == 2) { return &Convolve<5, 2, Pixel>; }
+    return &Convolve<0, 0, Pixel>;
+}
+
+} // namespace
+
+void PackDepthwiseWeightsNhwc(const ConvolutionGeometry& geometry, const float* weights, float* packed)
+{
+    const unsigned int kernelArea = geometry.m_KernelHeight * geometry.m_KernelWidth;
+    for (unsigned int c = 0; c < geometry.m_Channels; ++c)
+    {
+        for (unsigned int k = 0; k < kernelArea; ++k)
+        {
+            packed[k * geometry.m_Channels + c] = weights[c * kernelArea + k];
+        }
+    }
+}
+
+void DepthwiseConvolutionNhwc(const ConvolutionGeometry& geometry,
+                              const float* input,
+                              const float* packedWeights,
+                              const float* bias,
+                              const OutputBounds& bounds,
+                              float* output)
+{
+    const Epilogue epilogue = { bias, bounds, bounds.IsBounded() };
+#if defined(ARMNN_DEPTHWISE_X86)
+    static const bool hasAvx2 = HasAvx2();
+    if (hasAvx2)
+    {
+        SelectConvolve<Avx2Pixel>(geometry)(geometry, input, packedWeights, epilogue, output);
+        return;
+    }
+#endif
+    SelectConvolve<GenericPixel>(geometry)(geometry, input, packedWeights, epilogue, output);
+}
+
+} // namespace armnn
@@ -0,0 +1,33 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Im2Col.hpp"
+#include "RefWorkloadUtils.hpp"
+
+namespace armnn
+{
+
+/// Rearranges the weights of a depthwise convolution with a depth multiplier of 1, [1, channels, height, width],
+/// as [height, width, channels] for DepthwiseConvolutionNhwc().
+void PackDepthwiseWeightsNhwc(const ConvolutionGeometry& geometry, const float* weights, float* packed);
+
+/// Depthwise convolution of an NHWC image, with a depth multiplier of 1: every channel is filtered by its own
+/// kernel, the channels being processed side by side with SIMD (AVX2 and FMA on the x86 CPUs supporting them).
+///
+/// 3x3 and 5x5 kernels with strides of 1 or 2 have their own unrolled code; other sizes and strides go through
+/// the same loops with run time bounds. For each output pixel, the taps falling in the padding are skipped by
+/// narrowing the range of taps, so the inner loop (over channels) has no branches.
+/// @param packedWeights - The weights as packed by PackDepthwiseWeightsNhwc().
+/// @param bias - One value per channel added to the output, or nullptr.
+/// @param bounds - Range the output is clamped to.
+void DepthwiseConvolutionNhwc(const ConvolutionGeometry& geometry,
+                              const float* input,
+                              const float* packedWeights,
+                              const float* bias,
+                              const OutputBounds& bounds,
+                              float* output);
+
+} // namespace armnn
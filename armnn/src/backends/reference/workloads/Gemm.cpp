@@ -0,0 +1,379 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "Gemm.hpp"
+
+#include <WeightPacking.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARMNN_GEMM_X86 1
+#include <immintrin.h>
+#endif
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Size of the tile of C computed by the kernel (rows, columns), which are also the sizes of the panels of A and B.
+constexpr unsigned int MR = GemmPanelRows;
+constexpr unsigned int NR = GemmPanelColumns;
+
+/// Blocking of the loops: a KC x NC panel of op(B) stays in the L3 cache, an MC x KC panel of op(A) in the L2
+/// cache and a KC x NR sliver of op(B) in the L1 cache while the kernel runs.
+constexpr unsigned int MC = 144;
+constexpr unsigned int KC = GemmBlockDepth;
+constexpr unsigned int NC = 3072;
+
+static_assert(MC % MR == 0 && NC % NR == 0, "Blocks must be made of whole tiles");
+
+/// Range the values of C are clamped to once complete, if m_Enabled.
+struct Clamp
+{
+    bool  m_Enabled;
+    float m_Min;
+    float m_Max;
+};
+
+/// Computes a MR x NR tile of C from kc columns of packed A (MR values per column) and kc rows of packed B
+/// (NR values per row).
+using Kernel = void (*)(unsigned int kc, const float* a, const float* b, float* c, unsigned int ldc, bool accumulate,
+                        const Clamp& clamp);
+
+void KernelGeneric(unsigned int kc, const float* a, const float* b, float* c, unsigned int ldc, bool accumulate,
+                   const Clamp& clamp)
+{
+    float tile[MR][NR] = {};
+    for (unsigned int p = 0; p < kc; ++p)
+    {
+        for (unsigned int i = 0; i < MR; ++i)
+        {
+            const float aValue = a[i];
+            for (unsigned int j = 0; j < NR; ++j)
+            {
+                tile[i][j] += aValue * b[j];
+            }
+        }
+        a += MR;
+        b += NR;
+    }
+
+    for (unsigned int i = 0; i < MR; ++i)
+    {
+        float* const row = c + i * ldc;
+        for (unsigned int j = 0; j < NR; ++j)
+        {
+            const float value = accumulate ? row[j] + tile[i][j] : tile[i][j];
+            row[j] = clamp.m_Enabled ? std::min(std::max(value, clamp.m_Min), clamp.m_Max) : value;
+        }
+    }
+}
+
+#if defined(ARMNN_GEMM_X86)
+
+__attribute__((target("avx2,fma"), always_inline))
+inline void StoreRowAvx2(float* row, __m256 low, __m256 high, bool accumulate, const Clamp& clamp)
+{
+    if (accumulate)
+    {
+        low  = _mm256_add_ps(low, _mm256_loadu_ps(row));
+        high = _mm256_add_ps(high, _mm256_loadu_ps(row + 8));
+    }
+    if (clamp.m_Enabled)
+    {
+        const __m256 min = _mm256_set1_ps(clamp.m_Min);
+        const __m256 max = _mm256_set1_ps(clamp.m_Max);
+        low  = _mm256_min_ps(_mm256_max_ps(low, min), max);
+        high = _mm256_min_ps(_mm256_max_ps(high, min), max);
+    }
+    _mm256_storeu_ps(row, low);
+    _mm256_storeu_ps(row + 8, high);
+}
+
+/// Keeps the 6x16 tile in 12 of the 16 ymm registers: each step loads two vectors of B, broadcasts the six values
+/// of A and issues twelve fused multiply-adds.
+__attribute__((target("avx2,fma")))
+void KernelAvx2(unsigned int kc, const float* a, const float* b, float* c, unsigned int ldc, bool accumulate,
+                const Clamp& clamp)
+{
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+    __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+    for (unsigned int p = 0; p < kc; ++p)
+    {
+        const __m256 b0 = _mm256_loadu_ps(b);
+        const __m256 b1 = _mm256_loadu_ps(b + 8);
+
+        __m256 aValue = _mm256_broadcast_ss(a);
+        c00 = _mm256_fmadd_ps(aValue, b0, c00);
+        c01 = _mm256_fmadd_ps(aValue, b1, c01);
+        aValue = _mm256_broadcast_ss(a + 1);
+        c10 = _mm256_fmadd_ps(aValue, b0, c10);
+        c11 = _mm256_fmadd_ps(aValue, b1, c11);
+        aValue = _mm256_broadcast_ss(a + 2);
+        c20 = _mm256_fmadd_ps(aValue, b0, c20);
+        c21 = _mm256_fmadd_ps(aValue, b1, c21);
+        aValue = _mm256_broadcast_ss(a + 3);
+        c30 = _mm256_fmadd_ps(aValue, b0, c30);
+        c31 = _mm256_fmadd_ps(aValue, b1, c31);
+        aValue = _mm256_broadcast_ss(a + 4);
+        c40 = _mm256_fmadd_ps(aValue, b0, c40);
+        c41 = _mm256_fmadd_ps(aValue, b1, c41);
+        aValue = _mm256_broadcast_ss(a + 5);
+        c50 = _mm256_fmadd_ps(aValue, b0, c50);
+        c51 = _mm256_fmadd_ps(aValue, b1, c51);
+
+        a += MR;
+        b += NR;
+    }
+
+    StoreRowAvx2(c,           c00, c01, accumulate, clamp);
+    StoreRowAvx2(c + ldc,     c10, c11, accumulate, clamp);
+    StoreRowAvx2(c + 2 * ldc, c20, c21, accumulate, clamp);
+    StoreRowAvx2(c + 3 * ldc, c30, c31, accumulate, clamp);
+    StoreRowAvx2(c + 4 * ldc, c40, c41, accumulate, clamp);
+    StoreRowAvx2(c + 5 * ldc, c50, c51, accumulate, clamp);
+}
+
+#endif
+
+Kernel SelectKernel()
+{
+#if defined(ARMNN_GEMM_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        return &KernelAvx2;
+    }
+#endif
+    return &KernelGeneric;
+}
+
+unsigned int RoundUp(unsigned int value, unsigned int multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+/// Copies the last panel of a block packed ahead of time, which holds kc values of width rows (or columns) only,
+/// into a panel padded with zeros to the size the kernel reads.
+const float* PadPanel(const float* panel, unsigned int kc, unsigned int width, unsigned int panelSize,
+                      std::vector<float>& padded)
+{
+    padded.resize(std::size_t(kc) * panelSize);
+    float* destination = padded.data();
+    for (unsigned int p = 0; p < kc; ++p)
+    {
+        std::copy(panel, panel + width, destination);
+        std::fill(destination + width, destination + panelSize, 0.0f);
+        panel += width;
+        destination += panelSize;
+    }
+    return padded.data();
+}
+
+/// Operands of a multiplication: row-major matrices, or matrices packed ahead of time when prepackedA or
+/// prepackedB is set (the matrix pointer and its leading dimension are then unused).
+struct Operands
+{
+    const float* m_A;
+    unsigned int m_Lda;
+    bool         m_TransposeA;
+    const float* m_PrepackedA;
+    const float* m_B;
+    unsigned int m_Ldb;
+    bool         m_TransposeB;
+    const float* m_PrepackedB;
+};
+
+void Multiply(unsigned int m, unsigned int n, unsigned int k,
+              const Operands& operands,
+              float* c, unsigned int ldc,
+              bool accumulate,
+              float clampMin, float clampMax)
+{
+    if (m == 0 || n == 0)
+    {
+        return;
+    }
+
+    const bool clampEnabled = clampMin > -std::numeric_limits<float>::infinity() ||
+                              clampMax < std::numeric_limits<float>::infinity();
+    if (k == 0)
+    {
+        for (unsigned int i = 0; i < m; ++i)
+        {
+            float* const row = c + i * ldc;
+            if (!accumulate)
+            {
+                std::fill(row, row + n, 0.0f);
+            }
+            for (unsigned int j = 0; j < n && clampEnabled; ++j)
+            {
+                row[j] = std::min(std::max(row[j], clampMin), clampMax);
+            }
+        }
+        return;
+    }
+
+    static const Kernel kernel = SelectKernel();
+
+    const float* const a = operands.m_A;
+    const float* const b = operands.m_B;
+    const unsigned int lda = operands.m_Lda;
+    const unsigned int ldb = operands.m_Ldb;
+    const bool transposeA = operands.m_TransposeA;
+    const bool transposeB = operands.m_TransposeB;
+
+    // The packing buffers are kept from one call to the next: convolutions call this once per layer and batch.
+    thread_local std::vector<float> packedA;
+    thread_local std::vector<float> packedB;
+    thread_local std::vector<float> paddedPanelA;
+    thread_local std::vector<float> paddedPanelB;
+    if (operands.m_PrepackedA == nullptr)
+    {
+        packedA.resize(std::size_t(MC) * KC);
+    }
+    if (operands.m_PrepackedB == nullptr)
+    {
+        packedB.resize(std::size_t(KC) * std::min(NC, RoundUp(n, NR)));
+    }
+
+    float edgeTile[MR * NR];
+
+    for (unsigned int jc = 0; jc < n; jc += NC)
+    {
+        const unsigned int nc = std::min(NC, n - jc);
+
+        for (unsigned int pc = 0; pc < k; pc += KC)
+        {
+            const unsigned int kc = std::min(KC, k - pc);
+            const bool accumulateBlock = accumulate || pc > 0;
+            // The results are only complete, and clamped, with the last block of k.
+            const Clamp clamp = { clampEnabled && pc + kc == k, clampMin, clampMax };
+            const Clamp noClamp = { false, clampMin, clampMax };
+
+            // Prepacked operands hold every block, one after the other, their last panel unpadded (see
+            // WeightPacking.hpp).
+            const float* blockB = nullptr;
+            const float* lastPanelB = nullptr;
+            if (operands.m_PrepackedB != nullptr)
+            {
+                blockB = operands.m_PrepackedB + std::size_t(pc) * n + std::size_t(jc) * kc;
+                if (nc % NR != 0)
+                {
+                    lastPanelB = PadPanel(blockB + (nc - nc % NR) * kc, kc, nc % NR, NR, paddedPanelB);
+                }
+            }
+            else
+            {
+                PackGemmPanelsB(kc, nc, transposeB ? b + jc * ldb + pc : b + pc * ldb + jc, ldb, transposeB,
+                                packedB.data());
+                blockB = packedB.data();
+            }
+
+            for (unsigned int ic = 0; ic < m; ic += MC)
+            {
+                const unsigned int mc = std::min(MC, m - ic);
+
+                const float* blockA = nullptr;
+                const float* lastPanelA = nullptr;
+                if (operands.m_PrepackedA != nullptr)
+                {
+                    blockA = operands.m_PrepackedA + std::size_t(pc) * m + std::size_t(ic) * kc;
+                    if (mc % MR != 0)
+                    {
+                        lastPanelA = PadPanel(blockA + (mc - mc % MR) * kc, kc, mc % MR, MR, paddedPanelA);
+                    }
+                }
+                else
+                {
+                    PackGemmPanelsA(mc, kc, transposeA ? a + pc * lda + ic : a + ic * lda + pc, lda, transposeA,
+                                    packedA.data());
+                    blockA = packedA.data();
+                }
+
+                for (unsigned int jr = 0; jr < nc; jr += NR)
+                {
+                    const unsigned int nr = std::min(NR, nc - jr);
+                    const float* const panelB = nr < NR && lastPanelB != nullptr ? lastPanelB : blockB + jr * kc;
+
+                    for (unsigned int ir = 0; ir < mc; ir += MR)
+                    {
+                        const unsigned int mr = std::min(MR, mc - ir);
+                        const float* const panelA = mr < MR && lastPanelA != nullptr ? lastPanelA : blockA + ir * kc;
+                        float* const tileC = c + (ic + ir) * ldc + jc + jr;
+
+                        if (mr == MR && nr == NR)
+                        {
+                            kernel(kc, panelA, panelB, tileC, ldc, accumulateBlock, clamp);
+                            continue;
+                        }
+
+                        // Partial tiles at the edges of C go through a full-size temporary.
+                        kernel(kc, panelA, panelB, edgeTile, NR, false, noClamp);
+                        for (unsigned int i = 0; i < mr; ++i)
+                        {
+                            for (unsigned int j = 0; j < nr; ++j)
+                            {
+                                float& value = tileC[i * ldc + j];
+                                value = accumulateBlock ? value + edgeTile[i * NR + j] : edgeTile[i * NR + j];
+                                if (clamp.m_Enabled)
+                                {
+                                    value = std::min(std::max(value, clampMin), clampMax);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+void Sgemm(unsigned int m, unsigned int n, unsigned int k,
+           const float* a, unsigned int lda, bool transposeA,
+           const float* b, unsigned int ldb, bool transposeB,
+           float* c, unsigned int ldc,
+           bool accumulate,
+           float clampMin, float clampMax)
+{
+    Multiply(m, n, k, { a, lda, transposeA, nullptr, b, ldb, transposeB, nullptr }, c, ldc, accumulate,
+             clampMin, clampMax);
+}
+
+void SgemmPackedA(unsigned int m, unsigned int n, unsigned int k,
+                  const float* packedA,
+                  const float* b, unsigned int ldb, bool transposeB,
+                  float* c, unsigned int ldc,
+                  bool accumulate,
+                  float clampMin, float clampMax)
+{
+    Multiply(m, n, k, { nullptr, 0, false, packedA, b, ldb, transposeB, nullptr }, c, ldc, accumulate,
+             clampMin, clampMax);
+}
+
+void SgemmPackedB(unsigned int m, unsigned int n, unsigned int k,
+                  const float* a, unsigned int lda, bool transposeA,
+                  const float* packedB,
+                  float* c, unsigned int ldc,
+                  bool accumulate,
+                  float clampMin, float clampMax)
+{
+    Multiply(m, n, k, { a, lda, transposeA, nullptr, nullptr, 0, false, packedB }, c, ldc, accumulate,
+             clampMin, clampMax);
+}
+
+} // namespace armnn
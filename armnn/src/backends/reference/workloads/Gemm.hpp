@@ -0,0 +1,53 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <limits>
+
+namespace armnn
+{
+
+/// Single precision matrix multiplication: C = op(A) * op(B), or C += op(A) * op(B) if accumulate is set.
+///
+/// op(A) is m x k and op(B) is k x n, the matrices being stored row-major with the given leading dimensions
+/// (lda, ldb, ldc: distance in elements between two consecutive rows as stored). When transposeA is set, A is
+/// stored as k x m and op(A) is its transpose (likewise for B).
+///
+/// The product is computed in cache-sized blocks: panels of op(B) and op(A) are packed so the inner kernel reads
+/// them contiguously, and the kernel keeps a 6x16 tile of C in registers. On x86 CPUs supporting AVX2 and FMA the
+/// kernel is vectorized with them, chosen at run time; other CPUs use a portable kernel.
+///
+/// The results are clamped to [clampMin, clampMax] as the kernel stores them, which applies a ReLu or BoundedReLu
+/// activation without another pass over C.
+///
+/// The panels are laid out as described in WeightPacking.hpp, which packs weights that way ahead of time for
+/// SgemmPackedA() and SgemmPackedB().
+void Sgemm(unsigned int m, unsigned int n, unsigned int k,
+           const float* a, unsigned int lda, bool transposeA,
+           const float* b, unsigned int ldb, bool transposeB,
+           float* c, unsigned int ldc,
+           bool accumulate,
+           float clampMin = -std::numeric_limits<float>::infinity(),
+           float clampMax = std::numeric_limits<float>::infinity());
+
+/// Sgemm() with op(A) packed ahead of time in the GemmA6x256 layout (see WeightPacking.hpp).
+void SgemmPackedA(unsigned int m, unsigned int n, unsigned int k,
+                  const float* packedA,
+                  const float* b, unsigned int ldb, bool transposeB,
+                  float* c, unsigned int ldc,
+                  bool accumulate,
+                  float clampMin = -std::numeric_limits<float>::infinity(),
+                  float clampMax = std::numeric_limits<float>::infinity());
+
+/// Sgemm() with op(B) packed ahead of time in the GemmB16x256 layout (see WeightPacking.hpp).
+void SgemmPackedB(unsigned int m, unsigned int n, unsigned int k,
+                  const float* a, unsigned int lda, bool transposeA,
+                  const float* packedB,
+                  float* c, unsigned int ldc,
+                  bool accumulate,
+                  float clampMin = -std::numeric_limits<float>::infinity(),
+                  float clampMax = std::numeric_limits<float>::infinity());
+
+} // namespace armnn
@@ -0,0 +1,163 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "Im2Col.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Returns the first and one past the last output coordinates whose window position, at the given kernel offset,
+/// falls inside the input (i.e. outside of the padding).
+void GetValidRange(unsigned int kernelOffset, unsigned int pad, unsigned int stride, unsigned int inputSize,
+                   unsigned int outputSize, unsigned int& first, unsigned int& last)
+{
+    // Input coordinate of output o: o * stride + kernelOffset - pad, valid when in [0, inputSize).
+    first = (kernelOffset >= pad) ? 0 : (pad - kernelOffset + stride - 1) / stride;
+    const long long limit = static_cast<long long>(inputSize) + pad - kernelOffset;
+    last = (limit <= 0) ? 0 : static_cast<unsigned int>(std::min<long long>(outputSize, (limit + stride - 1) / stride));
+    first = std::min(first, last);
+}
+
+} // namespace
+
+void Im2ColNchw(const ConvolutionGeometry& geometry, const float* input, float* columns)
+{
+    const ConvolutionGeometry& g = geometry;
+    const unsigned int outputSize = g.m_OutputHeight * g.m_OutputWidth;
+
+    for (unsigned int c = 0; c < g.m_Channels; ++c)
+    {
+        const float* const channel = input + c * g.m_InputHeight * g.m_InputWidth;
+
+        for (unsigned int ky = 0; ky < g.m_KernelHeight; ++ky)
+        {
+            unsigned int firstY, lastY;
+            GetValidRange(ky, g.m_PadTop, g.m_StrideY, g.m_InputHeight, g.m_OutputHeight, firstY, lastY);
+
+            for (unsigned int kx = 0; kx < g.m_KernelWidth; ++kx)
+            {
+                unsigned int firstX, lastX;
+                GetValidRange(kx, g.m_PadLeft, g.m_StrideX, g.m_InputWidth, g.m_OutputWidth, firstX, lastX);
+
+                float* row = columns;
+                columns += outputSize;
+
+                std::fill(row, row + firstY * g.m_OutputWidth, 0.0f);
+                for (unsigned int oy = firstY; oy < lastY; ++oy)
+                {
+                    float* const out = row + oy * g.m_OutputWidth;
+                    const float* const in = channel + (oy * g.m_StrideY + ky - g.m_PadTop) * g.m_InputWidth;
+
+                    std::fill(out, out + firstX, 0.0f);
+                    if (g.m_StrideX == 1)
+                    {
+                        std::memcpy(out + firstX, in + firstX + kx - g.m_PadLeft, (lastX - firstX) * sizeof(float));
+                    }
+                    else
+                    {
+                        for (unsigned int ox = firstX; ox < lastX; ++ox)
+                        {
+                            out[ox] = in[ox * g.m_StrideX + kx - g.m_PadLeft];
+                        }
+                    }
+                    std::fill(out + lastX, out + g.m_OutputWidth, 0.0f);
+                }
+                std::fill(row + lastY * g.m_OutputWidth, row + outputSize, 0.0f);
+            }
+        }
+    }
+}
+
+void Im2ColNhwc(const ConvolutionGeometry& geometry, const float* input, float* columns)
+{
+    const ConvolutionGeometry& g = geometry;
+    const std::size_t channelBytes = g.m_Channels * sizeof(float);
+
+    for (unsigned int oy = 0; oy < g.m_OutputHeight; ++oy)
+    {
+        for (unsigned int ox = 0; ox < g.m_OutputWidth; ++ox)
+        {
+            for (unsigned int ky = 0; ky < g.m_KernelHeight; ++ky)
+            {
+                const long long iy = static_cast<long long>(oy * g.m_StrideY + ky) - g.m_PadTop;
+                const bool isRowValid = iy >= 0 && iy < g.m_InputHeight;
+
+                for (unsigned int kx = 0; kx < g.m_KernelWidth; ++kx)
+                {
+                    const long long ix = static_cast<long long>(ox * g.m_StrideX + kx) - g.m_PadLeft;
+                    if (isRowValid && ix >= 0 && ix < g.m_InputWidth)
+                    {
+                        std::memcpy(columns, input + (iy * g.m_InputWidth + ix) * g.m_Channels, channelBytes);
+                    }
+                    else
+                    {
+                        std::fill(columns, columns + g.m_Channels, 0.0f);
+                    }
+                    columns += g.m_Channels;
+                }
+            }
+        }
+    }
+}
+
+void Im2RowUint8(const ConvolutionGeometry& geometry, DataLayout dataLayout, const uint8_t* input, uint8_t padValue,
+                 uint8_t* rows, std::size_t rowStride)
+{
+    const ConvolutionGeometry& g = geometry;
+    const unsigned int kernelArea = g.m_KernelHeight * g.m_KernelWidth;
+    const unsigned int windowSize = kernelArea * g.m_Channels;
+
+    for (unsigned int oy = 0; oy < g.m_OutputHeight; ++oy)
+    {
+        for (unsigned int ox = 0; ox < g.m_OutputWidth; ++ox)
+        {
+            uint8_t* const row = rows + (oy * g.m_OutputWidth + ox) * rowStride;
+
+            for (unsigned int ky = 0; ky < g.m_KernelHeight; ++ky)
+            {
+                const long long iy = static_cast<long long>(oy * g.m_StrideY + ky) - g.m_PadTop;
+                const bool isRowValid = iy >= 0 && iy < g.m_InputHeight;
+
+                for (unsigned int kx = 0; kx < g.m_KernelWidth; ++kx)
+                {
+                    const long long ix = static_cast<long long>(ox * g.m_StrideX + kx) - g.m_PadLeft;
+                    const bool isValid = isRowValid && ix >= 0 && ix < g.m_InputWidth;
+                    const unsigned int k = ky * g.m_KernelWidth + kx;
+
+                    if (dataLayout == DataLayout::NHWC)
+                    {
+                        // [H, W, C] windows: the channels of a position are contiguous in the input too.
+                        uint8_t* const out = row + k * g.m_Channels;
+                        if (isValid)
+                        {
+                            std::memcpy(out, input + (iy * g.m_InputWidth + ix) * g.m_Channels, g.m_Channels);
+                        }
+                        else
+                        {
+                            std::memset(out, padValue, g.m_Channels);
+                        }
+                    }
+                    else
+                    {
+                        // [C, H, W] windows.
+                        for (unsigned int c = 0; c < g.m_Channels; ++c)
+                        {
+                            row[c * kernelArea + k] = isValid ?
+                                input[(c * g.m_InputHeight + iy) * g.m_InputWidth + ix] : padValue;
+                        }
+                    }
+                }
+            }
+            std::memset(row + windowSize, 0, rowStride - windowSize);
+        }
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,51 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace armnn
+{
+
+/// Geometry of a 2D convolution over a single image.
+struct ConvolutionGeometry
+{
+    unsigned int m_Channels;
+    unsigned int m_InputHeight;
+    unsigned int m_InputWidth;
+    unsigned int m_KernelHeight;
+    unsigned int m_KernelWidth;
+    unsigned int m_StrideY;
+    unsigned int m_StrideX;
+    unsigned int m_PadTop;
+    unsigned int m_PadLeft;
+    unsigned int m_OutputHeight;
+    unsigned int m_OutputWidth;
+};
+
+/// Rearranges the windows of an NCHW image into the columns of a
+/// [channels * kernelHeight * kernelWidth, outputHeight * outputWidth] matrix, the rows being ordered like the
+/// weights of an NCHW convolution ([O, C, H, W]), so that the convolution becomes weights * columns.
+/// Padding is written as zeros.
+void Im2ColNchw(const ConvolutionGeometry& geometry, const float* input, float* columns);
+
+/// Rearranges the windows of an NHWC image into the rows of a
+/// [outputHeight * outputWidth, kernelHeight * kernelWidth * channels] matrix, the columns being ordered like the
+/// weights of an NHWC convolution ([O, H, W, C]), so that the convolution becomes columns * transpose(weights).
+/// Padding is written as zeros.
+void Im2ColNhwc(const ConvolutionGeometry& geometry, const float* input, float* columns);
+
+/// Rearranges the windows of a QuantisedAsymm8 image, in either layout, into the rows of a
+/// [outputHeight * outputWidth, kernelHeight * kernelWidth * channels] matrix, the columns being ordered like the
+/// weights of a convolution in that layout, so that each row is the window of an output position.
+/// Rows are rowStride bytes apart, the bytes after the window being zeroed. Padding is written as padValue, the
+/// quantization offset of the input, which stands for zero.
+void Im2RowUint8(const ConvolutionGeometry& geometry, DataLayout dataLayout, const uint8_t* input, uint8_t padValue,
+                 uint8_t* rows, std::size_t rowStride);
+
+} // namespace armnn
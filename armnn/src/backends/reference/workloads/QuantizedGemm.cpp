@@ -0,0 +1,299 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "QuantizedGemm.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARMNN_QUANTIZED_GEMM_X86 1
+#include <immintrin.h>
+#endif
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Rows of the tile of C computed by the kernels (the columns being QuantizedGemmPanelColumns).
+constexpr unsigned int MR = 8;
+constexpr unsigned int NR = QuantizedGemmPanelColumns;
+/// Bytes of a group of QuantizedGemmDepthStep values of k in a panel.
+constexpr unsigned int GroupSize = NR * QuantizedGemmDepthStep;
+/// Rows of A multiplied by all the panels before moving on, so that they stay in the L2 cache.
+constexpr unsigned int MC = 96;
+
+static_assert(MC % MR == 0, "Blocks must be made of whole tiles");
+
+/// Computes the MR x NR tile of the products sum(a * w) over numGroups groups of k, for the rows of A starting at
+/// rows[i] (their values as unsigned, the weights as signed).
+using Kernel = void (*)(unsigned int numGroups, const uint8_t* const* rows, const int8_t* panel, int32_t* tile);
+
+void KernelGeneric(unsigned int numGroups, const uint8_t* const* rows, const int8_t* panel, int32_t* tile)
+{
+    std::fill(tile, tile + MR * NR, 0);
+    for (unsigned int group = 0; group < numGroups; ++group)
+    {
+        const int8_t* const weights = panel + group * GroupSize;
+        for (unsigned int i = 0; i < MR; ++i)
+        {
+            const uint8_t* const a = rows[i] + group * QuantizedGemmDepthStep;
+            for (unsigned int j = 0; j < NR; ++j)
+            {
+                int32_t sum = 0;
+                for (unsigned int p = 0; p < QuantizedGemmDepthStep; ++p)
+                {
+                    sum += int32_t(a[p]) * int32_t(weights[j * QuantizedGemmDepthStep + p]);
+                }
+                tile[i * NR + j] += sum;
+            }
+        }
+    }
+}
+
+int32_t LoadGroup(const uint8_t* row, unsigned int group)
+{
+    int32_t value;
+    std::memcpy(&value, row + group * QuantizedGemmDepthStep, sizeof(value));
+    return value;
+}
+
+#if defined(ARMNN_QUANTIZED_GEMM_X86)
+
+/// acc + the sums of the products of the four unsigned bytes of a with the four signed bytes of w in each 32-bit
+/// lane, exactly. vpmaddubsw adds pairs of products into 16 bits with saturation, which 255 * -128 * 2 would
+/// reach, so a is split into its low 7 bits and its high bit: the pairs of products then fit.
+__attribute__((target("avx2"), always_inline))
+inline __m256i DotProductAvx2(__m256i acc, __m256i aLow, __m256i aHigh, __m256i w, __m256i ones)
+{
+    const __m256i low  = _mm256_madd_epi16(_mm256_maddubs_epi16(aLow, w), ones);
+    const __m256i high = _mm256_madd_epi16(_mm256_maddubs_epi16(aHigh, w), ones);
+    return _mm256_add_epi32(acc, _mm256_add_epi32(low, _mm256_slli_epi32(high, 7)));
+}
+
+/// Computes the tile four rows at a time, with eight accumulators of eight lanes.
+__attribute__((target("avx2")))
+void KernelAvx2(unsigned int numGroups, const uint8_t* const* rows, const int8_t* panel, int32_t* tile)
+{
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i lowMask = _mm256_set1_epi8(0x7F);
+    const __m256i highMask = _mm256_set1_epi8(0x01);
+
+    for (unsigned int i = 0; i < MR; i += 4)
+    {
+        __m256i c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256();
+        __m256i c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256();
+        __m256i c20 = _mm256_setzero_si256(), c21 = _mm256_setzero_si256();
+        __m256i c30 = _mm256_setzero_si256(), c31 = _mm256_setzero_si256();
+
+        for (unsigned int group = 0; group < numGroups; ++group)
+        {
+            const int8_t* const weights = panel + group * GroupSize;
+            const __m256i w0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights));
+            const __m256i w1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + 32));
+
+            __m256i a = _mm256_set1_epi32(LoadGroup(rows[i], group));
+            __m256i aLow = _mm256_and_si256(a, lowMask);
+            __m256i aHigh = _mm256_and_si256(_mm256_srli_epi16(a, 7), highMask);
+            c00 = DotProductAvx2(c00, aLow, aHigh, w0, ones);
+            c01 = DotProductAvx2(c01, aLow, aHigh, w1, ones);
+
+            a = _mm256_set1_epi32(LoadGroup(rows[i + 1], group));
+            aLow = _mm256_and_si256(a, lowMask);
+            aHigh = _mm256_and_si256(_mm256_srli_epi16(a, 7), highMask);
+            c10 = DotProductAvx2(c10, aLow, aHigh, w0, ones);
+            c11 = DotProductAvx2(c11, aLow, aHigh, w1, ones);
+
+            a = _mm256_set1_epi32(LoadGroup(rows[i + 2], group));
+            aLow = _mm256_and_si256(a, lowMask);
+            aHigh = _mm256_and_si256(_mm256_srli_epi16(a, 7), highMask);
+            c20 = DotProductAvx2(c20, aLow, aHigh, w0, ones);
+            c21 = DotProductAvx2(c21, aLow, aHigh, w1, ones);
+
+            a = _mm256_set1_epi32(LoadGroup(rows[i + 3], group));
+            aLow = _mm256_and_si256(a, lowMask);
+            aHigh = _mm256_and_si256(_mm256_srli_epi16(a, 7), highMask);
+            c30 = DotProductAvx2(c30, aLow, aHigh, w0, ones);
+            c31 = DotProductAvx2(c31, aLow, aHigh, w1, ones);
+        }
+
+        __m256i* const out = reinterpret_cast<__m256i*>(tile + i * NR);
+        _mm256_storeu_si256(out,     c00);
+        _mm256_storeu_si256(out + 1, c01);
+        _mm256_storeu_si256(out + 2, c10);
+        _mm256_storeu_si256(out + 3, c11);
+        _mm256_storeu_si256(out + 4, c20);
+        _mm256_storeu_si256(out + 5, c21);
+        _mm256_storeu_si256(out + 6, c30);
+        _mm256_storeu_si256(out + 7, c31);
+    }
+}
+
+/// A group of the panel is a single 512-bit vector, one lane per output channel: each row of the tile takes one
+/// vpdpbusd per group.
+__attribute__((target("avx512f,avx512vnni")))
+void KernelAvx512Vnni(unsigned int numGroups, const uint8_t* const* rows, const int8_t* panel, int32_t* tile)
+{
+    __m512i c0 = _mm512_setzero_si512(), c1 = _mm512_setzero_si512();
+    __m512i c2 = _mm512_setzero_si512(), c3 = _mm512_setzero_si512();
+    __m512i c4 = _mm512_setzero_si512(), c5 = _mm512_setzero_si512();
+    __m512i c6 = _mm512_setzero_si512(), c7 = _mm512_setzero_si512();
+
+    for (unsigned int group = 0; group < numGroups; ++group)
+    {
+        const __m512i w = _mm512_loadu_si512(panel + group * GroupSize);
+        c0 = _mm512_dpbusd_epi32(c0, _mm512_set1_epi32(LoadGroup(rows[0], group)), w);
+        c1 = _mm512_dpbusd_epi32(c1, _mm512_set1_epi32(LoadGroup(rows[1], group)), w);
+        c2 = _mm512_dpbusd_epi32(c2, _mm512_set1_epi32(LoadGroup(rows[2], group)), w);
+        c3 = _mm512_dpbusd_epi32(c3, _mm512_set1_epi32(LoadGroup(rows[3], group)), w);
+        c4 = _mm512_dpbusd_epi32(c4, _mm512_set1_epi32(LoadGroup(rows[4], group)), w);
+        c5 = _mm512_dpbusd_epi32(c5, _mm512_set1_epi32(LoadGroup(rows[5], group)), w);
+        c6 = _mm512_dpbusd_epi32(c6, _mm512_set1_epi32(LoadGroup(rows[6], group)), w);
+        c7 = _mm512_dpbusd_epi32(c7, _mm512_set1_epi32(LoadGroup(rows[7], group)), w);
+    }
+
+    _mm512_storeu_si512(tile,          c0);
+    _mm512_storeu_si512(tile + NR,     c1);
+    _mm512_storeu_si512(tile + 2 * NR, c2);
+    _mm512_storeu_si512(tile + 3 * NR, c3);
+    _mm512_storeu_si512(tile + 4 * NR, c4);
+    _mm512_storeu_si512(tile + 5 * NR, c5);
+    _mm512_storeu_si512(tile + 6 * NR, c6);
+    _mm512_storeu_si512(tile + 7 * NR, c7);
+}
+
+#endif
+
+Kernel SelectKernel()
+{
+#if defined(ARMNN_QUANTIZED_GEMM_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vnni"))
+    {
+        return &KernelAvx512Vnni;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return &KernelAvx2;
+    }
+#endif
+    return &KernelGeneric;
+}
+
+unsigned int RoundUp(unsigned int value, unsigned int multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+} // namespace
+
+QuantizedGemmWeights PrepareQuantizedGemmWeights(const ConstTensor& weight,
+                                                 unsigned int columns,
+                                                 unsigned int depth,
+                                                 bool isDepthContiguous,
+                                                 const ConstTensor* bias,
+                                                 int32_t inputOffset)
+{
+    BOOST_ASSERT(weight.GetInfo().GetDataType() == DataType::QuantisedAsymm8);
+    BOOST_ASSERT(weight.GetNumElements() == columns * depth);
+    const uint8_t* const values = static_cast<const uint8_t*>(weight.GetMemoryArea());
+    const int32_t* const biasValues = bias != nullptr ? static_cast<const int32_t*>(bias->GetMemoryArea()) : nullptr;
+
+    QuantizedGemmWeights prepared;
+    prepared.m_Columns = columns;
+    prepared.m_Depth = depth;
+    prepared.m_PaddedDepth = RoundUp(depth, QuantizedGemmDepthStep);
+    prepared.m_WeightOffset = weight.GetInfo().GetQuantizationOffset() - 128;
+
+    const unsigned int paddedColumns = RoundUp(columns, NR);
+    prepared.m_Panels.assign(std::size_t(paddedColumns) * prepared.m_PaddedDepth, 0);
+    prepared.m_ColumnTerms.assign(paddedColumns, 0);
+
+    for (unsigned int j = 0; j < columns; ++j)
+    {
+        int8_t* const panel = prepared.m_Panels.data() + std::size_t(j / NR) * NR * prepared.m_PaddedDepth;
+        int32_t sum = 0;
+        for (unsigned int k = 0; k < depth; ++k)
+        {
+            const uint8_t value = isDepthContiguous ? values[j * depth + k] : values[k * columns + j];
+            const int8_t signedValue = static_cast<int8_t>(int32_t(value) - 128);
+            panel[(k / QuantizedGemmDepthStep) * GroupSize + (j % NR) * QuantizedGemmDepthStep +
+                  k % QuantizedGemmDepthStep] = signedValue;
+            sum += signedValue;
+        }
+
+        // sum((a - za) * (w - zw)) = sum(a * w) - zw * sum(a) - za * sum(w) + depth * za * zw: all but the first two
+        // terms only depend on the output channel.
+        prepared.m_ColumnTerms[j] = (biasValues != nullptr ? biasValues[j] : 0) - inputOffset * sum +
+                                    int32_t(depth) * inputOffset * prepared.m_WeightOffset;
+    }
+    return prepared;
+}
+
+void QuantizedGemm(unsigned int m,
+                   const uint8_t* a, std::size_t lda,
+                   const QuantizedGemmWeights& weights,
+                   const Requantization& requantization,
+                   uint8_t* c, std::size_t rowStride, std::size_t columnStride)
+{
+    static const Kernel kernel = SelectKernel();
+
+    const unsigned int n = weights.m_Columns;
+    const unsigned int numGroups = weights.m_PaddedDepth / QuantizedGemmDepthStep;
+
+    // The row sums are the remaining term of the accumulators, scaled by the offset of the weights.
+    thread_local std::vector<int32_t> rowTerms;
+    rowTerms.resize(m);
+    for (unsigned int i = 0; i < m; ++i)
+    {
+        const uint8_t* const row = a + i * lda;
+        int32_t sum = 0;
+        for (unsigned int k = 0; k < weights.m_Depth; ++k)
+        {
+            sum += row[k];
+        }
+        rowTerms[i] = -weights.m_WeightOffset * sum;
+    }
+
+    int32_t tile[MR * NR];
+    const uint8_t* rows[MR];
+
+    for (unsigned int ic = 0; ic < m; ic += MC)
+    {
+        const unsigned int mc = std::min(MC, m - ic);
+        for (unsigned int jc = 0; jc < n; jc += NR)
+        {
+            const unsigned int nr = std::min(NR, n - jc);
+            const int8_t* const panel = weights.m_Panels.data() + std::size_t(jc) * weights.m_PaddedDepth;
+
+            for (unsigned int ir = ic; ir < ic + mc; ir += MR)
+            {
+                // The rows past the end of A repeat the last one; their results are dropped.
+                const unsigned int mr = std::min(MR, ic + mc - ir);
+                for (unsigned int i = 0; i < MR; ++i)
+                {
+                    rows[i] = a + (ir + std::min(i, mr - 1)) * lda;
+                }
+                kernel(numGroups, rows, panel, tile);
+
+                for (unsigned int i = 0; i < mr; ++i)
+                {
+                    uint8_t* const out = c + (ir + i) * rowStride + jc * columnStride;
+                    const int32_t rowTerm = rowTerms[ir + i];
+                    for (unsigned int j = 0; j < nr; ++j)
+                    {
+                        out[j * columnStride] = requantization(tile[i * NR + j] + weights.m_ColumnTerms[jc + j] +
+                                                               rowTerm);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,68 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Requantization.hpp"
+
+#include <armnn/Tensor.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace armnn
+{
+
+/// Output channels in a panel of the weights of QuantizedGemm().
+constexpr unsigned int QuantizedGemmPanelColumns = 16;
+/// Values of k the kernels of QuantizedGemm() multiply and add at once, in each 32-bit lane.
+constexpr unsigned int QuantizedGemmDepthStep = 4;
+
+/// The QuantisedAsymm8 weights of a layer, prepared for QuantizedGemm().
+///
+/// The weights are stored as signed 8-bit values (the QuantisedAsymm8 value minus 128, the offset shifting
+/// accordingly), as the kernels multiply unsigned inputs by signed weights (vpdpbusd, vpmaddubsw). They are packed
+/// in panels of QuantizedGemmPanelColumns output channels: within a panel, each group of QuantizedGemmDepthStep
+/// values of k holds the values of the first channel, then those of the second, and so on, which is the layout of
+/// the 32-bit lanes the kernels accumulate into. The last panel and the groups are padded with zeros.
+struct QuantizedGemmWeights
+{
+    unsigned int m_Columns = 0;
+    unsigned int m_Depth = 0;
+    /// m_Depth rounded up to QuantizedGemmDepthStep: the number of bytes of each row of A QuantizedGemm() reads.
+    unsigned int m_PaddedDepth = 0;
+    /// The quantization offset of the signed weights.
+    int32_t m_WeightOffset = 0;
+    std::vector<int8_t> m_Panels;
+    /// The terms of the accumulators which only depend on the output channel: the bias, and the products of the
+    /// offsets with each other and with the sums of the weights.
+    std::vector<int32_t> m_ColumnTerms;
+};
+
+/// Prepares the QuantisedAsymm8 weights of a layer for QuantizedGemm().
+/// @param weight - Weight k of output channel j is weight[j * depth + k] if isDepthContiguous (convolutions,
+/// fully connected layers with m_TransposeWeightMatrix), weight[k * columns + j] otherwise.
+/// @param bias - Signed32 bias, with the scale of the input times the scale of the weights, or nullptr.
+/// @param inputOffset - The quantization offset of the input of the layer.
+QuantizedGemmWeights PrepareQuantizedGemmWeights(const ConstTensor& weight,
+                                                 unsigned int columns,
+                                                 unsigned int depth,
+                                                 bool isDepthContiguous,
+                                                 const ConstTensor* bias,
+                                                 int32_t inputOffset);
+
+/// Multiplies the m x depth matrix A of QuantisedAsymm8 inputs by the weights and requantizes the results:
+/// C = requantization((A - inputOffset) * (W - weightOffset) + bias), computed exactly in 32-bit integers.
+/// Uses AVX512-VNNI (vpdpbusd) where the CPU supports it, otherwise AVX2 (vpmaddubsw, with the inputs split so that
+/// its 16-bit sums cannot saturate), otherwise portable code; they all give the same results.
+/// @param a - Row i starts at a + i * lda and holds weights.m_PaddedDepth bytes, zero beyond weights.m_Depth.
+/// @param c - Element (i, j) is stored at c + i * rowStride + j * columnStride.
+void QuantizedGemm(unsigned int m,
+                   const uint8_t* a, std::size_t lda,
+                   const QuantizedGemmWeights& weights,
+                   const Requantization& requantization,
+                   uint8_t* c, std::size_t rowStride, std::size_t columnStride);
+
+} // namespace armnn
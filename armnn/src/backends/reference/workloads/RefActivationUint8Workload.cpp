@@ -0,0 +1,44 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefActivationUint8Workload.hpp"
+
+#include "RefActivationWorkload.hpp"
+#include "Requantization.hpp"
+
+namespace armnn
+{
+
+RefActivationUint8Workload::RefActivationUint8Workload(const ActivationDescriptor& descriptor,
+                                                       const RefWorkloadInfo& info)
+    : RefBaseWorkload(descriptor, info)
+{
+    const TensorInfo& inputInfo  = m_Info.m_InputTensorInfos[0];
+    const TensorInfo& outputInfo = m_Info.m_OutputTensorInfos[0];
+
+    std::array<float, 256> values;
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        values[i] = DequantizeUint8(static_cast<uint8_t>(i), inputInfo);
+    }
+    ComputeActivation(m_Param, values.data(), values.data(), static_cast<unsigned int>(values.size()));
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        m_Table[i] = QuantizeUint8(values[i], outputInfo);
+    }
+}
+
+void RefActivationUint8Workload::Execute(const RefExecutionContext& context) const
+{
+    const uint8_t* const input = GetInput<uint8_t>(context, 0);
+    uint8_t* const output = GetOutput<uint8_t>(context, 0);
+    const unsigned int numElements = m_Info.m_InputTensorInfos[0].GetNumElements();
+
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        output[i] = m_Table[input[i]];
+    }
+}
+
+} // namespace armnn
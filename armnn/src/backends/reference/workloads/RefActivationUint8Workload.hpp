@@ -0,0 +1,30 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace armnn
+{
+
+/// QuantisedAsymm8 activation. Its input only takes 256 values, so the workload computes the activation of each of
+/// them once, as RefActivationWorkload does on real values, and looks the outputs up in the resulting table.
+class RefActivationUint8Workload : public RefBaseWorkload<ActivationDescriptor>
+{
+public:
+    RefActivationUint8Workload(const ActivationDescriptor& descriptor, const RefWorkloadInfo& info);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+private:
+    std::array<uint8_t, 256> m_Table;
+};
+
+} // namespace armnn
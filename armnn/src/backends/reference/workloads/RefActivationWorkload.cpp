@@ -0,0 +1,80 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefActivationWorkload.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace armnn
+{
+
+namespace
+{
+
+template <typename Function>
+void Apply(const float* input, float* output, unsigned int numElements, Function function)
+{
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        output[i] = function(input[i]);
+    }
+}
+
+} // namespace
+
+void ComputeActivation(const ActivationDescriptor& descriptor,
+                       const float* input,
+                       float* output,
+                       unsigned int numElements)
+{
+    const float a = descriptor.m_A;
+    const float b = descriptor.m_B;
+
+    switch (descriptor.m_Function)
+    {
+        case ActivationFunction::Sigmoid:
+            Apply(input, output, numElements, [](float x) { return 1.0f / (1.0f + std::exp(-x)); });
+            break;
+        case ActivationFunction::TanH:
+            Apply(input, output, numElements, [a, b](float x) { return a * std::tanh(b * x); });
+            break;
+        case ActivationFunction::Linear:
+            Apply(input, output, numElements, [a, b](float x) { return a * x + b; });
+            break;
+        case ActivationFunction::ReLu:
+            Apply(input, output, numElements, [](float x) { return std::max(0.0f, x); });
+            break;
+        case ActivationFunction::BoundedReLu:
+            Apply(input, output, numElements, [a, b](float x) { return std::min(a, std::max(b, x)); });
+            break;
+        case ActivationFunction::SoftReLu:
+            Apply(input, output, numElements, [](float x) { return std::log1p(std::exp(x)); });
+            break;
+        case ActivationFunction::LeakyReLu:
+            Apply(input, output, numElements, [a](float x) { return x > 0.0f ? x : a * x; });
+            break;
+        case ActivationFunction::Abs:
+            Apply(input, output, numElements, [](float x) { return std::fabs(x); });
+            break;
+        case ActivationFunction::Sqrt:
+            Apply(input, output, numElements, [](float x) { return std::sqrt(x); });
+            break;
+        case ActivationFunction::Square:
+            Apply(input, output, numElements, [](float x) { return x * x; });
+            break;
+        default:
+            throw InvalidArgumentException("Unsupported activation function");
+    }
+}
+
+void RefActivationWorkload::Execute(const RefExecutionContext& context) const
+{
+    ComputeActivation(m_Param, GetInput(context, 0), GetOutput(context, 0),
+                      m_Info.m_InputTensorInfos[0].GetNumElements());
+}
+
+} // namespace armnn
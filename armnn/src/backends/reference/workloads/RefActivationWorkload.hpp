@@ -0,0 +1,29 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+namespace armnn
+{
+
+/// Applies the activation to each of the numElements values of input, writing them to output.
+void ComputeActivation(const ActivationDescriptor& descriptor,
+                       const float* input,
+                       float* output,
+                       unsigned int numElements);
+
+/// Float32 activation, applied element by element.
+class RefActivationWorkload : public RefBaseWorkload<ActivationDescriptor>
+{
+public:
+    using RefBaseWorkload::RefBaseWorkload;
+
+    void Execute(const RefExecutionContext& context) const override;
+};
+
+} // namespace armnn
@@ -0,0 +1,81 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefBatchNormalizationWorkload.hpp"
+
+#include <DataLayoutIndexed.hpp>
+
+#include <cmath>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+RefBatchNormalizationWorkload::RefBatchNormalizationWorkload(const BatchNormalizationDescriptor& descriptor,
+                                                             const RefWorkloadInfo& info,
+                                                             const ConstTensor& mean,
+                                                             const ConstTensor& variance,
+                                                             const ConstTensor& beta,
+                                                             const ConstTensor& gamma)
+    : RefBaseWorkload(descriptor, info)
+{
+    const TensorShape& shape = m_Info.m_InputTensorInfos[0].GetShape();
+
+    // The channels are where the layout puts them in 4D tensors, the second dimension otherwise.
+    const unsigned int channelsIndex = shape.GetNumDimensions() == 4 ?
+        DataLayoutIndexed(m_Param.m_DataLayout).GetChannelsIndex() : 1;
+    const unsigned int channels = shape[channelsIndex];
+
+    m_Outer = 1;
+    m_Inner = 1;
+    for (unsigned int i = 0; i < shape.GetNumDimensions(); ++i)
+    {
+        if (i < channelsIndex)
+        {
+            m_Outer *= shape[i];
+        }
+        else if (i > channelsIndex)
+        {
+            m_Inner *= shape[i];
+        }
+    }
+
+    const float* const meanData     = static_cast<const float*>(mean.GetMemoryArea());
+    const float* const varianceData = static_cast<const float*>(variance.GetMemoryArea());
+    const float* const betaData     = static_cast<const float*>(beta.GetMemoryArea());
+    const float* const gammaData    = static_cast<const float*>(gamma.GetMemoryArea());
+
+    m_Scale.resize(channels);
+    m_Shift.resize(channels);
+    for (unsigned int c = 0; c < channels; ++c)
+    {
+        m_Scale[c] = gammaData[c] / std::sqrt(varianceData[c] + m_Param.m_Eps);
+        m_Shift[c] = betaData[c] - meanData[c] * m_Scale[c];
+    }
+}
+
+void RefBatchNormalizationWorkload::Execute(const RefExecutionContext& context) const
+{
+    const float* input = GetInput(context, 0);
+    float* output = GetOutput(context, 0);
+
+    const unsigned int channels = static_cast<unsigned int>(m_Scale.size());
+    for (unsigned int outer = 0; outer < m_Outer; ++outer)
+    {
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            const float scale = m_Scale[c];
+            const float shift = m_Shift[c];
+            for (unsigned int inner = 0; inner < m_Inner; ++inner)
+            {
+                output[inner] = input[inner] * scale + shift;
+            }
+            input  += m_Inner;
+            output += m_Inner;
+        }
+    }
+}
+
+} // namespace armnn
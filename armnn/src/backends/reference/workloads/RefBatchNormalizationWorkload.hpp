@@ -0,0 +1,38 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Float32 batch normalization. The mean, variance, beta and gamma are combined into a scale and a shift per
+/// channel when the workload is created, so each element costs a single multiply-add.
+class RefBatchNormalizationWorkload : public RefBaseWorkload<BatchNormalizationDescriptor>
+{
+public:
+    RefBatchNormalizationWorkload(const BatchNormalizationDescriptor& descriptor,
+                                  const RefWorkloadInfo& info,
+                                  const ConstTensor& mean,
+                                  const ConstTensor& variance,
+                                  const ConstTensor& beta,
+                                  const ConstTensor& gamma);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+private:
+    std::vector<float> m_Scale;
+    std::vector<float> m_Shift;
+    /// The input seen as [m_Outer, channels, m_Inner].
+    unsigned int m_Outer;
+    unsigned int m_Inner;
+};
+
+} // namespace armnn
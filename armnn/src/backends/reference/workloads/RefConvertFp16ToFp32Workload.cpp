@@ -0,0 +1,20 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefConvertFp16ToFp32Workload.hpp"
+
+#include <FloatingPointConverter.hpp>
+
+namespace armnn
+{
+
+void RefConvertFp16ToFp32Workload::Execute(const RefExecutionContext& context) const
+{
+    armnnUtils::FloatingPointConverter::ConvertFloat16To32(
+        context.m_Buffers[m_Info.m_InputIds[0]],
+        m_Info.m_InputTensorInfos[0].GetNumElements(),
+        static_cast<float*>(context.m_Buffers[m_Info.m_OutputIds[0]]));
+}
+
+} // namespace armnn
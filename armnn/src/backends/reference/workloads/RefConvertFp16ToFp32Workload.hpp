@@ -0,0 +1,27 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+
+namespace armnn
+{
+
+/// Conversion of a Float16 tensor to Float32 (see FloatingPointConverter).
+class RefConvertFp16ToFp32Workload : public RefWorkload
+{
+public:
+    explicit RefConvertFp16ToFp32Workload(const RefWorkloadInfo& info)
+    : m_Info(info)
+    {
+    }
+
+    void Execute(const RefExecutionContext& context) const override;
+
+private:
+    const RefWorkloadInfo m_Info;
+};
+
+} // namespace armnn
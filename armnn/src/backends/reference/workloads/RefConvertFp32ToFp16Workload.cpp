@@ -0,0 +1,20 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefConvertFp32ToFp16Workload.hpp"
+
+#include <FloatingPointConverter.hpp>
+
+namespace armnn
+{
+
+void RefConvertFp32ToFp16Workload::Execute(const RefExecutionContext& context) const
+{
+    armnnUtils::FloatingPointConverter::ConvertFloat32To16(
+        static_cast<const float*>(context.m_Buffers[m_Info.m_InputIds[0]]),
+        m_Info.m_InputTensorInfos[0].GetNumElements(),
+        context.m_Buffers[m_Info.m_OutputIds[0]]);
+}
+
+} // namespace armnn
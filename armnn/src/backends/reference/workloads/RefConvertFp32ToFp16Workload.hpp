@@ -0,0 +1,27 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+
+namespace armnn
+{
+
+/// Conversion of a Float32 tensor to Float16 (see FloatingPointConverter).
+class RefConvertFp32ToFp16Workload : public RefWorkload
+{
+public:
+    explicit RefConvertFp32ToFp16Workload(const RefWorkloadInfo& info)
+    : m_Info(info)
+    {
+    }
+
+    void Execute(const RefExecutionContext& context) const override;
+
+private:
+    const RefWorkloadInfo m_Info;
+};
+
+} // namespace armnn
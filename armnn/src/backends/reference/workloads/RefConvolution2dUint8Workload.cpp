@@ -0,0 +1,103 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefConvolution2dUint8Workload.hpp"
+
+#include <DataLayoutIndexed.hpp>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+RefConvolution2dUint8Workload::RefConvolution2dUint8Workload(const Convolution2dDescriptor& descriptor,
+                                                             const RefWorkloadInfo& info,
+                                                             const ConstTensor& weight,
+                                                             const ConstTensor* bias,
+                                                             const OutputBounds& bounds)
+    : RefBaseWorkload(descriptor, info)
+{
+    CheckQuantizedWeights(weight, bias);
+
+    const DataLayoutIndexed dataLayout(m_Param.m_DataLayout);
+    const TensorInfo& inputInfo  = m_Info.m_InputTensorInfos[0];
+    const TensorInfo& outputInfo = m_Info.m_OutputTensorInfos[0];
+    const TensorShape& inputShape  = inputInfo.GetShape();
+    const TensorShape& outputShape = outputInfo.GetShape();
+    const TensorShape& weightShape = weight.GetShape();
+
+    m_BatchSize      = inputShape[0];
+    m_OutputChannels = outputShape[dataLayout.GetChannelsIndex()];
+    m_InputOffset    = static_cast<uint8_t>(inputInfo.GetQuantizationOffset());
+
+    m_Geometry.m_Channels     = inputShape[dataLayout.GetChannelsIndex()];
+    m_Geometry.m_InputHeight  = inputShape[dataLayout.GetHeightIndex()];
+    m_Geometry.m_InputWidth   = inputShape[dataLayout.GetWidthIndex()];
+    m_Geometry.m_KernelHeight = weightShape[dataLayout.GetHeightIndex()];
+    m_Geometry.m_KernelWidth  = weightShape[dataLayout.GetWidthIndex()];
+    m_Geometry.m_StrideY      = m_Param.m_StrideY;
+    m_Geometry.m_StrideX      = m_Param.m_StrideX;
+    m_Geometry.m_PadTop       = m_Param.m_PadTop;
+    m_Geometry.m_PadLeft      = m_Param.m_PadLeft;
+    m_Geometry.m_OutputHeight = outputShape[dataLayout.GetHeightIndex()];
+    m_Geometry.m_OutputWidth  = outputShape[dataLayout.GetWidthIndex()];
+
+    // The weights of an output channel are contiguous, in the order Im2RowUint8() lays out the windows.
+    const unsigned int kernelSize = m_Geometry.m_Channels * m_Geometry.m_KernelHeight * m_Geometry.m_KernelWidth;
+    m_Weights = PrepareQuantizedGemmWeights(weight, m_OutputChannels, kernelSize, true, bias,
+                                            inputInfo.GetQuantizationOffset());
+
+    const std::pair<int32_t, int32_t> outputBounds = GetQuantizedBounds(bounds, outputInfo);
+    m_Requantization = Requantization(double(inputInfo.GetQuantizationScale()) *
+                                      double(weight.GetInfo().GetQuantizationScale()) /
+                                      double(outputInfo.GetQuantizationScale()),
+                                      outputInfo.GetQuantizationOffset(), outputBounds.first, outputBounds.second);
+
+    m_NeedsIm2Row = !(m_Param.m_DataLayout == DataLayout::NHWC &&
+                      m_Geometry.m_KernelHeight == 1 && m_Geometry.m_KernelWidth == 1 &&
+                      m_Param.m_StrideX == 1 && m_Param.m_StrideY == 1 &&
+                      m_Param.m_PadLeft == 0 && m_Param.m_PadRight == 0 &&
+                      m_Param.m_PadTop == 0 && m_Param.m_PadBottom == 0 &&
+                      m_Geometry.m_Channels % QuantizedGemmDepthStep == 0);
+}
+
+std::size_t RefConvolution2dUint8Workload::GetScratchSize() const
+{
+    if (!m_NeedsIm2Row)
+    {
+        return 0;
+    }
+    return std::size_t(m_Geometry.m_OutputHeight) * m_Geometry.m_OutputWidth * m_Weights.m_PaddedDepth;
+}
+
+void RefConvolution2dUint8Workload::Execute(const RefExecutionContext& context) const
+{
+    const uint8_t* const input = GetInput<uint8_t>(context, 0);
+    uint8_t* const output = GetOutput<uint8_t>(context, 0);
+    uint8_t* const rows = static_cast<uint8_t*>(context.m_Scratch);
+
+    const ConvolutionGeometry& g = m_Geometry;
+    const unsigned int inputSize  = g.m_Channels * g.m_InputHeight * g.m_InputWidth;
+    const unsigned int outputArea = g.m_OutputHeight * g.m_OutputWidth;
+    const bool isNhwc = m_Param.m_DataLayout == DataLayout::NHWC;
+
+    for (unsigned int b = 0; b < m_BatchSize; ++b)
+    {
+        const uint8_t* const image = input + b * inputSize;
+        uint8_t* const result = output + b * m_OutputChannels * outputArea;
+
+        if (m_NeedsIm2Row)
+        {
+            Im2RowUint8(g, m_Param.m_DataLayout, image, m_InputOffset, rows, m_Weights.m_PaddedDepth);
+        }
+
+        // [outputArea, kernelSize] * transpose([outputChannels, kernelSize]), stored transposed for NCHW.
+        QuantizedGemm(outputArea,
+                      m_NeedsIm2Row ? rows : image, m_NeedsIm2Row ? m_Weights.m_PaddedDepth : g.m_Channels,
+                      m_Weights, m_Requantization,
+                      result, isNhwc ? m_OutputChannels : 1, isNhwc ? 1 : outputArea);
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,49 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Im2Col.hpp"
+#include "QuantizedGemm.hpp"
+#include "RefWorkload.hpp"
+#include "RefWorkloadUtils.hpp"
+#include "Requantization.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+namespace armnn
+{
+
+/// QuantisedAsymm8 convolution, lowered to a matrix multiplication like its Float32 counterpart: the input windows
+/// are rearranged into rows (see Im2RowUint8()) and multiplied with the weights by QuantizedGemm(), which
+/// requantizes the int32 accumulators to the output. NHWC 1x1 convolutions with unit strides and no padding use the
+/// input as is when the number of channels is a multiple of QuantizedGemmDepthStep.
+class RefConvolution2dUint8Workload : public RefBaseWorkload<Convolution2dDescriptor>
+{
+public:
+    /// @param weight - QuantisedAsymm8 weights.
+    /// @param bias - Signed32 bias, with the scale of the input times the scale of the weights. May be nullptr when
+    /// the bias is disabled.
+    /// @param bounds - Range the output is clamped to, for the activation fused into the layer.
+    RefConvolution2dUint8Workload(const Convolution2dDescriptor& descriptor,
+                                  const RefWorkloadInfo& info,
+                                  const ConstTensor& weight,
+                                  const ConstTensor* bias,
+                                  const OutputBounds& bounds);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+    std::size_t GetScratchSize() const override;
+
+private:
+    QuantizedGemmWeights m_Weights;
+    Requantization m_Requantization;
+    ConvolutionGeometry m_Geometry;
+    unsigned int m_BatchSize;
+    unsigned int m_OutputChannels;
+    uint8_t m_InputOffset;
+    bool m_NeedsIm2Row;
+};
+
+} // namespace armnn
@@ -0,0 +1,136 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefConvolution2dWorkload.hpp"
+
+#include "Gemm.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include <DataLayoutIndexed.hpp>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+RefConvolution2dWorkload::RefConvolution2dWorkload(const Convolution2dDescriptor& descriptor,
+                                                   const RefWorkloadInfo& info,
+                                                   const ConstTensor& weight,
+                                                   const ConstTensor* packedWeight,
+                                                   const ConstTensor* bias,
+                                                   const OutputBounds& bounds)
+    : RefBaseWorkload(descriptor, info)
+    , m_Weight(static_cast<const float*>(weight.GetMemoryArea()))
+    , m_PackedWeight(packedWeight != nullptr ? static_cast<const float*>(packedWeight->GetMemoryArea()) : nullptr)
+    , m_Bias(bias != nullptr ? static_cast<const float*>(bias->GetMemoryArea()) : nullptr)
+    , m_Bounds(bounds)
+{
+    const DataLayoutIndexed dataLayout(m_Param.m_DataLayout);
+    const TensorShape& inputShape  = m_Info.m_InputTensorInfos[0].GetShape();
+    const TensorShape& outputShape = m_Info.m_OutputTensorInfos[0].GetShape();
+    const TensorShape& weightShape = weight.GetShape();
+
+    m_BatchSize      = inputShape[0];
+    m_OutputChannels = outputShape[dataLayout.GetChannelsIndex()];
+
+    m_Geometry.m_Channels     = inputShape[dataLayout.GetChannelsIndex()];
+    m_Geometry.m_InputHeight  = inputShape[dataLayout.GetHeightIndex()];
+    m_Geometry.m_InputWidth   = inputShape[dataLayout.GetWidthIndex()];
+    m_Geometry.m_KernelHeight = weightShape[dataLayout.GetHeightIndex()];
+    m_Geometry.m_KernelWidth  = weightShape[dataLayout.GetWidthIndex()];
+    m_Geometry.m_StrideY      = m_Param.m_StrideY;
+    m_Geometry.m_StrideX      = m_Param.m_StrideX;
+    m_Geometry.m_PadTop       = m_Param.m_PadTop;
+    m_Geometry.m_PadLeft      = m_Param.m_PadLeft;
+    m_Geometry.m_OutputHeight = outputShape[dataLayout.GetHeightIndex()];
+    m_Geometry.m_OutputWidth  = outputShape[dataLayout.GetWidthIndex()];
+
+    m_NeedsIm2Col = !(m_Geometry.m_KernelHeight == 1 && m_Geometry.m_KernelWidth == 1 &&
+                      m_Param.m_StrideX == 1 && m_Param.m_StrideY == 1 &&
+                      m_Param.m_PadLeft == 0 && m_Param.m_PadRight == 0 &&
+                      m_Param.m_PadTop == 0 && m_Param.m_PadBottom == 0);
+}
+
+std::size_t RefConvolution2dWorkload::GetScratchSize() const
+{
+    if (!m_NeedsIm2Col)
+    {
+        return 0;
+    }
+    return sizeof(float) * m_Geometry.m_Channels * m_Geometry.m_KernelHeight * m_Geometry.m_KernelWidth *
+           m_Geometry.m_OutputHeight * m_Geometry.m_OutputWidth;
+}
+
+void RefConvolution2dWorkload::Execute(const RefExecutionContext& context) const
+{
+    const float* const input = GetInput(context, 0);
+    float* const output = GetOutput(context, 0);
+    float* const columns = static_cast<float*>(context.m_Scratch);
+
+    const ConvolutionGeometry& g = m_Geometry;
+    const unsigned int inputSize  = g.m_Channels * g.m_InputHeight * g.m_InputWidth;
+    const unsigned int outputArea = g.m_OutputHeight * g.m_OutputWidth;
+    const unsigned int kernelSize = g.m_Channels * g.m_KernelHeight * g.m_KernelWidth;
+
+    for (unsigned int b = 0; b < m_BatchSize; ++b)
+    {
+        const float* const image = input + b * inputSize;
+        float* const result = output + b * m_OutputChannels * outputArea;
+
+        if (m_Param.m_DataLayout == DataLayout::NHWC)
+        {
+            // [outputArea, kernelSize] * transpose([outputChannels, kernelSize]).
+            if (m_NeedsIm2Col)
+            {
+                Im2ColNhwc(g, image, columns);
+            }
+            InitialiseWithBias(result, outputArea, m_OutputChannels, m_Bias, false);
+            const float* const lhs = m_NeedsIm2Col ? columns : image;
+            if (m_PackedWeight != nullptr)
+            {
+                SgemmPackedB(outputArea, m_OutputChannels, kernelSize,
+                             lhs, kernelSize, false,
+                             m_PackedWeight,
+                             result, m_OutputChannels,
+                             true, m_Bounds.m_Min, m_Bounds.m_Max);
+            }
+            else
+            {
+                Sgemm(outputArea, m_OutputChannels, kernelSize,
+                      lhs, kernelSize, false,
+                      m_Weight, kernelSize, true,
+                      result, m_OutputChannels,
+                      true, m_Bounds.m_Min, m_Bounds.m_Max);
+            }
+        }
+        else
+        {
+            // [outputChannels, kernelSize] * [kernelSize, outputArea].
+            if (m_NeedsIm2Col)
+            {
+                Im2ColNchw(g, image, columns);
+            }
+            InitialiseWithBias(result, m_OutputChannels, outputArea, m_Bias, true);
+            const float* const rhs = m_NeedsIm2Col ? columns : image;
+            if (m_PackedWeight != nullptr)
+            {
+                SgemmPackedA(m_OutputChannels, outputArea, kernelSize,
+                             m_PackedWeight,
+                             rhs, outputArea, false,
+                             result, outputArea,
+                             true, m_Bounds.m_Min, m_Bounds.m_Max);
+            }
+            else
+            {
+                Sgemm(m_OutputChannels, outputArea, kernelSize,
+                      m_Weight, kernelSize, false,
+                      rhs, outputArea, false,
+                      result, outputArea,
+                      true, m_Bounds.m_Min, m_Bounds.m_Max);
+            }
+        }
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,48 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Im2Col.hpp"
+#include "RefWorkload.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+namespace armnn
+{
+
+/// Float32 convolution, lowered to a matrix multiplication: the input windows are rearranged by im2col and
+/// multiplied with the weights by Sgemm(). 1x1 convolutions with unit strides and no padding use the input as is.
+/// Weights packed ahead of time are read as they are (see PackWeights()).
+class RefConvolution2dWorkload : public RefBaseWorkload<Convolution2dDescriptor>
+{
+public:
+    /// @param packedWeight - The weights packed in the layout ChoosePackedWeightLayout() returns for the layer, or
+    /// nullptr to pack them at each execution.
+    /// @param bias - May be nullptr when the bias is disabled.
+    /// @param bounds - Range the output is clamped to, for the activation fused into the layer.
+    RefConvolution2dWorkload(const Convolution2dDescriptor& descriptor,
+                             const RefWorkloadInfo& info,
+                             const ConstTensor& weight,
+                             const ConstTensor* packedWeight,
+                             const ConstTensor* bias,
+                             const OutputBounds& bounds);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+    std::size_t GetScratchSize() const override;
+
+private:
+    const float* m_Weight;
+    const float* m_PackedWeight;
+    const float* m_Bias;
+    const OutputBounds m_Bounds;
+    ConvolutionGeometry m_Geometry;
+    unsigned int m_BatchSize;
+    unsigned int m_OutputChannels;
+    bool m_NeedsIm2Col;
+};
+
+} // namespace armnn
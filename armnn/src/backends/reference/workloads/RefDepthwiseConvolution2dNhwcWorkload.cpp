@@ -0,0 +1,71 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefDepthwiseConvolution2dNhwcWorkload.hpp"
+
+#include "DepthwiseNhwc.hpp"
+
+#include <boost/assert.hpp>
+
+namespace armnn
+{
+
+RefDepthwiseConvolution2dNhwcWorkload::RefDepthwiseConvolution2dNhwcWorkload(
+    const DepthwiseConvolution2dDescriptor& descriptor,
+    const RefWorkloadInfo& info,
+    const ConstTensor& weight,
+    const ConstTensor* bias,
+    const OutputBounds& bounds)
+    : RefBaseWorkload(descriptor, info)
+    , m_Bias(bias != nullptr ? static_cast<const float*>(bias->GetMemoryArea()) : nullptr)
+    , m_Bounds(bounds)
+{
+    BOOST_ASSERT(IsSupported(descriptor, weight.GetShape()));
+
+    // NHWC tensors, weights [1, C, H, W].
+    const TensorShape& inputShape  = m_Info.m_InputTensorInfos[0].GetShape();
+    const TensorShape& outputShape = m_Info.m_OutputTensorInfos[0].GetShape();
+    const TensorShape& weightShape = weight.GetShape();
+
+    m_BatchSize = inputShape[0];
+
+    m_Geometry.m_Channels     = inputShape[3];
+    m_Geometry.m_InputHeight  = inputShape[1];
+    m_Geometry.m_InputWidth   = inputShape[2];
+    m_Geometry.m_KernelHeight = weightShape[2];
+    m_Geometry.m_KernelWidth  = weightShape[3];
+    m_Geometry.m_StrideY      = m_Param.m_StrideY;
+    m_Geometry.m_StrideX      = m_Param.m_StrideX;
+    m_Geometry.m_PadTop       = m_Param.m_PadTop;
+    m_Geometry.m_PadLeft      = m_Param.m_PadLeft;
+    m_Geometry.m_OutputHeight = outputShape[1];
+    m_Geometry.m_OutputWidth  = outputShape[2];
+
+    m_PackedWeight.resize(weight.GetNumElements());
+    PackDepthwiseWeightsNhwc(m_Geometry, static_cast<const float*>(weight.GetMemoryArea()), m_PackedWeight.data());
+}
+
+bool RefDepthwiseConvolution2dNhwcWorkload::IsSupported(const DepthwiseConvolution2dDescriptor& descriptor,
+                                                        const TensorShape& weightShape)
+{
+    return descriptor.m_DataLayout == DataLayout::NHWC && weightShape[0] == 1;
+}
+
+void RefDepthwiseConvolution2dNhwcWorkload::Execute(const RefExecutionContext& context) const
+{
+    const float* const input = GetInput(context, 0);
+    float* const output = GetOutput(context, 0);
+
+    const ConvolutionGeometry& g = m_Geometry;
+    const std::size_t inputSize  = std::size_t(g.m_InputHeight) * g.m_InputWidth * g.m_Channels;
+    const std::size_t outputSize = std::size_t(g.m_OutputHeight) * g.m_OutputWidth * g.m_Channels;
+
+    for (unsigned int b = 0; b < m_BatchSize; ++b)
+    {
+        DepthwiseConvolutionNhwc(g, input + b * inputSize, m_PackedWeight.data(), m_Bias, m_Bounds,
+                                 output + b * outputSize);
+    }
+}
+
+} // namespace armnn
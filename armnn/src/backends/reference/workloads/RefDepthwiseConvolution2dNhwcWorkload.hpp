@@ -0,0 +1,44 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Im2Col.hpp"
+#include "RefWorkload.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Float32 NHWC depthwise convolution with a depth multiplier of 1, vectorized across the channels (see
+/// DepthwiseConvolutionNhwc()). The weights are rearranged channel-innermost when the workload is created.
+class RefDepthwiseConvolution2dNhwcWorkload : public RefBaseWorkload<DepthwiseConvolution2dDescriptor>
+{
+public:
+    /// @param bias - May be nullptr when the bias is disabled.
+    /// @param bounds - Range the output is clamped to, for the activation fused into the layer.
+    RefDepthwiseConvolution2dNhwcWorkload(const DepthwiseConvolution2dDescriptor& descriptor,
+                                          const RefWorkloadInfo& info,
+                                          const ConstTensor& weight,
+                                          const ConstTensor* bias,
+                                          const OutputBounds& bounds);
+
+    /// Whether the workload can run a depthwise convolution with the given descriptor and weights.
+    static bool IsSupported(const DepthwiseConvolution2dDescriptor& descriptor, const TensorShape& weightShape);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+private:
+    std::vector<float> m_PackedWeight;
+    const float* m_Bias;
+    const OutputBounds m_Bounds;
+    ConvolutionGeometry m_Geometry;
+    unsigned int m_BatchSize;
+};
+
+} // namespace armnn
@@ -0,0 +1,112 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefDepthwiseConvolution2dUint8Workload.hpp"
+
+#include <DataLayoutIndexed.hpp>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+RefDepthwiseConvolution2dUint8Workload::RefDepthwiseConvolution2dUint8Workload(
+    const DepthwiseConvolution2dDescriptor& descriptor,
+    const RefWorkloadInfo& info,
+    const ConstTensor& weight,
+    const ConstTensor* bias,
+    const OutputBounds& bounds)
+    : RefBaseWorkload(descriptor, info)
+    , m_Weight(static_cast<const uint8_t*>(weight.GetMemoryArea()))
+    , m_Bias(bias != nullptr ? static_cast<const int32_t*>(bias->GetMemoryArea()) : nullptr)
+    , m_InputOffset(info.m_InputTensorInfos[0].GetQuantizationOffset())
+    , m_WeightOffset(weight.GetInfo().GetQuantizationOffset())
+    , m_DepthMultiplier(weight.GetShape()[0])
+    , m_KernelHeight(weight.GetShape()[2])
+    , m_KernelWidth(weight.GetShape()[3])
+{
+    CheckQuantizedWeights(weight, bias);
+
+    const TensorInfo& inputInfo  = m_Info.m_InputTensorInfos[0];
+    const TensorInfo& outputInfo = m_Info.m_OutputTensorInfos[0];
+    const std::pair<int32_t, int32_t> outputBounds = GetQuantizedBounds(bounds, outputInfo);
+    m_Requantization = Requantization(double(inputInfo.GetQuantizationScale()) *
+                                      double(weight.GetInfo().GetQuantizationScale()) /
+                                      double(outputInfo.GetQuantizationScale()),
+                                      outputInfo.GetQuantizationOffset(), outputBounds.first, outputBounds.second);
+}
+
+void RefDepthwiseConvolution2dUint8Workload::Execute(const RefExecutionContext& context) const
+{
+    const uint8_t* const input = GetInput<uint8_t>(context, 0);
+    uint8_t* const output = GetOutput<uint8_t>(context, 0);
+
+    const DataLayoutIndexed dataLayout(m_Param.m_DataLayout);
+    const TensorShape& inputShape  = m_Info.m_InputTensorInfos[0].GetShape();
+    const TensorShape& outputShape = m_Info.m_OutputTensorInfos[0].GetShape();
+
+    const unsigned int batchSize      = inputShape[0];
+    const unsigned int channels       = inputShape[dataLayout.GetChannelsIndex()];
+    const unsigned int inputHeight    = inputShape[dataLayout.GetHeightIndex()];
+    const unsigned int inputWidth     = inputShape[dataLayout.GetWidthIndex()];
+    const unsigned int outputChannels = outputShape[dataLayout.GetChannelsIndex()];
+    const unsigned int outputHeight   = outputShape[dataLayout.GetHeightIndex()];
+    const unsigned int outputWidth    = outputShape[dataLayout.GetWidthIndex()];
+
+    const bool isNhwc = m_Param.m_DataLayout == DataLayout::NHWC;
+    auto index = [isNhwc](unsigned int b, unsigned int c, unsigned int y, unsigned int x,
+                          unsigned int numChannels, unsigned int height, unsigned int width)
+    {
+        return isNhwc ? ((b * height + y) * width + x) * numChannels + c
+                      : ((b * numChannels + c) * height + y) * width + x;
+    };
+
+    for (unsigned int b = 0; b < batchSize; ++b)
+    {
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            for (unsigned int m = 0; m < m_DepthMultiplier; ++m)
+            {
+                const unsigned int outputChannel = c * m_DepthMultiplier + m;
+                const uint8_t* const filter = m_Weight + (m * channels + c) * m_KernelHeight * m_KernelWidth;
+
+                for (unsigned int oy = 0; oy < outputHeight; ++oy)
+                {
+                    for (unsigned int ox = 0; ox < outputWidth; ++ox)
+                    {
+                        // The padding stands for zeros, the input offset: it adds nothing.
+                        int32_t sum = (m_Bias != nullptr) ? m_Bias[outputChannel] : 0;
+                        for (unsigned int ky = 0; ky < m_KernelHeight; ++ky)
+                        {
+                            const int iy = static_cast<int>(oy * m_Param.m_StrideY + ky) -
+                                           static_cast<int>(m_Param.m_PadTop);
+                            if (iy < 0 || iy >= static_cast<int>(inputHeight))
+                            {
+                                continue;
+                            }
+                            for (unsigned int kx = 0; kx < m_KernelWidth; ++kx)
+                            {
+                                const int ix = static_cast<int>(ox * m_Param.m_StrideX + kx) -
+                                               static_cast<int>(m_Param.m_PadLeft);
+                                if (ix < 0 || ix >= static_cast<int>(inputWidth))
+                                {
+                                    continue;
+                                }
+                                const int32_t value = input[index(b, c, static_cast<unsigned int>(iy),
+                                                                  static_cast<unsigned int>(ix),
+                                                                  channels, inputHeight, inputWidth)];
+                                sum += (int32_t(filter[ky * m_KernelWidth + kx]) - m_WeightOffset) *
+                                       (value - m_InputOffset);
+                            }
+                        }
+                        output[index(b, outputChannel, oy, ox, outputChannels, outputHeight, outputWidth)] =
+                            m_Requantization(sum);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace armnn
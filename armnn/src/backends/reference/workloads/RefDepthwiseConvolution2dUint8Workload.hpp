@@ -0,0 +1,46 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+#include "RefWorkloadUtils.hpp"
+#include "Requantization.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+#include <cstdint>
+
+namespace armnn
+{
+
+/// QuantisedAsymm8 depthwise convolution, accumulating the products of the inputs and weights minus their offsets in
+/// int32 before requantizing them. The weights are laid out as for RefDepthwiseConvolution2dWorkload.
+class RefDepthwiseConvolution2dUint8Workload : public RefBaseWorkload<DepthwiseConvolution2dDescriptor>
+{
+public:
+    /// @param weight - QuantisedAsymm8 weights.
+    /// @param bias - Signed32 bias, with the scale of the input times the scale of the weights. May be nullptr when
+    /// the bias is disabled.
+    /// @param bounds - Range the output is clamped to, for the activation fused into the layer.
+    RefDepthwiseConvolution2dUint8Workload(const DepthwiseConvolution2dDescriptor& descriptor,
+                                           const RefWorkloadInfo& info,
+                                           const ConstTensor& weight,
+                                           const ConstTensor* bias,
+                                           const OutputBounds& bounds);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+private:
+    const uint8_t* m_Weight;
+    const int32_t* m_Bias;
+    Requantization m_Requantization;
+    int32_t m_InputOffset;
+    int32_t m_WeightOffset;
+    unsigned int m_DepthMultiplier;
+    unsigned int m_KernelHeight;
+    unsigned int m_KernelWidth;
+};
+
+} // namespace armnn
@@ -0,0 +1,99 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefDepthwiseConvolution2dWorkload.hpp"
+
+#include <DataLayoutIndexed.hpp>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+RefDepthwiseConvolution2dWorkload::RefDepthwiseConvolution2dWorkload(
+    const DepthwiseConvolution2dDescriptor& descriptor,
+    const RefWorkloadInfo& info,
+    const ConstTensor& weight,
+    const ConstTensor* bias,
+    const OutputBounds& bounds)
+    : RefBaseWorkload(descriptor, info)
+    , m_Weight(static_cast<const float*>(weight.GetMemoryArea()))
+    , m_Bias(bias != nullptr ? static_cast<const float*>(bias->GetMemoryArea()) : nullptr)
+    , m_Bounds(bounds)
+    , m_DepthMultiplier(weight.GetShape()[0])
+    , m_KernelHeight(weight.GetShape()[2])
+    , m_KernelWidth(weight.GetShape()[3])
+{
+}
+
+void RefDepthwiseConvolution2dWorkload::Execute(const RefExecutionContext& context) const
+{
+    const float* const input = GetInput(context, 0);
+    float* const output = GetOutput(context, 0);
+
+    const DataLayoutIndexed dataLayout(m_Param.m_DataLayout);
+    const TensorShape& inputShape  = m_Info.m_InputTensorInfos[0].GetShape();
+    const TensorShape& outputShape = m_Info.m_OutputTensorInfos[0].GetShape();
+
+    const unsigned int batchSize      = inputShape[0];
+    const unsigned int channels       = inputShape[dataLayout.GetChannelsIndex()];
+    const unsigned int inputHeight    = inputShape[dataLayout.GetHeightIndex()];
+    const unsigned int inputWidth     = inputShape[dataLayout.GetWidthIndex()];
+    const unsigned int outputChannels = outputShape[dataLayout.GetChannelsIndex()];
+    const unsigned int outputHeight   = outputShape[dataLayout.GetHeightIndex()];
+    const unsigned int outputWidth    = outputShape[dataLayout.GetWidthIndex()];
+
+    const bool isNhwc = m_Param.m_DataLayout == DataLayout::NHWC;
+    auto index = [isNhwc](unsigned int b, unsigned int c, unsigned int y, unsigned int x,
+                          unsigned int numChannels, unsigned int height, unsigned int width)
+    {
+        return isNhwc ? ((b * height + y) * width + x) * numChannels + c
+                      : ((b * numChannels + c) * height + y) * width + x;
+    };
+
+    for (unsigned int b = 0; b < batchSize; ++b)
+    {
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            for (unsigned int m = 0; m < m_DepthMultiplier; ++m)
+            {
+                const unsigned int outputChannel = c * m_DepthMultiplier + m;
+                const float* const filter = m_Weight + (m * channels + c) * m_KernelHeight * m_KernelWidth;
+
+                for (unsigned int oy = 0; oy < outputHeight; ++oy)
+                {
+                    for (unsigned int ox = 0; ox < outputWidth; ++ox)
+                    {
+                        float sum = (m_Bias != nullptr) ? m_Bias[outputChannel] : 0.0f;
+                        for (unsigned int ky = 0; ky < m_KernelHeight; ++ky)
+                        {
+                            const int iy = static_cast<int>(oy * m_Param.m_StrideY + ky) -
+                                           static_cast<int>(m_Param.m_PadTop);
+                            if (iy < 0 || iy >= static_cast<int>(inputHeight))
+                            {
+                                continue;
+                            }
+                            for (unsigned int kx = 0; kx < m_KernelWidth; ++kx)
+                            {
+                                const int ix = static_cast<int>(ox * m_Param.m_StrideX + kx) -
+                                               static_cast<int>(m_Param.m_PadLeft);
+                                if (ix < 0 || ix >= static_cast<int>(inputWidth))
+                                {
+                                    continue;
+                                }
+                                sum += filter[ky * m_KernelWidth + kx] *
+                                       input[index(b, c, static_cast<unsigned int>(iy), static_cast<unsigned int>(ix),
+                                                   channels, inputHeight, inputWidth)];
+                            }
+                        }
+                        output[index(b, outputChannel, oy, ox, outputChannels, outputHeight, outputWidth)] =
+                            m_Bounds.Apply(sum);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace armnn
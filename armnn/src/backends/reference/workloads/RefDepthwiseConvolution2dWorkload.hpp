@@ -0,0 +1,39 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+namespace armnn
+{
+
+/// Float32 depthwise convolution. The weights are [depthMultiplier, channels, height, width] whatever the data
+/// layout, output channel c * depthMultiplier + m being channel c filtered by multiplier m.
+class RefDepthwiseConvolution2dWorkload : public RefBaseWorkload<DepthwiseConvolution2dDescriptor>
+{
+public:
+    /// @param bias - May be nullptr when the bias is disabled.
+    /// @param bounds - Range the output is clamped to, for the activation fused into the layer.
+    RefDepthwiseConvolution2dWorkload(const DepthwiseConvolution2dDescriptor& descriptor,
+                                      const RefWorkloadInfo& info,
+                                      const ConstTensor& weight,
+                                      const ConstTensor* bias,
+                                      const OutputBounds& bounds);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+private:
+    const float* m_Weight;
+    const float* m_Bias;
+    const OutputBounds m_Bounds;
+    unsigned int m_DepthMultiplier;
+    unsigned int m_KernelHeight;
+    unsigned int m_KernelWidth;
+};
+
+} // namespace armnn
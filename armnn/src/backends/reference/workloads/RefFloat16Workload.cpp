@@ -0,0 +1,107 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefFloat16Workload.hpp"
+
+#include <FloatingPointConverter.hpp>
+
+#include <boost/assert.hpp>
+
+#include <cstdint>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Alignment of the Float32 tensors in the scratch memory, that of the tensors in the activation arena.
+constexpr std::size_t TensorAlignment = 64;
+
+std::size_t AlignUp(std::size_t value)
+{
+    return (value + TensorAlignment - 1) / TensorAlignment * TensorAlignment;
+}
+
+} // namespace
+
+RefWorkloadInfo RefFloat16Workload::GetFloat32WorkloadInfo(const RefWorkloadInfo& info)
+{
+    RefWorkloadInfo float32Info;
+    unsigned int tensorId = 0;
+    for (TensorInfo tensorInfo : info.m_InputTensorInfos)
+    {
+        tensorInfo.SetDataType(DataType::Float32);
+        float32Info.m_InputTensorInfos.push_back(tensorInfo);
+        float32Info.m_InputIds.push_back(tensorId++);
+    }
+    for (TensorInfo tensorInfo : info.m_OutputTensorInfos)
+    {
+        tensorInfo.SetDataType(DataType::Float32);
+        float32Info.m_OutputTensorInfos.push_back(tensorInfo);
+        float32Info.m_OutputIds.push_back(tensorId++);
+    }
+    return float32Info;
+}
+
+RefFloat16Workload::RefFloat16Workload(const RefWorkloadInfo& info, std::unique_ptr<RefWorkload> float32Workload)
+    : m_Info(info)
+    , m_Float32Workload(std::move(float32Workload))
+{
+    BOOST_ASSERT(m_Float32Workload);
+
+    std::size_t offset = 0;
+    auto addTensor = [this, &offset](const TensorInfo& tensorInfo)
+    {
+        m_TensorOffsets.push_back(offset);
+        offset += AlignUp(sizeof(float) * tensorInfo.GetNumElements());
+    };
+    for (const TensorInfo& tensorInfo : m_Info.m_InputTensorInfos)
+    {
+        addTensor(tensorInfo);
+    }
+    for (const TensorInfo& tensorInfo : m_Info.m_OutputTensorInfos)
+    {
+        addTensor(tensorInfo);
+    }
+    m_Float32ScratchOffset = offset;
+    m_Float32Context.m_Buffers.resize(m_TensorOffsets.size());
+}
+
+std::size_t RefFloat16Workload::GetScratchSize() const
+{
+    return m_Float32ScratchOffset + m_Float32Workload->GetScratchSize();
+}
+
+void RefFloat16Workload::Execute(const RefExecutionContext& context) const
+{
+    uint8_t* const scratch = static_cast<uint8_t*>(context.m_Scratch);
+    for (std::size_t i = 0; i < m_TensorOffsets.size(); ++i)
+    {
+        m_Float32Context.m_Buffers[i] = scratch + m_TensorOffsets[i];
+    }
+    m_Float32Context.m_Scratch = scratch + m_Float32ScratchOffset;
+
+    const std::size_t numInputs = m_Info.m_InputIds.size();
+    for (std::size_t i = 0; i < numInputs; ++i)
+    {
+        FloatingPointConverter::ConvertFloat16To32(context.m_Buffers[m_Info.m_InputIds[i]],
+                                                   m_Info.m_InputTensorInfos[i].GetNumElements(),
+                                                   static_cast<float*>(m_Float32Context.m_Buffers[i]));
+    }
+
+    m_Float32Workload->Execute(m_Float32Context);
+
+    for (std::size_t i = 0; i < m_Info.m_OutputIds.size(); ++i)
+    {
+        FloatingPointConverter::ConvertFloat32To16(
+            static_cast<const float*>(m_Float32Context.m_Buffers[numInputs + i]),
+            m_Info.m_OutputTensorInfos[i].GetNumElements(),
+            context.m_Buffers[m_Info.m_OutputIds[i]]);
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,43 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+
+#include <memory>
+
+namespace armnn
+{
+
+/// Runs a Float16 layer (see ConvertToFp16()) with its Float32 workload: the inputs are widened to Float32 in
+/// scratch memory and the outputs rounded back to Float16 as they are stored, which is what a device storing its
+/// tensors in half precision computes, up to the precision of its arithmetic.
+class RefFloat16Workload : public RefWorkload
+{
+public:
+    /// The tensors of the Float32 workload for a Float16 layer with the given tensors: the same TensorInfos with the
+    /// Float32 data type, the inputs having the ids 0 to numInputs - 1 and the outputs the following ones.
+    static RefWorkloadInfo GetFloat32WorkloadInfo(const RefWorkloadInfo& info);
+
+    /// @param info - The Float16 tensors of the layer.
+    /// @param float32Workload - The workload of the layer for the tensors GetFloat32WorkloadInfo() returns.
+    RefFloat16Workload(const RefWorkloadInfo& info, std::unique_ptr<RefWorkload> float32Workload);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+    std::size_t GetScratchSize() const override;
+
+private:
+    const RefWorkloadInfo m_Info;
+    const std::unique_ptr<RefWorkload> m_Float32Workload;
+    /// Offset in the scratch memory of the Float32 copy of each input, then of each output. The scratch memory of
+    /// the Float32 workload comes after them.
+    std::vector<std::size_t> m_TensorOffsets;
+    std::size_t m_Float32ScratchOffset;
+    /// The context of the Float32 workload, whose buffers are set at each execution (executions don't overlap).
+    mutable RefExecutionContext m_Float32Context;
+};
+
+} // namespace armnn
@@ -0,0 +1,67 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefFullyConnectedUint8Workload.hpp"
+
+#include <cstring>
+
+namespace armnn
+{
+
+RefFullyConnectedUint8Workload::RefFullyConnectedUint8Workload(const FullyConnectedDescriptor& descriptor,
+                                                               const RefWorkloadInfo& info,
+                                                               const ConstTensor& weight,
+                                                               const ConstTensor* bias,
+                                                               const OutputBounds& bounds)
+    : RefBaseWorkload(descriptor, info)
+{
+    CheckQuantizedWeights(weight, bias);
+
+    const TensorInfo& inputInfo  = m_Info.m_InputTensorInfos[0];
+    const TensorInfo& outputInfo = m_Info.m_OutputTensorInfos[0];
+
+    // The input is flattened to [batches, inputSize].
+    m_BatchSize  = inputInfo.GetShape()[0];
+    m_InputSize  = inputInfo.GetNumElements() / m_BatchSize;
+    m_OutputSize = outputInfo.GetShape()[1];
+
+    // The weights are [inputSize, outputSize], or [outputSize, inputSize] when m_TransposeWeightMatrix is set.
+    m_Weights = PrepareQuantizedGemmWeights(weight, m_OutputSize, m_InputSize, m_Param.m_TransposeWeightMatrix, bias,
+                                            inputInfo.GetQuantizationOffset());
+
+    const std::pair<int32_t, int32_t> outputBounds = GetQuantizedBounds(bounds, outputInfo);
+    m_Requantization = Requantization(double(inputInfo.GetQuantizationScale()) *
+                                      double(weight.GetInfo().GetQuantizationScale()) /
+                                      double(outputInfo.GetQuantizationScale()),
+                                      outputInfo.GetQuantizationOffset(), outputBounds.first, outputBounds.second);
+}
+
+std::size_t RefFullyConnectedUint8Workload::GetScratchSize() const
+{
+    return m_Weights.m_PaddedDepth != m_InputSize ? std::size_t(m_BatchSize) * m_Weights.m_PaddedDepth : 0;
+}
+
+void RefFullyConnectedUint8Workload::Execute(const RefExecutionContext& context) const
+{
+    const uint8_t* input = GetInput<uint8_t>(context, 0);
+    std::size_t inputStride = m_InputSize;
+
+    if (m_Weights.m_PaddedDepth != m_InputSize)
+    {
+        uint8_t* const rows = static_cast<uint8_t*>(context.m_Scratch);
+        for (unsigned int b = 0; b < m_BatchSize; ++b)
+        {
+            uint8_t* const row = rows + b * m_Weights.m_PaddedDepth;
+            std::memcpy(row, input + b * m_InputSize, m_InputSize);
+            std::memset(row + m_InputSize, 0, m_Weights.m_PaddedDepth - m_InputSize);
+        }
+        input = rows;
+        inputStride = m_Weights.m_PaddedDepth;
+    }
+
+    QuantizedGemm(m_BatchSize, input, inputStride, m_Weights, m_Requantization,
+                  GetOutput<uint8_t>(context, 0), m_OutputSize, 1);
+}
+
+} // namespace armnn
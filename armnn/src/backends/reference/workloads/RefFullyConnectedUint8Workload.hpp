@@ -0,0 +1,44 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "QuantizedGemm.hpp"
+#include "RefWorkload.hpp"
+#include "RefWorkloadUtils.hpp"
+#include "Requantization.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+namespace armnn
+{
+
+/// QuantisedAsymm8 fully connected layer, computed by QuantizedGemm() from the input, copied into rows padded to
+/// QuantizedGemmDepthStep bytes when its size is not a multiple of it.
+class RefFullyConnectedUint8Workload : public RefBaseWorkload<FullyConnectedDescriptor>
+{
+public:
+    /// @param weight - QuantisedAsymm8 weights.
+    /// @param bias - Signed32 bias, with the scale of the input times the scale of the weights. May be nullptr when
+    /// the bias is disabled.
+    /// @param bounds - Range the output is clamped to, for the activation fused into the layer.
+    RefFullyConnectedUint8Workload(const FullyConnectedDescriptor& descriptor,
+                                   const RefWorkloadInfo& info,
+                                   const ConstTensor& weight,
+                                   const ConstTensor* bias,
+                                   const OutputBounds& bounds);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+    std::size_t GetScratchSize() const override;
+
+private:
+    QuantizedGemmWeights m_Weights;
+    Requantization m_Requantization;
+    unsigned int m_BatchSize;
+    unsigned int m_InputSize;
+    unsigned int m_OutputSize;
+};
+
+} // namespace armnn
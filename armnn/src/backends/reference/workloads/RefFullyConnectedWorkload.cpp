@@ -0,0 +1,56 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefFullyConnectedWorkload.hpp"
+
+#include "Gemm.hpp"
+#include "RefWorkloadUtils.hpp"
+
+namespace armnn
+{
+
+RefFullyConnectedWorkload::RefFullyConnectedWorkload(const FullyConnectedDescriptor& descriptor,
+                                                     const RefWorkloadInfo& info,
+                                                     const ConstTensor& weight,
+                                                     const ConstTensor* packedWeight,
+                                                     const ConstTensor* bias,
+                                                     const OutputBounds& bounds)
+    : RefBaseWorkload(descriptor, info)
+    , m_Weight(static_cast<const float*>(weight.GetMemoryArea()))
+    , m_PackedWeight(packedWeight != nullptr ? static_cast<const float*>(packedWeight->GetMemoryArea()) : nullptr)
+    , m_Bias(bias != nullptr ? static_cast<const float*>(bias->GetMemoryArea()) : nullptr)
+    , m_Bounds(bounds)
+{
+    const TensorInfo& inputInfo = m_Info.m_InputTensorInfos[0];
+
+    // The input is flattened to [batches, inputSize].
+    m_BatchSize  = inputInfo.GetShape()[0];
+    m_InputSize  = inputInfo.GetNumElements() / m_BatchSize;
+    m_OutputSize = m_Info.m_OutputTensorInfos[0].GetShape()[1];
+}
+
+void RefFullyConnectedWorkload::Execute(const RefExecutionContext& context) const
+{
+    float* const output = GetOutput(context, 0);
+
+    InitialiseWithBias(output, m_BatchSize, m_OutputSize, m_Bias, false);
+    if (m_PackedWeight != nullptr)
+    {
+        SgemmPackedB(m_BatchSize, m_OutputSize, m_InputSize,
+                     GetInput(context, 0), m_InputSize, false,
+                     m_PackedWeight,
+                     output, m_OutputSize,
+                     true, m_Bounds.m_Min, m_Bounds.m_Max);
+        return;
+    }
+
+    // The weights are [inputSize, outputSize], or [outputSize, inputSize] when m_TransposeWeightMatrix is set.
+    Sgemm(m_BatchSize, m_OutputSize, m_InputSize,
+          GetInput(context, 0), m_InputSize, false,
+          m_Weight, m_Param.m_TransposeWeightMatrix ? m_InputSize : m_OutputSize, m_Param.m_TransposeWeightMatrix,
+          output, m_OutputSize,
+          true, m_Bounds.m_Min, m_Bounds.m_Max);
+}
+
+} // namespace armnn
@@ -0,0 +1,43 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+namespace armnn
+{
+
+/// Float32 fully connected layer, computed by Sgemm() straight from the input and the weights, or from the weights
+/// packed ahead of time (see PackWeights()).
+class RefFullyConnectedWorkload : public RefBaseWorkload<FullyConnectedDescriptor>
+{
+public:
+    /// @param packedWeight - The weights packed in the GemmB16x256 layout, or nullptr to pack them at each
+    /// execution.
+    /// @param bias - May be nullptr when the bias is disabled.
+    /// @param bounds - Range the output is clamped to, for the activation fused into the layer.
+    RefFullyConnectedWorkload(const FullyConnectedDescriptor& descriptor,
+                              const RefWorkloadInfo& info,
+                              const ConstTensor& weight,
+                              const ConstTensor* packedWeight,
+                              const ConstTensor* bias,
+                              const OutputBounds& bounds);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+private:
+    const float* m_Weight;
+    const float* m_PackedWeight;
+    const float* m_Bias;
+    const OutputBounds m_Bounds;
+    unsigned int m_BatchSize;
+    unsigned int m_InputSize;
+    unsigned int m_OutputSize;
+};
+
+} // namespace armnn
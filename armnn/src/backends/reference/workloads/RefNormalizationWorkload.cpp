@@ -0,0 +1,95 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefNormalizationWorkload.hpp"
+
+#include <DataLayoutIndexed.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+void RefNormalizationWorkload::Execute(const RefExecutionContext& context) const
+{
+    if (m_Param.m_NormMethodType != NormalizationAlgorithmMethod::LocalBrightness)
+    {
+        throw UnimplementedException("Only LocalBrightness normalization is supported");
+    }
+
+    const float* const input = GetInput(context, 0);
+    float* const output = GetOutput(context, 0);
+
+    const DataLayoutIndexed dataLayout(m_Param.m_DataLayout);
+    const TensorShape& shape = m_Info.m_InputTensorInfos[0].GetShape();
+    const unsigned int batchSize = shape[0];
+    const unsigned int channels  = shape[dataLayout.GetChannelsIndex()];
+    const unsigned int height    = shape[dataLayout.GetHeightIndex()];
+    const unsigned int width     = shape[dataLayout.GetWidthIndex()];
+
+    const bool isNhwc = m_Param.m_DataLayout == DataLayout::NHWC;
+    auto index = [=](unsigned int b, unsigned int c, unsigned int y, unsigned int x)
+    {
+        return isNhwc ? ((b * height + y) * width + x) * channels + c
+                      : ((b * channels + c) * height + y) * width + x;
+    };
+
+    const int radius = static_cast<int>(m_Param.m_NormSize / 2);
+    const bool isAcross = m_Param.m_NormChannelType == NormalizationAlgorithmChannel::Across;
+
+    for (unsigned int b = 0; b < batchSize; ++b)
+    {
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            for (unsigned int y = 0; y < height; ++y)
+            {
+                for (unsigned int x = 0; x < width; ++x)
+                {
+                    // Sum of the squares over the neighbouring channels, or the neighbouring pixels of the channel.
+                    float accumulatedScale = 0.0f;
+                    if (isAcross)
+                    {
+                        const int first = std::max(0, static_cast<int>(c) - radius);
+                        const int last  = std::min(static_cast<int>(channels) - 1, static_cast<int>(c) + radius);
+                        for (int k = first; k <= last; ++k)
+                        {
+                            const float value = input[index(b, static_cast<unsigned int>(k), y, x)];
+                            accumulatedScale += value * value;
+                        }
+                    }
+                    else
+                    {
+                        for (int dy = -radius; dy <= radius; ++dy)
+                        {
+                            for (int dx = -radius; dx <= radius; ++dx)
+                            {
+                                const int ny = static_cast<int>(y) + dy;
+                                const int nx = static_cast<int>(x) + dx;
+                                if (ny < 0 || nx < 0 || ny >= static_cast<int>(height) ||
+                                    nx >= static_cast<int>(width))
+                                {
+                                    continue;
+                                }
+                                const float value = input[index(b, c, static_cast<unsigned int>(ny),
+                                                                static_cast<unsigned int>(nx))];
+                                accumulatedScale += value * value;
+                            }
+                        }
+                    }
+
+                    const float scale = m_Param.m_K + m_Param.m_Alpha * accumulatedScale;
+                    const unsigned int i = index(b, c, y, x);
+                    output[i] = input[i] / std::pow(scale, m_Param.m_Beta);
+                }
+            }
+        }
+    }
+}
+
+} // namespace armnn
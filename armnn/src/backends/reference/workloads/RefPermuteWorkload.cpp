@@ -0,0 +1,22 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefPermuteWorkload.hpp"
+
+#include <Permute.hpp>
+
+#include <armnn/TypesUtils.hpp>
+
+namespace armnn
+{
+
+void RefPermuteWorkload::Execute(const RefExecutionContext& context) const
+{
+    const TensorInfo& outputInfo = m_Info.m_OutputTensorInfos[0];
+    armnnUtils::Permute(outputInfo.GetShape(), m_Param.m_DimMappings,
+                        GetInput<void>(context, 0), GetOutput<void>(context, 0),
+                        GetDataTypeSize(outputInfo.GetDataType()));
+}
+
+} // namespace armnn
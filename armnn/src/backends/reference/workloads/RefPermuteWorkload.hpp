@@ -0,0 +1,23 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+namespace armnn
+{
+
+/// Permutation of the dimensions of a tensor, of any data type.
+class RefPermuteWorkload : public RefBaseWorkload<PermuteDescriptor>
+{
+public:
+    using RefBaseWorkload::RefBaseWorkload;
+
+    void Execute(const RefExecutionContext& context) const override;
+};
+
+} // namespace armnn
@@ -0,0 +1,31 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+#include "Requantization.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+namespace armnn
+{
+
+/// QuantisedAsymm8 max, average and L2 pooling, with the semantics of RefPooling2dWorkload: padding stands for
+/// zeros, the input offset. Max and average pooling work on the quantized values, the average being rounded to the
+/// nearest, and only requantize when the output parameters differ from the input ones; L2 pooling goes through
+/// real values.
+class RefPooling2dUint8Workload : public RefBaseWorkload<Pooling2dDescriptor>
+{
+public:
+    RefPooling2dUint8Workload(const Pooling2dDescriptor& descriptor, const RefWorkloadInfo& info);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+private:
+    /// From the input values minus the input offset to the output.
+    Requantization m_Requantization;
+};
+
+} // namespace armnn
@@ -0,0 +1,126 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefPooling2dWorkload.hpp"
+
+#include <DataLayoutIndexed.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+void RefPooling2dWorkload::Execute(const RefExecutionContext& context) const
+{
+    const float* const input = GetInput(context, 0);
+    float* const output = GetOutput(context, 0);
+
+    const DataLayoutIndexed dataLayout(m_Param.m_DataLayout);
+    const TensorShape& inputShape  = m_Info.m_InputTensorInfos[0].GetShape();
+    const TensorShape& outputShape = m_Info.m_OutputTensorInfos[0].GetShape();
+
+    const unsigned int batchSize    = inputShape[0];
+    const unsigned int channels     = inputShape[dataLayout.GetChannelsIndex()];
+    const unsigned int inputHeight  = inputShape[dataLayout.GetHeightIndex()];
+    const unsigned int inputWidth   = inputShape[dataLayout.GetWidthIndex()];
+    const unsigned int outputHeight = outputShape[dataLayout.GetHeightIndex()];
+    const unsigned int outputWidth  = outputShape[dataLayout.GetWidthIndex()];
+
+    // Global pooling (zero strides) covers the whole image when the pool size is left unset.
+    const bool isGlobal = (m_Param.m_StrideX == 0 && m_Param.m_StrideY == 0);
+    const int poolHeight =
+        static_cast<int>((isGlobal && m_Param.m_PoolHeight == 0) ? inputHeight : m_Param.m_PoolHeight);
+    const int poolWidth  =
+        static_cast<int>((isGlobal && m_Param.m_PoolWidth == 0) ? inputWidth : m_Param.m_PoolWidth);
+    const int strideY    = static_cast<int>(std::max(1u, m_Param.m_StrideY));
+    const int strideX    = static_cast<int>(std::max(1u, m_Param.m_StrideX));
+    const int padTop     = static_cast<int>(m_Param.m_PadTop);
+    const int padLeft    = static_cast<int>(m_Param.m_PadLeft);
+    const int heightEnd  = static_cast<int>(inputHeight + m_Param.m_PadBottom);
+    const int widthEnd   = static_cast<int>(inputWidth + m_Param.m_PadRight);
+
+    const bool isNhwc = m_Param.m_DataLayout == DataLayout::NHWC;
+    auto index = [isNhwc, channels](unsigned int b, unsigned int c, unsigned int y, unsigned int x,
+                                    unsigned int height, unsigned int width)
+    {
+        return isNhwc ? ((b * height + y) * width + x) * channels + c
+                      : ((b * channels + c) * height + y) * width + x;
+    };
+
+    for (unsigned int b = 0; b < batchSize; ++b)
+    {
+        for (unsigned int c = 0; c < channels; ++c)
+        {
+            for (unsigned int oy = 0; oy < outputHeight; ++oy)
+            {
+                for (unsigned int ox = 0; ox < outputWidth; ++ox)
+                {
+                    // Window within the padded input, then within the input itself.
+                    int yStart = static_cast<int>(oy) * strideY - padTop;
+                    int xStart = static_cast<int>(ox) * strideX - padLeft;
+                    int yEnd = std::min(yStart + poolHeight, heightEnd);
+                    int xEnd = std::min(xStart + poolWidth, widthEnd);
+                    const int paddedPoolSize = (yEnd - yStart) * (xEnd - xStart);
+
+                    yStart = std::max(yStart, 0);
+                    xStart = std::max(xStart, 0);
+                    yEnd = std::min(yEnd, static_cast<int>(inputHeight));
+                    xEnd = std::min(xEnd, static_cast<int>(inputWidth));
+
+                    const int poolSize = (m_Param.m_PaddingMethod == PaddingMethod::Exclude) ?
+                                         (yEnd - yStart) * (xEnd - xStart) : paddedPoolSize;
+
+                    float result = (m_Param.m_PoolType == PoolingAlgorithm::Max) ?
+                                   -std::numeric_limits<float>::infinity() : 0.0f;
+                    for (int y = yStart; y < yEnd; ++y)
+                    {
+                        for (int x = xStart; x < xEnd; ++x)
+                        {
+                            const float value = input[index(b, c, static_cast<unsigned int>(y),
+                                                            static_cast<unsigned int>(x), inputHeight, inputWidth)];
+                            switch (m_Param.m_PoolType)
+                            {
+                                case PoolingAlgorithm::Max:
+                                    result = std::max(result, value);
+                                    break;
+                                case PoolingAlgorithm::Average:
+                                    result += value;
+                                    break;
+                                case PoolingAlgorithm::L2:
+                                    result += value * value;
+                                    break;
+                                default:
+                                    throw InvalidArgumentException("Unsupported pooling algorithm");
+                            }
+                        }
+                    }
+
+                    if (poolSize <= 0)
+                    {
+                        // The window only covers padding.
+                        result = 0.0f;
+                    }
+                    else if (m_Param.m_PoolType == PoolingAlgorithm::Average)
+                    {
+                        result /= static_cast<float>(poolSize);
+                    }
+                    else if (m_Param.m_PoolType == PoolingAlgorithm::L2)
+                    {
+                        result = std::sqrt(result / static_cast<float>(poolSize));
+                    }
+
+                    output[index(b, c, oy, ox, outputHeight, outputWidth)] = result;
+                }
+            }
+        }
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,23 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+namespace armnn
+{
+
+/// Float32 max, average and L2 pooling.
+class RefPooling2dWorkload : public RefBaseWorkload<Pooling2dDescriptor>
+{
+public:
+    using RefBaseWorkload::RefBaseWorkload;
+
+    void Execute(const RefExecutionContext& context) const override;
+};
+
+} // namespace armnn
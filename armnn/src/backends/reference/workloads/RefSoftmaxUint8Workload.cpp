@@ -0,0 +1,55 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefSoftmaxUint8Workload.hpp"
+
+#include "Requantization.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace armnn
+{
+
+RefSoftmaxUint8Workload::RefSoftmaxUint8Workload(const SoftmaxDescriptor& descriptor, const RefWorkloadInfo& info)
+    : RefBaseWorkload(descriptor, info)
+{
+    const float inputScale = m_Info.m_InputTensorInfos[0].GetQuantizationScale();
+    for (unsigned int difference = 0; difference < m_Exponentials.size(); ++difference)
+    {
+        m_Exponentials[difference] = std::exp(-m_Param.m_Beta * inputScale * static_cast<float>(difference));
+    }
+}
+
+void RefSoftmaxUint8Workload::Execute(const RefExecutionContext& context) const
+{
+    const uint8_t* input = GetInput<uint8_t>(context, 0);
+    uint8_t* output = GetOutput<uint8_t>(context, 0);
+
+    const TensorInfo& outputInfo = m_Info.m_OutputTensorInfos[0];
+    const TensorShape& shape = m_Info.m_InputTensorInfos[0].GetShape();
+    const unsigned int numChannels = shape[shape.GetNumDimensions() - 1];
+    const unsigned int numRows = m_Info.m_InputTensorInfos[0].GetNumElements() / numChannels;
+
+    for (unsigned int row = 0; row < numRows; ++row)
+    {
+        // Subtracting the maximum keeps exp() in range without changing the result.
+        const uint8_t maximum = *std::max_element(input, input + numChannels);
+
+        float sum = 0.0f;
+        for (unsigned int i = 0; i < numChannels; ++i)
+        {
+            sum += m_Exponentials[maximum - input[i]];
+        }
+        for (unsigned int i = 0; i < numChannels; ++i)
+        {
+            output[i] = QuantizeUint8(m_Exponentials[maximum - input[i]] / sum, outputInfo);
+        }
+
+        input += numChannels;
+        output += numChannels;
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,30 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+#include <array>
+
+namespace armnn
+{
+
+/// QuantisedAsymm8 softmax over the innermost dimension. The exponentials only depend on the difference between the
+/// maximum of a row and each of its quantized values, so they are looked up in a table of the 256 possible ones.
+class RefSoftmaxUint8Workload : public RefBaseWorkload<SoftmaxDescriptor>
+{
+public:
+    RefSoftmaxUint8Workload(const SoftmaxDescriptor& descriptor, const RefWorkloadInfo& info);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+private:
+    /// exp(-beta * inputScale * difference) for each difference of quantized values.
+    std::array<float, 256> m_Exponentials;
+};
+
+} // namespace armnn
@@ -0,0 +1,43 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefSoftmaxWorkload.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace armnn
+{
+
+void RefSoftmaxWorkload::Execute(const RefExecutionContext& context) const
+{
+    const float* input = GetInput(context, 0);
+    float* output = GetOutput(context, 0);
+
+    const TensorShape& shape = m_Info.m_InputTensorInfos[0].GetShape();
+    const unsigned int numChannels = shape[shape.GetNumDimensions() - 1];
+    const unsigned int numRows = m_Info.m_InputTensorInfos[0].GetNumElements() / numChannels;
+
+    for (unsigned int row = 0; row < numRows; ++row)
+    {
+        // Subtracting the maximum keeps exp() in range without changing the result.
+        const float maximum = *std::max_element(input, input + numChannels);
+
+        float sum = 0.0f;
+        for (unsigned int i = 0; i < numChannels; ++i)
+        {
+            output[i] = std::exp((input[i] - maximum) * m_Param.m_Beta);
+            sum += output[i];
+        }
+        for (unsigned int i = 0; i < numChannels; ++i)
+        {
+            output[i] /= sum;
+        }
+
+        input += numChannels;
+        output += numChannels;
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,225 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include "RefWinogradConvolution2dWorkload.hpp"
+
+#include "Gemm.hpp"
+
+#include <Winograd.hpp>
+
+#include <DataLayoutIndexed.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+
+using namespace armnnUtils;
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Transformed tiles and products of a block, in floats: about 2 MiB, which keeps the GEMMs working from cache.
+constexpr std::size_t BlockFloats = std::size_t(1) << 19;
+
+/// Blocks are made of whole panels of the GEMM kernel.
+constexpr unsigned int TileGranularity = 16;
+
+unsigned int DivideRoundUp(unsigned int value, unsigned int divisor)
+{
+    return (value + divisor - 1) / divisor;
+}
+
+} // namespace
+
+RefWinogradConvolution2dWorkload::RefWinogradConvolution2dWorkload(const Convolution2dDescriptor& descriptor,
+                                                                   const RefWorkloadInfo& info,
+                                                                   unsigned int outputTile,
+                                                                   const ConstTensor& weight,
+                                                                   const ConstTensor* transformedWeight,
+                                                                   const ConstTensor* bias,
+                                                                   const OutputBounds& bounds)
+    : RefBaseWorkload(descriptor, info)
+    , m_OutputTile(outputTile)
+    , m_InputTile(outputTile + WinogradKernelSize - 1)
+    , m_Bias(bias != nullptr ? static_cast<const float*>(bias->GetMemoryArea()) : nullptr)
+    , m_Bounds(bounds)
+{
+    BOOST_ASSERT(m_Param.m_StrideX == 1 && m_Param.m_StrideY == 1);
+
+    const DataLayoutIndexed dataLayout(m_Param.m_DataLayout);
+    const TensorShape& inputShape  = m_Info.m_InputTensorInfos[0].GetShape();
+    const TensorShape& outputShape = m_Info.m_OutputTensorInfos[0].GetShape();
+
+    m_BatchSize      = inputShape[0];
+    m_InputChannels  = inputShape[dataLayout.GetChannelsIndex()];
+    m_InputHeight    = inputShape[dataLayout.GetHeightIndex()];
+    m_InputWidth     = inputShape[dataLayout.GetWidthIndex()];
+    m_OutputChannels = outputShape[dataLayout.GetChannelsIndex()];
+    m_OutputHeight   = outputShape[dataLayout.GetHeightIndex()];
+    m_OutputWidth    = outputShape[dataLayout.GetWidthIndex()];
+    m_TilesY         = DivideRoundUp(m_OutputHeight, m_OutputTile);
+    m_TilesX         = DivideRoundUp(m_OutputWidth, m_OutputTile);
+
+    if (transformedWeight != nullptr)
+    {
+        BOOST_ASSERT(GetWinogradOutputTile(transformedWeight->GetShape()) == m_OutputTile);
+        m_TransformedWeight = static_cast<const float*>(transformedWeight->GetMemoryArea());
+    }
+    else
+    {
+        m_OwnedTransformedWeight.resize(
+            GetWinogradWeightShape(m_OutputTile, m_OutputChannels, m_InputChannels).GetNumElements());
+        TransformWinogradWeights(weight, m_Param.m_DataLayout, m_OutputTile, m_OwnedTransformedWeight.data());
+        m_TransformedWeight = m_OwnedTransformedWeight.data();
+    }
+
+    const std::size_t floatsPerTile = std::size_t(m_InputTile) * m_InputTile * (m_InputChannels + m_OutputChannels);
+    const unsigned int numTiles = m_TilesY * m_TilesX;
+    const unsigned int blockTiles = static_cast<unsigned int>(
+        std::max<std::size_t>(BlockFloats / floatsPerTile / TileGranularity, 1) * TileGranularity);
+    // Whole groups of lanes, the transforms reading and writing past the last tile of a block.
+    m_TilesPerBlock = std::min(blockTiles, DivideRoundUp(numTiles, WinogradTileLanes) * WinogradTileLanes);
+}
+
+std::size_t RefWinogradConvolution2dWorkload::GetScratchSize() const
+{
+    return sizeof(float) * m_InputTile * m_InputTile * (m_InputChannels + m_OutputChannels) * m_TilesPerBlock;
+}
+
+void RefWinogradConvolution2dWorkload::LoadInputTiles(const float* image,
+                                                      unsigned int c,
+                                                      unsigned int firstTile,
+                                                      unsigned int numTiles,
+                                                      float* tiles) const
+{
+    constexpr unsigned int L = WinogradTileLanes;
+
+    const bool nhwc = m_Param.m_DataLayout == DataLayout::NHWC;
+    const std::size_t strideX = nhwc ? m_InputChannels : 1;
+    const std::size_t strideY = strideX * m_InputWidth;
+    const float* const channel = image + (nhwc ? c : std::size_t(c) * m_InputHeight * m_InputWidth);
+
+    const int height = static_cast<int>(m_InputHeight);
+    const int width  = static_cast<int>(m_InputWidth);
+    const int size   = static_cast<int>(m_InputTile);
+
+    std::fill(tiles, tiles + m_InputTile * m_InputTile * L, 0.0f);
+    for (unsigned int l = 0; l < numTiles; ++l)
+    {
+        const unsigned int tile = firstTile + l;
+        const int y = static_cast<int>((tile / m_TilesX) * m_OutputTile) - static_cast<int>(m_Param.m_PadTop);
+        const int x = static_cast<int>((tile % m_TilesX) * m_OutputTile) - static_cast<int>(m_Param.m_PadLeft);
+
+        // Clip the tile to the input, leaving the padding as zeros.
+        const int beginY = std::max(0, -y);
+        const int endY   = std::min(size, height - y);
+        const int beginX = std::max(0, -x);
+        const int endX   = std::min(size, width - x);
+
+        for (int i = beginY; i < endY; ++i)
+        {
+            const float* const inputRow = channel + (y + i) * strideY;
+            float* const row = tiles + i * size * L + l;
+            for (int j = beginX; j < endX; ++j)
+            {
+                row[j * L] = inputRow[(x + j) * strideX];
+            }
+        }
+    }
+}
+
+void RefWinogradConvolution2dWorkload::Execute(const RefExecutionContext& context) const
+{
+    const float* const input = GetInput(context, 0);
+    float* const output = GetOutput(context, 0);
+
+    const unsigned int numPositions = m_InputTile * m_InputTile;
+    const unsigned int numTiles = m_TilesY * m_TilesX;
+    const unsigned int blockTiles = m_TilesPerBlock;
+
+    // Element i of the transformed tile t of channel c is at transformed[(i * channels + c) * blockTiles + t]:
+    // each position is a [channels, tiles] matrix for the GEMM. Likewise for the products.
+    float* const transformed = static_cast<float*>(context.m_Scratch);
+    float* const products = transformed + std::size_t(numPositions) * m_InputChannels * blockTiles;
+    const std::size_t transformedStride = std::size_t(m_InputChannels) * blockTiles;
+    const std::size_t productsStride = std::size_t(m_OutputChannels) * blockTiles;
+
+    const bool nhwc = m_Param.m_DataLayout == DataLayout::NHWC;
+    const std::size_t outputStrideX = nhwc ? m_OutputChannels : 1;
+    const std::size_t outputStrideY = outputStrideX * m_OutputWidth;
+    const std::size_t outputStrideChannel = nhwc ? 1 : std::size_t(m_OutputHeight) * m_OutputWidth;
+
+    const std::size_t inputSize  = std::size_t(m_InputChannels) * m_InputHeight * m_InputWidth;
+    const std::size_t outputSize = std::size_t(m_OutputChannels) * m_OutputHeight * m_OutputWidth;
+
+    float inputTiles[6 * 6 * WinogradTileLanes];
+    float outputTiles[4 * 4 * WinogradTileLanes];
+
+    for (unsigned int b = 0; b < m_BatchSize; ++b)
+    {
+        const float* const image = input + b * inputSize;
+        float* const result = output + b * outputSize;
+
+        for (unsigned int firstTile = 0; firstTile < numTiles; firstTile += blockTiles)
+        {
+            const unsigned int numBlockTiles = std::min(blockTiles, numTiles - firstTile);
+
+            for (unsigned int c = 0; c < m_InputChannels; ++c)
+            {
+                for (unsigned int t = 0; t < numBlockTiles; t += WinogradTileLanes)
+                {
+                    LoadInputTiles(image, c, firstTile + t, std::min(WinogradTileLanes, numBlockTiles - t),
+                                   inputTiles);
+                    TransformWinogradInput(m_OutputTile, inputTiles, transformed + c * blockTiles + t,
+                                           transformedStride);
+                }
+            }
+
+            for (unsigned int i = 0; i < numPositions; ++i)
+            {
+                Sgemm(m_OutputChannels, numBlockTiles, m_InputChannels,
+                      m_TransformedWeight + std::size_t(i) * m_OutputChannels * m_InputChannels, m_InputChannels, false,
+                      transformed + i * transformedStride, blockTiles, false,
+                      products + i * productsStride, blockTiles,
+                      false);
+            }
+
+            for (unsigned int o = 0; o < m_OutputChannels; ++o)
+            {
+                const float bias = m_Bias != nullptr ? m_Bias[o] : 0.0f;
+                float* const channel = result + o * outputStrideChannel;
+
+                for (unsigned int t = 0; t < numBlockTiles; t += WinogradTileLanes)
+                {
+                    TransformWinogradOutput(m_OutputTile, products + o * blockTiles + t, productsStride,
+                                            outputTiles);
+
+                    for (unsigned int l = 0; l < std::min(WinogradTileLanes, numBlockTiles - t); ++l)
+                    {
+                        const unsigned int tile = firstTile + t + l;
+                        const unsigned int y = (tile / m_TilesX) * m_OutputTile;
+                        const unsigned int x = (tile % m_TilesX) * m_OutputTile;
+
+                        // The last tiles of a row or column may stick out of the output.
+                        const unsigned int height = std::min(m_OutputTile, m_OutputHeight - y);
+                        const unsigned int width  = std::min(m_OutputTile, m_OutputWidth - x);
+                        for (unsigned int i = 0; i < height; ++i)
+                        {
+                            for (unsigned int j = 0; j < width; ++j)
+                            {
+                                channel[(y + i) * outputStrideY + (x + j) * outputStrideX] = m_Bounds.Apply(
+                                    outputTiles[(i * m_OutputTile + j) * WinogradTileLanes + l] + bias);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,67 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkload.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include <armnn/Descriptors.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Float32 3x3 stride-1 convolution computed with Winograd F(2x2, 3x3) or F(4x4, 3x3) (see Winograd.hpp).
+///
+/// Tiles of input are transformed a block at a time, so that the transformed tiles and their products stay in
+/// cache: for each of the (m + 2)^2 positions in a tile, the products over the channels are one Sgemm() of the
+/// transformed filters, [outputChannels, inputChannels], with the transformed tiles, [inputChannels, tiles].
+class RefWinogradConvolution2dWorkload : public RefBaseWorkload<Convolution2dDescriptor>
+{
+public:
+    /// @param outputTile - Size of the output tiles, 2 or 4.
+    /// @param transformedWeight - The weights transformed for outputTile, or nullptr to transform them here.
+    /// @param bias - May be nullptr when the bias is disabled.
+    /// @param bounds - Range the output is clamped to, for the activation fused into the layer.
+    RefWinogradConvolution2dWorkload(const Convolution2dDescriptor& descriptor,
+                                     const RefWorkloadInfo& info,
+                                     unsigned int outputTile,
+                                     const ConstTensor& weight,
+                                     const ConstTensor* transformedWeight,
+                                     const ConstTensor* bias,
+                                     const OutputBounds& bounds);
+
+    void Execute(const RefExecutionContext& context) const override;
+
+    std::size_t GetScratchSize() const override;
+
+private:
+    /// Gathers the (m + 2) x (m + 2) tiles of input of channel c for the output tiles [firstTile, firstTile +
+    /// numTiles), interleaved for TransformWinogradInput(). Padding, and the lanes past numTiles, are zeros.
+    void LoadInputTiles(const float* image, unsigned int c, unsigned int firstTile, unsigned int numTiles,
+                        float* tiles) const;
+
+    unsigned int m_OutputTile;
+    unsigned int m_InputTile;
+
+    const float* m_TransformedWeight;
+    const float* m_Bias;
+    const OutputBounds m_Bounds;
+    std::vector<float> m_OwnedTransformedWeight;
+
+    unsigned int m_BatchSize;
+    unsigned int m_InputChannels;
+    unsigned int m_InputHeight;
+    unsigned int m_InputWidth;
+    unsigned int m_OutputChannels;
+    unsigned int m_OutputHeight;
+    unsigned int m_OutputWidth;
+    unsigned int m_TilesY;
+    unsigned int m_TilesX;
+    unsigned int m_TilesPerBlock;
+};
+
+} // namespace armnn
@@ -0,0 +1,74 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace armnn
+{
+
+/// Memory used by the workloads of a network during an execution.
+struct RefExecutionContext
+{
+    /// Memory of each tensor of the network, indexed by the tensor ids given to the workloads.
+    std::vector<void*> m_Buffers;
+    /// Temporary memory shared by the workloads, at least as large as the largest GetScratchSize().
+    void* m_Scratch = nullptr;
+};
+
+/// Tensors a workload reads and writes.
+struct RefWorkloadInfo
+{
+    std::vector<TensorInfo>   m_InputTensorInfos;
+    std::vector<TensorInfo>   m_OutputTensorInfos;
+    std::vector<unsigned int> m_InputIds;
+    std::vector<unsigned int> m_OutputIds;
+};
+
+/// The execution of a layer by the reference backend.
+class RefWorkload
+{
+public:
+    virtual ~RefWorkload() = default;
+
+    virtual void Execute(const RefExecutionContext& context) const = 0;
+
+    /// Bytes of temporary memory Execute() needs in RefExecutionContext::m_Scratch.
+    virtual std::size_t GetScratchSize() const { return 0; }
+};
+
+/// A workload configured by the descriptor of its layer.
+template <typename Descriptor>
+class RefBaseWorkload : public RefWorkload
+{
+public:
+    RefBaseWorkload(const Descriptor& descriptor, const RefWorkloadInfo& info)
+    : m_Param(descriptor)
+    , m_Info(info)
+    {
+    }
+
+protected:
+    /// The data of the tensors, as values of type T: float for Float32 workloads, uint8_t for QuantisedAsymm8 ones.
+    template <typename T = float>
+    const T* GetInput(const RefExecutionContext& context, unsigned int index) const
+    {
+        return static_cast<const T*>(context.m_Buffers[m_Info.m_InputIds[index]]);
+    }
+
+    template <typename T = float>
+    T* GetOutput(const RefExecutionContext& context, unsigned int index) const
+    {
+        return static_cast<T*>(context.m_Buffers[m_Info.m_OutputIds[index]]);
+    }
+
+    const Descriptor m_Param;
+    const RefWorkloadInfo m_Info;
+};
+
+} // namespace armnn
@@ -0,0 +1,52 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+
+namespace armnn
+{
+
+/// Range the results of a workload are clamped to as they are stored: the ReLu or BoundedReLu activation fused into
+/// its layer (see FuseActivations()), unbounded when there is none.
+struct OutputBounds
+{
+    float m_Min = -std::numeric_limits<float>::infinity();
+    float m_Max = std::numeric_limits<float>::infinity();
+
+    bool IsBounded() const
+    {
+        return m_Min > -std::numeric_limits<float>::infinity() || m_Max < std::numeric_limits<float>::infinity();
+    }
+
+    float Apply(float value) const { return std::min(std::max(value, m_Min), m_Max); }
+};
+
+/// Initialises a rows x columns row-major matrix with the bias of each row (biasPerRow) or of each column, or with
+/// zeros if there is no bias. GEMMs then accumulate into it.
+inline void InitialiseWithBias(float* matrix, unsigned int rows, unsigned int columns,
+                               const float* bias, bool biasPerRow)
+{
+    for (unsigned int row = 0; row < rows; ++row)
+    {
+        float* const out = matrix + static_cast<std::size_t>(row) * columns;
+        if (bias == nullptr)
+        {
+            std::fill(out, out + columns, 0.0f);
+        }
+        else if (biasPerRow)
+        {
+            std::fill(out, out + columns, bias[row]);
+        }
+        else
+        {
+            std::copy(bias, bias + columns, out);
+        }
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,139 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefWorkloadUtils.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace armnn
+{
+
+/// The range of QuantisedAsymm8 values.
+constexpr int32_t QuantizedUint8Min = 0;
+constexpr int32_t QuantizedUint8Max = 255;
+
+/// (a * b * 2) / 2^31, rounded to the nearest, saturating the only overflowing case (a = b = INT32_MIN).
+inline int32_t SaturatingRoundingDoublingHighMultiply(int32_t a, int32_t b)
+{
+    if (a == std::numeric_limits<int32_t>::min() && b == std::numeric_limits<int32_t>::min())
+    {
+        return std::numeric_limits<int32_t>::max();
+    }
+    const int64_t product = int64_t(a) * int64_t(b);
+    const int64_t nudge = product >= 0 ? (int64_t(1) << 30) : 1 - (int64_t(1) << 30);
+    return static_cast<int32_t>((product + nudge) / (int64_t(1) << 31));
+}
+
+/// value / 2^exponent, rounded to the nearest, ties away from zero.
+inline int32_t RoundingDivideByPowerOfTwo(int32_t value, int exponent)
+{
+    const int32_t mask = static_cast<int32_t>((int64_t(1) << exponent) - 1);
+    const int32_t remainder = value & mask;
+    const int32_t threshold = (mask >> 1) + (value < 0 ? 1 : 0);
+    return (value >> exponent) + (remainder > threshold ? 1 : 0);
+}
+
+/// Converts int32 accumulators to QuantisedAsymm8 values with the fixed-point arithmetic of the Arm Compute Library
+/// and gemmlowp kernels, so that the results match theirs bit for bit: the real multiplier (the scale of the
+/// accumulators over the scale of the outputs) is held as a Q0.31 value and a power of two, applied by a rounding
+/// doubling high multiplication and a rounding right shift. The output offset is then added and the result clamped.
+class Requantization
+{
+public:
+    Requantization() = default;
+
+    /// @param multiplier - The scale of the accumulators divided by the scale of the outputs.
+    /// @param outputOffset - The quantization offset of the outputs.
+    /// @param min, max - The range the outputs are clamped to (see GetQuantizedBounds()).
+    Requantization(double multiplier, int32_t outputOffset,
+                   int32_t min = QuantizedUint8Min, int32_t max = QuantizedUint8Max)
+    : m_OutputOffset(outputOffset)
+    , m_Min(min)
+    , m_Max(max)
+    {
+        int exponent = 0;
+        const double fraction = std::frexp(multiplier, &exponent);
+        int64_t fixedPoint = static_cast<int64_t>(std::round(fraction * double(int64_t(1) << 31)));
+        if (fixedPoint == (int64_t(1) << 31))
+        {
+            fixedPoint /= 2;
+            ++exponent;
+        }
+        if (fixedPoint == 0 || exponent < -31)
+        {
+            // Too small to make any accumulator non-zero.
+            fixedPoint = 0;
+            exponent = 0;
+        }
+        m_Multiplier = static_cast<int32_t>(fixedPoint);
+        m_LeftShift  = std::max(exponent, 0);
+        m_RightShift = std::max(-exponent, 0);
+    }
+
+    uint8_t operator()(int32_t value) const
+    {
+        const int64_t shifted = int64_t(value) * (int64_t(1) << m_LeftShift);
+        const int32_t saturated = static_cast<int32_t>(
+            std::min<int64_t>(std::max<int64_t>(shifted, std::numeric_limits<int32_t>::min()),
+                              std::numeric_limits<int32_t>::max()));
+        const int32_t scaled = RoundingDivideByPowerOfTwo(
+            SaturatingRoundingDoublingHighMultiply(saturated, m_Multiplier), m_RightShift);
+        return static_cast<uint8_t>(std::min(std::max(scaled + m_OutputOffset, m_Min), m_Max));
+    }
+
+private:
+    int32_t m_Multiplier = 0;
+    int     m_LeftShift = 0;
+    int     m_RightShift = 0;
+    int32_t m_OutputOffset = 0;
+    int32_t m_Min = QuantizedUint8Min;
+    int32_t m_Max = QuantizedUint8Max;
+};
+
+/// Quantizes a real value with the parameters of the tensor, rounding to the nearest and saturating (NaN giving the
+/// smallest value).
+inline uint8_t QuantizeUint8(float value, const TensorInfo& info)
+{
+    const float quantized = std::round(value / info.GetQuantizationScale()) + float(info.GetQuantizationOffset());
+    if (!(quantized > float(QuantizedUint8Min)))
+    {
+        return QuantizedUint8Min;
+    }
+    return static_cast<uint8_t>(std::min(quantized, float(QuantizedUint8Max)));
+}
+
+inline float DequantizeUint8(uint8_t value, const TensorInfo& info)
+{
+    return info.GetQuantizationScale() * float(int32_t(value) - info.GetQuantizationOffset());
+}
+
+/// The range of QuantisedAsymm8 values of the output tensor the bounds of a fused activation correspond to.
+inline std::pair<int32_t, int32_t> GetQuantizedBounds(const OutputBounds& bounds, const TensorInfo& outputInfo)
+{
+    const int32_t min = std::isfinite(bounds.m_Min) ? QuantizeUint8(bounds.m_Min, outputInfo) : QuantizedUint8Min;
+    const int32_t max = std::isfinite(bounds.m_Max) ? QuantizeUint8(bounds.m_Max, outputInfo) : QuantizedUint8Max;
+    return { min, max };
+}
+
+/// Throws unless the constants of a QuantisedAsymm8 layer are quantized as QuantizeGraph() does: QuantisedAsymm8
+/// weights and a Signed32 bias (which may be nullptr).
+inline void CheckQuantizedWeights(const ConstTensor& weight, const ConstTensor* bias)
+{
+    if (weight.GetInfo().GetDataType() != DataType::QuantisedAsymm8 ||
+        (bias != nullptr && bias->GetInfo().GetDataType() != DataType::Signed32))
+    {
+        throw InvalidArgumentException("QuantisedAsymm8 layers need QuantisedAsymm8 weights and a Signed32 bias");
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,127 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+// Counts the heap allocations made while building a network through INetwork, by replacing the global operator
+// new, and reports them per layer along with the time per layer.
+//
+// The network is a chain alternating Activation and Softmax layers, each with one input, one output and one
+// consumer, whose slots, connection and name should all be stored without an allocation of their own.
+//
+// Usage: AllocationCountBenchmark [numLayers (default 20000)] [numRounds (default 5)]
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+
+#include <boost/format.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::atomic<std::size_t> g_NumAllocations(0);
+
+void* CountedAllocate(std::size_t size)
+{
+    g_NumAllocations.fetch_add(1, std::memory_order_relaxed);
+    void* const pointer = std::malloc(size == 0 ? 1 : size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void BuildChain(const std::vector<std::string>& names)
+{
+    using namespace armnn;
+
+    INetworkPtr network = INetwork::Create();
+    const TensorInfo info({ 1, 16 }, DataType::Float32);
+
+    IConnectableLayer* previous = network->AddInputLayer(0, "input");
+    previous->GetOutputSlot(0).SetTensorInfo(info);
+
+    ActivationDescriptor activation;
+    activation.m_Function = ActivationFunction::ReLu;
+    const SoftmaxDescriptor softmax;
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        IConnectableLayer* const layer = i % 2 == 0 ? network->AddActivationLayer(activation, names[i].c_str())
+                                                    : network->AddSoftmaxLayer(softmax, names[i].c_str());
+        layer->GetOutputSlot(0).SetTensorInfo(info);
+        previous->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+        previous = layer;
+    }
+
+    IConnectableLayer* const output = network->AddOutputLayer(0, "output");
+    previous->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+}
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return CountedAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+int main(int argc, char* argv[])
+{
+    const unsigned int numLayers = argc > 1 ? static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10)) : 20000;
+    const unsigned int numRounds = argc > 2 ? static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10)) : 5;
+
+    // The names are made beforehand so that only the allocations of the network are counted.
+    std::vector<std::string> names;
+    names.reserve(numLayers);
+    for (unsigned int i = 0; i < numLayers; ++i)
+    {
+        names.push_back("layer_" + std::to_string(i));
+    }
+
+    for (unsigned int round = 0; round < numRounds; ++round)
+    {
+        const std::size_t allocationsAtStart = g_NumAllocations.load();
+        const auto start = std::chrono::steady_clock::now();
+        BuildChain(names);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const std::size_t numAllocations = g_NumAllocations.load() - allocationsAtStart;
+
+        std::cout << boost::format("round %1%: %2% allocations, %3$.3f per layer, %4$.1f ns per layer")
+                     % round % numAllocations % (double(numAllocations) / numLayers) % (seconds * 1e9 / numLayers)
+                  << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+// Builds independent networks on 1 to N threads at once, checking that the layer guids stay unique across all of
+// them, and reports the throughput for each number of threads and its speedup over one thread.
+//
+// Fails (exit code 1) if two layers get the same guid. Running it under ThreadSanitizer also checks the graph
+// construction path for data races.
+//
+// Usage: ConcurrentConstructionBenchmark [maxThreads (default: hardware threads)] [networksPerThread (default 200)]
+//                                        [layersPerNetwork (default 200)]
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+void BuildNetworks(unsigned int numNetworks, unsigned int numLayers, std::vector<armnn::LayerGuid>& guids)
+{
+    using namespace armnn;
+
+    const TensorInfo info({ 1, 16 }, DataType::Float32);
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::ReLu;
+
+    for (unsigned int n = 0; n < numNetworks; ++n)
+    {
+        INetworkPtr network = INetwork::Create();
+        IConnectableLayer* previous = network->AddInputLayer(0, "input");
+        previous->GetOutputSlot(0).SetTensorInfo(info);
+        guids.push_back(previous->GetGuid());
+
+        for (unsigned int i = 0; i < numLayers; ++i)
+        {
+            const std::string name = "activation_" + std::to_string(i);
+            IConnectableLayer* const layer = network->AddActivationLayer(descriptor, name.c_str());
+            layer->GetOutputSlot(0).SetTensorInfo(info);
+            previous->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+            guids.push_back(layer->GetGuid());
+            previous = layer;
+        }
+
+        IConnectableLayer* const output = network->AddOutputLayer(0, "output");
+        previous->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+        guids.push_back(output->GetGuid());
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const unsigned int maxThreads = argc > 1 ? static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10))
+                                             : std::max(1u, std::thread::hardware_concurrency());
+    const unsigned int numNetworks = argc > 2 ? static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10)) : 200;
+    const unsigned int numLayers = argc > 3 ? static_cast<unsigned int>(std::strtoul(argv[3], nullptr, 10)) : 200;
+
+    double singleThreadRate = 0.0;
+    for (unsigned int numThreads = 1; numThreads <= maxThreads; numThreads *= 2)
+    {
+        std::vector<std::vector<armnn::LayerGuid>> guids(numThreads);
+        std::vector<std::thread> threads;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned int t = 0; t < numThreads; ++t)
+        {
+            threads.emplace_back(BuildNetworks, numNetworks, numLayers, std::ref(guids[t]));
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::vector<armnn::LayerGuid> allGuids;
+        for (const std::vector<armnn::LayerGuid>& threadGuids : guids)
+        {
+            allGuids.insert(allGuids.end(), threadGuids.begin(), threadGuids.end());
+        }
+        std::sort(allGuids.begin(), allGuids.end());
+        if (std::adjacent_find(allGuids.begin(), allGuids.end()) != allGuids.end())
+        {
+            std::cerr << boost::format("%1% threads: duplicate layer guids") % numThreads << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        const double rate = double(numThreads) * numNetworks / seconds;
+        if (numThreads == 1)
+        {
+            singleThreadRate = rate;
+        }
+        std::cout << boost::format("%1% threads: %2% layers in %3$.3f s, %4$.0f networks/s, %5$.2fx")
+                     % numThreads % allGuids.size() % seconds % rate % (rate / singleThreadRate)
+                  << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
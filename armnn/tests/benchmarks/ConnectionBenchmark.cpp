@@ -0,0 +1,136 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+// Times the graph edits which rewire the consumers of an output slot with a large fan-out: moving all of its
+// connections to another slot and back, inserting a layer in front of every consumer (InputSlot::Insert), and
+// disconnecting half of the consumers in random order.
+//
+// Each of these is linear in the fan-out; the time per connection should not grow with it.
+//
+// Usage: ConnectionBenchmark [fanOut (default 16000)] [numRounds (default 5)]
+
+#include "Graph.hpp"
+#include "LayersFwd.hpp"
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+double MillisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+/// An input layer whose output feeds numConsumers Activation layers.
+struct FanOut
+{
+    armnn::Graph m_Graph;
+    armnn::InputLayer* m_Source = nullptr;
+    std::vector<armnn::Layer*> m_Consumers;
+
+    explicit FanOut(unsigned int numConsumers)
+    {
+        using namespace armnn;
+
+        m_Source = m_Graph.AddLayer<InputLayer>(0, "input");
+        m_Source->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 16 }, DataType::Float32));
+
+        m_Consumers.reserve(numConsumers);
+        for (unsigned int i = 0; i < numConsumers; ++i)
+        {
+            const std::string name = "consumer_" + std::to_string(i);
+            Layer* const consumer = m_Graph.AddLayer<ActivationLayer>(ActivationDescriptor(), name.c_str());
+            m_Source->GetOutputSlot(0).Connect(consumer->GetInputSlot(0));
+            m_Consumers.push_back(consumer);
+        }
+    }
+};
+
+double TimeMoveAllConnections(unsigned int fanOut)
+{
+    FanOut network(fanOut);
+    armnn::InputLayer* const other = network.m_Graph.AddLayer<armnn::InputLayer>(1, "other");
+
+    const auto start = Clock::now();
+    network.m_Source->GetOutputSlot(0).MoveAllConnections(other->GetOutputSlot(0));
+    other->GetOutputSlot(0).MoveAllConnections(network.m_Source->GetOutputSlot(0));
+    return MillisecondsSince(start);
+}
+
+double TimeInsert(unsigned int fanOut)
+{
+    FanOut network(fanOut);
+
+    std::vector<armnn::Layer*> inserted;
+    inserted.reserve(fanOut);
+    for (unsigned int i = 0; i < fanOut; ++i)
+    {
+        const std::string name = "inserted_" + std::to_string(i);
+        inserted.push_back(network.m_Graph.AddLayer<armnn::ActivationLayer>(armnn::ActivationDescriptor(),
+                                                                             name.c_str()));
+    }
+
+    const auto start = Clock::now();
+    for (unsigned int i = 0; i < fanOut; ++i)
+    {
+        network.m_Consumers[i]->GetInputSlot(0).Insert(*inserted[i]);
+    }
+    return MillisecondsSince(start);
+}
+
+double TimeRandomDisconnect(unsigned int fanOut, std::mt19937& random)
+{
+    FanOut network(fanOut);
+    std::shuffle(network.m_Consumers.begin(), network.m_Consumers.end(), random);
+
+    armnn::OutputSlot& source = network.m_Source->GetOutputSlot(0);
+    const auto start = Clock::now();
+    for (unsigned int i = 0; i < fanOut / 2; ++i)
+    {
+        source.Disconnect(network.m_Consumers[i]->GetInputSlot(0));
+    }
+    return MillisecondsSince(start);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const unsigned int fanOut = argc > 1 ? static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10)) : 16000;
+    const unsigned int numRounds = argc > 2 ? static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10)) : 5;
+
+    // Keeps the best round of each edit, which is the least disturbed by the rest of the system.
+    double moveMs = 0.0;
+    double insertMs = 0.0;
+    double disconnectMs = 0.0;
+    std::mt19937 random(42);
+    for (unsigned int round = 0; round < numRounds; ++round)
+    {
+        const double move = TimeMoveAllConnections(fanOut);
+        const double insert = TimeInsert(fanOut);
+        const double disconnect = TimeRandomDisconnect(fanOut, random);
+
+        moveMs = round == 0 ? move : std::min(moveMs, move);
+        insertMs = round == 0 ? insert : std::min(insertMs, insert);
+        disconnectMs = round == 0 ? disconnect : std::min(disconnectMs, disconnect);
+    }
+
+    std::cout << boost::format("Fan-out of %1% (best of %2% rounds):") % fanOut % numRounds << std::endl;
+    std::cout << boost::format("  moving all connections and back:           %1$8.3f ms") % moveMs << std::endl;
+    std::cout << boost::format("  InputSlot::Insert on every consumer:       %1$8.3f ms") % insertMs << std::endl;
+    std::cout << boost::format("  disconnecting half the consumers randomly: %1$8.3f ms") % disconnectMs << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,79 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+// Builds large networks through INetwork and reports the time per layer and the peak resident memory.
+//
+// Each round builds a chain of named Activation layers, then destroys the network. As the graph releases its arena
+// in bulk, the peak RSS should stay flat across rounds rather than grow with them.
+//
+// Usage: GraphBuildBenchmark [numLayers (default 100000)] [numRounds (default 5)]
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/INetwork.hpp>
+
+#include <boost/format.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <sys/resource.h>
+
+namespace
+{
+
+double GetPeakRssMiB()
+{
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return double(usage.ru_maxrss) / 1024.0; // ru_maxrss is in KiB on Linux.
+}
+
+void BuildChain(unsigned int numLayers)
+{
+    using namespace armnn;
+
+    INetworkPtr network = INetwork::Create();
+    const TensorInfo info({ 1, 16 }, DataType::Float32);
+
+    IConnectableLayer* previous = network->AddInputLayer(0, "input");
+    previous->GetOutputSlot(0).SetTensorInfo(info);
+
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::ReLu;
+    for (unsigned int i = 0; i < numLayers; ++i)
+    {
+        const std::string name = "activation_" + std::to_string(i);
+        IConnectableLayer* const layer = network->AddActivationLayer(descriptor, name.c_str());
+        layer->GetOutputSlot(0).SetTensorInfo(info);
+        previous->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+        previous = layer;
+    }
+
+    IConnectableLayer* const output = network->AddOutputLayer(0, "output");
+    previous->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const unsigned int numLayers = argc > 1 ? static_cast<unsigned int>(std::strtoul(argv[1], nullptr, 10)) : 100000;
+    const unsigned int numRounds = argc > 2 ? static_cast<unsigned int>(std::strtoul(argv[2], nullptr, 10)) : 5;
+
+    std::cout << boost::format("Building %1% networks of %2% layers") % numRounds % numLayers << std::endl;
+    for (unsigned int round = 0; round < numRounds; ++round)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        BuildChain(numLayers);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << boost::format("round %1%: %2$.3f s, %3$.1f ns per layer, peak RSS %4$.1f MiB")
+                     % round % seconds % (seconds * 1e9 / numLayers) % GetPeakRssMiB()
+                  << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,248 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+// Compares the ways of dispatching on the type of the layers of a graph, in nanoseconds per layer: testing the type
+// with a chain of dynamic_casts, switching on Layer::GetType() and downcasting, and the visitors of LayerVisitor.hpp,
+// visiting all the types of the graph or only one of them.
+//
+// The graph is a chain of six types of layers, and each visit adds one field of the descriptor of the layer to a sum.
+// All the methods walk the graph in topological order, so they only differ by their dispatch. A small graph fits in
+// the caches; a large one shows the cost of touching each layer.
+//
+// Build it with NDEBUG defined: otherwise boost::polymorphic_downcast checks each downcast with a dynamic_cast.
+//
+// Usage: VisitorBenchmark [numLayers... (default 2000 200000)]
+
+#include "Graph.hpp"
+#include "LayerVisitor.hpp"
+#include "LayersFwd.hpp"
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+void BuildChain(Graph& graph, unsigned int numLayers)
+{
+    Layer* previous = graph.AddLayer<InputLayer>(0, "input");
+    for (unsigned int i = 0; i < numLayers; ++i)
+    {
+        Layer* layer = nullptr;
+        switch (i % 6)
+        {
+            case 0:
+            {
+                ActivationDescriptor descriptor;
+                descriptor.m_A = 1.0f;
+                layer = graph.AddLayer<ActivationLayer>(descriptor, "activation");
+                break;
+            }
+            case 1:
+                layer = graph.AddLayer<SoftmaxLayer>(SoftmaxDescriptor(), "softmax");
+                break;
+            case 2:
+            {
+                Pooling2dDescriptor descriptor;
+                descriptor.m_PoolWidth = 2;
+                layer = graph.AddLayer<Pooling2dLayer>(descriptor, "pooling");
+                break;
+            }
+            case 3:
+                layer = graph.AddLayer<NormalizationLayer>(NormalizationDescriptor(), "normalization");
+                break;
+            case 4:
+            {
+                Convolution2dDescriptor descriptor;
+                descriptor.m_StrideX = 1;
+                layer = graph.AddLayer<Convolution2dLayer>(descriptor, "convolution");
+                break;
+            }
+            default:
+            {
+                DepthwiseConvolution2dDescriptor descriptor;
+                descriptor.m_StrideX = 1;
+                layer = graph.AddLayer<DepthwiseConvolution2dLayer>(descriptor, "depthwise");
+                break;
+            }
+        }
+        previous->GetOutputSlot(0).Connect(layer->GetInputSlot(0));
+        previous = layer;
+    }
+    previous->GetOutputSlot(0).Connect(graph.AddLayer<OutputLayer>(0, "output")->GetInputSlot(0));
+}
+
+double SumWithDynamicCasts(const Graph& graph)
+{
+    double sum = 0.0;
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        if (auto activation = dynamic_cast<const ActivationLayer*>(layer))
+        {
+            sum += activation->GetParameters().m_A;
+        }
+        else if (auto softmax = dynamic_cast<const SoftmaxLayer*>(layer))
+        {
+            sum += softmax->GetParameters().m_Beta;
+        }
+        else if (auto pooling = dynamic_cast<const Pooling2dLayer*>(layer))
+        {
+            sum += pooling->GetParameters().m_PoolWidth;
+        }
+        else if (auto normalization = dynamic_cast<const NormalizationLayer*>(layer))
+        {
+            sum += normalization->GetParameters().m_NormSize;
+        }
+        else if (auto convolution = dynamic_cast<const Convolution2dLayer*>(layer))
+        {
+            sum += convolution->GetParameters().m_StrideX;
+        }
+        else if (auto depthwise = dynamic_cast<const DepthwiseConvolution2dLayer*>(layer))
+        {
+            sum += depthwise->GetParameters().m_StrideX;
+        }
+    }
+    return sum;
+}
+
+double SumWithSwitch(const Graph& graph)
+{
+    double sum = 0.0;
+    for (const Layer* layer : graph.TopologicalSort())
+    {
+        switch (layer->GetType())
+        {
+            case LayerType::Activation:
+                sum += boost::polymorphic_downcast<const ActivationLayer*>(layer)->GetParameters().m_A;
+                break;
+            case LayerType::Softmax:
+                sum += boost::polymorphic_downcast<const SoftmaxLayer*>(layer)->GetParameters().m_Beta;
+                break;
+            case LayerType::Pooling2d:
+                sum += boost::polymorphic_downcast<const Pooling2dLayer*>(layer)->GetParameters().m_PoolWidth;
+                break;
+            case LayerType::Normalization:
+                sum += boost::polymorphic_downcast<const NormalizationLayer*>(layer)->GetParameters().m_NormSize;
+                break;
+            case LayerType::Convolution2d:
+                sum += boost::polymorphic_downcast<const Convolution2dLayer*>(layer)->GetParameters().m_StrideX;
+                break;
+            case LayerType::DepthwiseConvolution2d:
+                sum += boost::polymorphic_downcast<const DepthwiseConvolution2dLayer*>(layer)
+                    ->GetParameters().m_StrideX;
+                break;
+            default:
+                break;
+        }
+    }
+    return sum;
+}
+
+struct SumVisitor
+{
+    void Visit(const ActivationLayer& layer) { m_Sum += layer.GetParameters().m_A; }
+    void Visit(const SoftmaxLayer& layer) { m_Sum += layer.GetParameters().m_Beta; }
+    void Visit(const Pooling2dLayer& layer) { m_Sum += layer.GetParameters().m_PoolWidth; }
+    void Visit(const NormalizationLayer& layer) { m_Sum += layer.GetParameters().m_NormSize; }
+    void Visit(const Convolution2dLayer& layer) { m_Sum += layer.GetParameters().m_StrideX; }
+    void Visit(const DepthwiseConvolution2dLayer& layer) { m_Sum += layer.GetParameters().m_StrideX; }
+
+    double m_Sum = 0.0;
+};
+
+double SumWithVisitor(const Graph& graph)
+{
+    SumVisitor visitor;
+    VisitLayers(graph, visitor);
+    return visitor.m_Sum;
+}
+
+struct ActivationSumVisitor
+{
+    void Visit(const ActivationLayer& layer) { m_Sum += layer.GetParameters().m_A; }
+
+    double m_Sum = 0.0;
+};
+
+double SumWithOneTypeVisitor(const Graph& graph)
+{
+    ActivationSumVisitor visitor;
+    VisitLayers(graph, visitor);
+    return visitor.m_Sum;
+}
+
+/// Best time per layer over several rounds of enough walks of the graph to visit about ten million layers.
+template <typename Method>
+double TimePerLayer(const Graph& graph, Method method, double& sink)
+{
+    const unsigned int numWalks = std::max(1u, static_cast<unsigned int>(10000000 / graph.GetNumLayers()));
+    double best = 0.0;
+    for (unsigned int round = 0; round < 5; ++round)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (unsigned int walk = 0; walk < numWalks; ++walk)
+        {
+            sink += method(graph);
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const double nanoseconds = seconds * 1e9 / (double(numWalks) * graph.GetNumLayers());
+        best = round == 0 ? nanoseconds : std::min(best, nanoseconds);
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    std::vector<unsigned int> sizes;
+    for (int i = 1; i < argc; ++i)
+    {
+        sizes.push_back(static_cast<unsigned int>(std::strtoul(argv[i], nullptr, 10)));
+    }
+    if (sizes.empty())
+    {
+        sizes = { 2000, 200000 };
+    }
+
+    // Accumulates the results, so that the walks cannot be optimized away.
+    double sink = 0.0;
+    std::cout << boost::format("%|-20|") % "ns per layer";
+    for (unsigned int numLayers : sizes)
+    {
+        std::cout << boost::format("%|14|") % (boost::format("%1% layers") % numLayers);
+    }
+    std::cout << std::endl;
+
+    std::vector<std::vector<double>> times(4);
+    for (unsigned int numLayers : sizes)
+    {
+        Graph graph;
+        BuildChain(graph, numLayers);
+        times[0].push_back(TimePerLayer(graph, SumWithDynamicCasts, sink));
+        times[1].push_back(TimePerLayer(graph, SumWithSwitch, sink));
+        times[2].push_back(TimePerLayer(graph, SumWithVisitor, sink));
+        times[3].push_back(TimePerLayer(graph, SumWithOneTypeVisitor, sink));
+    }
+
+    const char* const methods[] = { "dynamic_cast chain", "switch + downcast", "visitor", "visitor, one type" };
+    for (std::size_t method = 0; method < times.size(); ++method)
+    {
+        std::cout << boost::format("%|-20|") % methods[method];
+        for (double time : times[method])
+        {
+            std::cout << boost::format("%|14.1f|") % time;
+        }
+        std::cout << std::endl;
+    }
+    return sink > 0.0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}